@@ -0,0 +1,53 @@
+//
+//  AllocationCounter.c
+//  HTMLFastParse
+//
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "AllocationCounter.h"
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void *pointer, size_t size);
+
+static long allocations = 0;
+static bool isPaused = false;
+
+void* __wrap_malloc(size_t size) {
+	if (!isPaused) {
+		allocations++;
+	}
+	return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+	if (!isPaused) {
+		allocations++;
+	}
+	return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void *pointer, size_t size) {
+	if (!isPaused) {
+		allocations++;
+	}
+	return __real_realloc(pointer, size);
+}
+
+void resetAllocationCount(void) {
+	allocations = 0;
+}
+
+long allocationCount(void) {
+	return allocations;
+}
+
+void pauseAllocationCounting(void) {
+	isPaused = true;
+}
+
+void resumeAllocationCounting(void) {
+	isPaused = false;
+}
@@ -0,0 +1,17 @@
+//
+//  AllocationCounter.h
+//  HTMLFastParse
+//
+//  Counts calls to malloc, calloc and realloc. Link with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc
+//
+
+#ifndef AllocationCounter_h
+#define AllocationCounter_h
+
+void resetAllocationCount(void);
+long allocationCount(void);
+//Allocations made by the benchmark harness itself (i.e. cleaning up between documents) shouldn't be charged to the parser
+void pauseAllocationCounting(void);
+void resumeAllocationCounting(void);
+
+#endif /* AllocationCounter_h */
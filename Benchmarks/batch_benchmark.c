@@ -0,0 +1,113 @@
+//
+//  batch_benchmark.c
+//  HTMLFastParse
+//
+//  Measures how parseHTMLBatch scales from one thread up to one per core on a synthetic comment thread.
+//
+//  usage: batch_benchmark [numberOfDocuments] [maxThreads] [repetitions]
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "BatchParse.h"
+
+static const char *fragments[] = {
+	"<p>Just a plain paragraph of text that goes on for a little while, like most comments do.</p>",
+	"<p>Some <strong>bold</strong>, some <em>italic</em> and some <del>struck</del> text.</p>",
+	"<p>A <a href=\"https://example.com/some/long/path?query=1\">link to somewhere</a> in a sentence.</p>",
+	"<blockquote><p>Quoting the parent &amp; replying &gt; inline &#8212; with entities.</p></blockquote>",
+	"<ul><li><p>first</p></li><li><p>second</p></li><li><p>third with <code>code</code></p></li></ul>",
+	"<ol><li><p>one</p></li><li><p>two</p></li></ol>",
+	"<h1>Heading</h1><p>with x<sup>2</sup> superscript</p>",
+	"<pre><code>int main(void) {\n\treturn 0;\n}\n</code></pre>",
+	"<p>Unicode: caf\xc3\xa9 \xe2\x80\x94 \xf0\x9f\x98\x80 emoji</p>",
+};
+
+static unsigned int nextRandom(unsigned int *state) {
+	*state = *state * 1103515245 + 12345;
+	return (*state >> 16) & 0x7fff;
+}
+
+/**
+ Build a comment thread where most comments are short and a few are very long, like a real one
+ */
+static struct t_document* generateThread(int numberOfDocuments, size_t *totalBytes) {
+	struct t_document *documents = malloc(numberOfDocuments * sizeof(struct t_document));
+	unsigned int state = 42;
+	size_t numberOfFragments = sizeof(fragments) / sizeof(fragments[0]);
+	*totalBytes = 0;
+	for (int i = 0; i < numberOfDocuments; i++) {
+		int length = 1 + nextRandom(&state) % 6;
+		if (nextRandom(&state) % 50 == 0) {
+			length *= 40;
+		}
+		size_t size = 64;
+		char *html = malloc(size);
+		size_t used = 0;
+		html[0] = 0x00;
+		strcpy(html, "<div class=\"md\">");
+		used = strlen(html);
+		for (int f = 0; f < length; f++) {
+			const char *fragment = fragments[nextRandom(&state) % numberOfFragments];
+			size_t fragmentLength = strlen(fragment);
+			while (used + fragmentLength + 7 > size) {
+				size *= 2;
+				html = realloc(html, size);
+			}
+			memcpy(&html[used], fragment, fragmentLength);
+			used += fragmentLength;
+		}
+		memcpy(&html[used], "</div>", 7);
+		used += 6;
+		documents[i].html = html;
+		documents[i].length = used;
+		*totalBytes += used;
+	}
+	return documents;
+}
+
+static double now(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+int main(int argc, const char *argv[]) {
+	int numberOfDocuments = argc > 1 ? atoi(argv[1]) : 20000;
+	long onlineCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+	int maxThreads = argc > 2 ? atoi(argv[2]) : (onlineCPUs > 0 ? (int)onlineCPUs : 1);
+	int repetitions = argc > 3 ? atoi(argv[3]) : 5;
+	
+	size_t totalBytes;
+	struct t_document *documents = generateThread(numberOfDocuments, &totalBytes);
+	printf("%d documents, %.2f MB, best of %d\n", numberOfDocuments, totalBytes / 1e6, repetitions);
+	printf("%8s %12s %10s %12s %8s\n", "threads", "seconds", "MB/s", "docs/s", "speedup");
+	
+	double singleThreadSeconds = 0;
+	for (int threads = 1; threads <= maxThreads; threads++) {
+		double best = 0;
+		for (int repetition = 0; repetition < repetitions; repetition++) {
+			double start = now();
+			struct t_batch_result *result = parseHTMLBatch(documents, numberOfDocuments, threads);
+			double elapsed = now() - start;
+			freeBatchResult(result);
+			if (repetition == 0 || elapsed < best) {
+				best = elapsed;
+			}
+		}
+		if (threads == 1) {
+			singleThreadSeconds = best;
+		}
+		printf("%8d %12.4f %10.1f %12.0f %7.2fx\n", threads, best, totalBytes / 1e6 / best, numberOfDocuments / best, singleThreadSeconds / best);
+	}
+	
+	for (int i = 0; i < numberOfDocuments; i++) {
+		free((char *)documents[i].html);
+	}
+	free(documents);
+	return 0;
+}
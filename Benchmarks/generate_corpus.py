@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+#
+#  generate_corpus.py
+#  HTMLFastParse
+#
+#  Generates the checked in benchmark corpus. Each file holds a set of documents
+#  in the markup Reddit's API returns (body_html, already unescaped), separated
+#  by DOCUMENT_SEPARATOR lines. The output is deterministic so the corpus only
+#  changes when this script does.
+#
+
+import os
+import random
+
+DOCUMENT_SEPARATOR = "<!-- document -->"
+
+WORDS = ("the a of and to in is it that for you was with on as have but be they "
+         "this not are at from or one had by word what all were we when your can said "
+         "there use an each which she do how their if will up other about out many then "
+         "them these so some her would make like him into time has look two more write go "
+         "see number no way could people my than first water been call who oil its now find "
+         "long down day did get come made may part thread comment upvote edit source actually "
+         "probably literally compiler benchmark release update latency memory").split()
+
+EMOJI = ["\U0001F600", "\U0001F602", "\U0001F44D", "\U0001F525", "\U0001F914", "❤️",
+         "\U0001F389", "\U0001F62D", "\U0001F1FA\U0001F1F8", "\U0001F468‍\U0001F4BB"]
+CJK = "日本語のテキスト中文한국어"
+ENTITIES = ["&amp;", "&quot;", "&#39;", "&lt;", "&gt;", "&nbsp;", "&#x27;", "&mdash;",
+            "&hellip;", "&copy;", "&euro;", "&#8217;", "&#x1F600;", "&frac12;", "&rarr;"]
+
+
+def words(rng, count):
+    return " ".join(rng.choice(WORDS) for _ in range(count))
+
+
+def sentence(rng, minimum=6, maximum=20):
+    text = words(rng, rng.randint(minimum, maximum))
+    return text[0].upper() + text[1:] + rng.choice([".", ".", ".", "?", "!"])
+
+
+def link(rng, text=None):
+    host = rng.choice(["www.reddit.com", "en.wikipedia.org", "github.com", "i.imgur.com", "youtu.be"])
+    path = "/".join(rng.choice(WORDS) for _ in range(rng.randint(1, 4)))
+    query = "?v=%d&amp;t=%ds" % (rng.randint(1, 99999), rng.randint(1, 600)) if rng.random() < 0.3 else ""
+    return '<a href="https://%s/%s%s">%s</a>' % (host, path, query, text or words(rng, rng.randint(1, 4)))
+
+
+def inline(rng, text):
+    # Sprinkle some inline formatting over the words of a paragraph
+    out = []
+    for word in text.split(" "):
+        roll = rng.random()
+        if roll < 0.04:
+            out.append("<strong>%s</strong>" % word)
+        elif roll < 0.07:
+            out.append("<em>%s</em>" % word)
+        elif roll < 0.08:
+            out.append("<del>%s</del>" % word)
+        elif roll < 0.09:
+            out.append("<code>%s</code>" % word)
+        elif roll < 0.095:
+            out.append("x<sup>%s</sup>" % word)
+        else:
+            out.append(word)
+    return " ".join(out)
+
+
+def paragraph(rng, sentences):
+    return "<p>%s</p>" % inline(rng, " ".join(sentence(rng) for _ in range(sentences)))
+
+
+def wrap(blocks):
+    return '<div class="md">' + "\n\n".join(blocks) + "\n</div>"
+
+
+def blockquote(inner):
+    return "<blockquote>\n" + inner + "\n</blockquote>"
+
+
+def bullet_list(rng, items, ordered=False):
+    tag = "ol" if ordered else "ul"
+    return "<%s>\n%s\n</%s>" % (tag, "\n".join("<li>%s</li>" % inline(rng, sentence(rng, 3, 10)) for _ in range(items)), tag)
+
+
+def short_comment(rng):
+    blocks = [paragraph(rng, rng.randint(1, 3))]
+    if rng.random() < 0.3:
+        blocks.insert(0, blockquote(paragraph(rng, 1)))
+    if rng.random() < 0.2:
+        blocks.append("<p>%s</p>" % link(rng))
+    return wrap(blocks)
+
+
+def long_selfpost(rng):
+    blocks = []
+    for section in range(rng.randint(6, 10)):
+        blocks.append("<h%d>%s</h%d>" % (rng.randint(1, 3), words(rng, 4), rng.randint(1, 3)))
+        for _ in range(rng.randint(3, 6)):
+            roll = rng.random()
+            if roll < 0.15:
+                blocks.append(bullet_list(rng, rng.randint(3, 8), ordered=rng.random() < 0.5))
+            elif roll < 0.25:
+                blocks.append(blockquote(paragraph(rng, rng.randint(1, 3))))
+            elif roll < 0.3:
+                blocks.append("<pre><code>%s\n</code></pre>" % "\n".join("    " + words(rng, 6) + ";" for _ in range(rng.randint(3, 12))))
+            elif roll < 0.33:
+                blocks.append("<hr/>")
+            else:
+                blocks.append(paragraph(rng, rng.randint(3, 8)))
+    return wrap(blocks)
+
+
+def deep_quotes(rng):
+    depth = rng.randint(3, 10)
+    inner = paragraph(rng, rng.randint(1, 3))
+    for level in range(depth):
+        inner = blockquote(inner + ("\n\n" + paragraph(rng, 1) if rng.random() < 0.5 else ""))
+    return wrap([inner, paragraph(rng, 2)])
+
+
+def link_heavy(rng):
+    blocks = []
+    for _ in range(rng.randint(2, 6)):
+        parts = []
+        for _ in range(rng.randint(3, 10)):
+            parts.append(words(rng, rng.randint(1, 5)))
+            parts.append(link(rng))
+        blocks.append("<p>%s</p>" % " ".join(parts))
+    if rng.random() < 0.5:
+        blocks.append("<ul>\n%s\n</ul>" % "\n".join("<li>%s</li>" % link(rng) for _ in range(rng.randint(3, 10))))
+    return wrap(blocks)
+
+
+def entity_heavy(rng):
+    blocks = []
+    for _ in range(rng.randint(2, 5)):
+        parts = []
+        for _ in range(rng.randint(10, 40)):
+            parts.append(rng.choice(WORDS))
+            if rng.random() < 0.5:
+                parts.append(rng.choice(ENTITIES))
+        blocks.append("<p>%s</p>" % " ".join(parts))
+    if rng.random() < 0.5:
+        blocks.append("<pre><code>if (a &lt; b &amp;&amp; c &gt; d) {\n    printf(&quot;%d&quot;, a);\n}\n</code></pre>")
+    return wrap(blocks)
+
+
+def emoji_heavy(rng):
+    blocks = []
+    for _ in range(rng.randint(1, 4)):
+        parts = []
+        for _ in range(rng.randint(8, 30)):
+            roll = rng.random()
+            if roll < 0.35:
+                parts.append(rng.choice(EMOJI) * rng.randint(1, 3))
+            elif roll < 0.5:
+                start = rng.randint(0, len(CJK) - 4)
+                parts.append(CJK[start:start + rng.randint(2, 4)])
+            elif roll < 0.55:
+                parts.append("café naïve résumé")
+            else:
+                parts.append(rng.choice(WORDS))
+        blocks.append("<p>%s</p>" % inline(rng, " ".join(parts)))
+    return wrap(blocks)
+
+
+CASES = [
+    ("short_comments", short_comment, 400),
+    ("long_selfposts", long_selfpost, 8),
+    ("deep_quotes", deep_quotes, 60),
+    ("link_heavy", link_heavy, 80),
+    ("entity_heavy", entity_heavy, 80),
+    ("emoji_heavy", emoji_heavy, 120),
+]
+
+
+def main():
+    directory = os.path.join(os.path.dirname(os.path.abspath(__file__)), "corpus")
+    os.makedirs(directory, exist_ok=True)
+    for name, generator, count in CASES:
+        rng = random.Random(name)
+        documents = [generator(rng) for _ in range(count)]
+        with open(os.path.join(directory, name + ".html"), "w", encoding="utf-8", newline="\n") as output:
+            output.write(("\n" + DOCUMENT_SEPARATOR + "\n").join(documents) + "\n")
+
+
+if __name__ == "__main__":
+    main()
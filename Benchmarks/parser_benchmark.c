@@ -0,0 +1,691 @@
+//
+//  parser_benchmark.c
+//  HTMLFastParse
+//
+//  Benchmarks each stage of the parser (tokenizeHTML, makeAttributesLinear, decode_html_entities_utf8), the legacy
+//  whole document pipeline, the reusable parser context (copying and in place), incremental edits, layout height estimates and parse cache hits over the checked in corpus and a few synthetic documents.
+//
+//  usage: parser_benchmark [--corpus directory] [--filter text] [--min-time seconds]
+//                          [--baseline file] [--save-baseline file]
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdint.h>
+#include <dirent.h>
+
+#include "C_HTML_Parser.h"
+#include "BatchParse.h"
+#include "ParseCache.h"
+#include "IncrementalParse.h"
+#include "LayoutEstimate.h"
+#include "entities.h"
+#include "AllocationCounter.h"
+
+#define DOCUMENT_SEPARATOR "\n<!-- document -->\n"
+#define MAXIMUM_CASES 64
+#define MAXIMUM_RESULTS 512
+
+/**
+ A named set of documents which are benchmarked together
+ */
+struct t_benchmark_case {
+	char name[64];
+	char *storage;
+	struct t_document *documents;
+	int numberOfDocuments;
+	size_t totalBytes;
+	size_t largestDocument;
+};
+
+struct t_benchmark_result {
+	char caseName[64];
+	char benchmarkName[32];
+	double megabytesPerSecond;
+	double nanosecondsPerDocument;
+	double allocationsPerDocument;
+};
+
+static double now(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/* Cases */
+
+/**
+ Split a corpus file into its documents. The documents point into storage, which is null terminated between documents
+ */
+static void splitDocuments(struct t_benchmark_case *benchmarkCase, char *storage, size_t length) {
+	benchmarkCase->storage = storage;
+	int capacity = 16;
+	benchmarkCase->documents = malloc(capacity * sizeof(struct t_document));
+	benchmarkCase->numberOfDocuments = 0;
+	benchmarkCase->totalBytes = 0;
+	benchmarkCase->largestDocument = 0;
+
+	size_t separatorLength = strlen(DOCUMENT_SEPARATOR);
+	char *position = storage;
+	char *end = storage + length;
+	while (position < end) {
+		char *separator = strstr(position, DOCUMENT_SEPARATOR);
+		char *documentEnd = separator != NULL ? separator : end;
+		if (benchmarkCase->numberOfDocuments == capacity) {
+			capacity *= 2;
+			benchmarkCase->documents = realloc(benchmarkCase->documents, capacity * sizeof(struct t_document));
+		}
+		struct t_document *document = &benchmarkCase->documents[benchmarkCase->numberOfDocuments++];
+		document->html = position;
+		document->length = documentEnd - position;
+		*documentEnd = 0x00;
+		benchmarkCase->totalBytes += document->length;
+		if (document->length > benchmarkCase->largestDocument) {
+			benchmarkCase->largestDocument = document->length;
+		}
+		position = separator != NULL ? separator + separatorLength : end;
+	}
+}
+
+static int loadCorpusFile(struct t_benchmark_case *benchmarkCase, const char *directory, const char *fileName) {
+	char path[1024];
+	snprintf(path, sizeof(path), "%s/%s", directory, fileName);
+	FILE *file = fopen(path, "rb");
+	if (file == NULL) {
+		return 0;
+	}
+	fseek(file, 0, SEEK_END);
+	long length = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	char *storage = malloc(length + 1);
+	if (fread(storage, 1, length, file) != (size_t)length) {
+		fclose(file);
+		free(storage);
+		return 0;
+	}
+	fclose(file);
+	storage[length] = 0x00;
+
+	snprintf(benchmarkCase->name, sizeof(benchmarkCase->name), "%.*s", (int)(strlen(fileName) - strlen(".html")), fileName);
+	splitDocuments(benchmarkCase, storage, length);
+	return 1;
+}
+
+static int compareCaseNames(const void *a, const void *b) {
+	return strcmp(((const struct t_benchmark_case *)a)->name, ((const struct t_benchmark_case *)b)->name);
+}
+
+static int loadCorpus(struct t_benchmark_case cases[], const char *directory) {
+	DIR *corpus = opendir(directory);
+	if (corpus == NULL) {
+		fprintf(stderr, "Can't open corpus directory %s\n", directory);
+		return 0;
+	}
+	int numberOfCases = 0;
+	struct dirent *entry;
+	while ((entry = readdir(corpus)) != NULL && numberOfCases < MAXIMUM_CASES) {
+		size_t nameLength = strlen(entry->d_name);
+		if (nameLength > 5 && strcmp(&entry->d_name[nameLength - 5], ".html") == 0) {
+			numberOfCases += loadCorpusFile(&cases[numberOfCases], directory, entry->d_name);
+		}
+	}
+	closedir(corpus);
+	qsort(cases, numberOfCases, sizeof(struct t_benchmark_case), compareCaseNames);
+	return numberOfCases;
+}
+
+/* Synthetic generators */
+
+/**
+ A growable string for the generators
+ */
+struct t_builder {
+	char *text;
+	size_t length;
+	size_t capacity;
+	unsigned int random;
+};
+
+static void append(struct t_builder *builder, const char *text) {
+	size_t length = strlen(text);
+	if (builder->length + length + 1 > builder->capacity) {
+		builder->capacity = (builder->length + length + 1) * 2;
+		builder->text = realloc(builder->text, builder->capacity);
+	}
+	memcpy(&builder->text[builder->length], text, length + 1);
+	builder->length += length;
+}
+
+static unsigned int nextRandom(struct t_builder *builder) {
+	builder->random = builder->random * 1103515245 + 12345;
+	return (builder->random >> 16) & 0x7fff;
+}
+
+static const char *syntheticWords[] = {"lorem", "ipsum", "dolor", "sit", "amet", "parser", "thread", "comment", "a", "of", "the"};
+
+static void appendWords(struct t_builder *builder, int count) {
+	for (int i = 0; i < count; i++) {
+		append(builder, syntheticWords[nextRandom(builder) % (sizeof(syntheticWords) / sizeof(syntheticWords[0]))]);
+		append(builder, " ");
+	}
+}
+
+//A single large document of plain paragraphs, the best case for bulk text scanning
+static void generatePlainText(struct t_builder *builder, size_t size) {
+	size_t end = builder->length + size;
+	append(builder, "<div class=\"md\">");
+	while (builder->length < end) {
+		append(builder, "<p>");
+		appendWords(builder, 80);
+		append(builder, "</p>\n\n");
+	}
+	append(builder, "</div>");
+}
+
+//Formatting nested thousands of levels deep
+static void generateDeepNesting(struct t_builder *builder, size_t size) {
+	static const char *open[] = {"<blockquote>", "<strong>", "<em>", "<sup>", "<ul><li>"};
+	static const char *close[] = {"</blockquote>", "</strong>", "</em>", "</sup>", "</li></ul>"};
+	size_t end = builder->length + size / 2;
+	int depth = 0;
+	int kinds[4096];
+	while (builder->length < end && depth < 4096) {
+		kinds[depth] = nextRandom(builder) % 5;
+		append(builder, open[kinds[depth]]);
+		appendWords(builder, 2);
+		depth++;
+	}
+	while (depth > 0) {
+		depth--;
+		append(builder, close[kinds[depth]]);
+	}
+}
+
+//Lots of tiny, sometimes broken, tags
+static void generateTagSoup(struct t_builder *builder, size_t size) {
+	static const char *tags[] = {"<strong>", "</strong>", "<em>", "</em>", "<a href=\"https://example.com/x\">", "</a>", "<br/>", "<hr/>", "<p>", "</p>", "<code>", "</code>", "<unknown>", "</unknown>", "<", ">", "</>", "<li>", "</li>"};
+	size_t end = builder->length + size;
+	while (builder->length < end) {
+		append(builder, tags[nextRandom(builder) % (sizeof(tags) / sizeof(tags[0]))]);
+		if (nextRandom(builder) % 2) {
+			appendWords(builder, 1);
+		}
+	}
+}
+
+//Text which is mostly entity references
+static void generateEntities(struct t_builder *builder, size_t size) {
+	static const char *entities[] = {"&amp;", "&lt;", "&gt;", "&quot;", "&#39;", "&#x27;", "&nbsp;", "&mdash;", "&hellip;", "&CounterClockwiseContourIntegral;", "&#128512;", "&notanentity;", "& "};
+	size_t end = builder->length + size;
+	append(builder, "<p>");
+	while (builder->length < end) {
+		append(builder, entities[nextRandom(builder) % (sizeof(entities) / sizeof(entities[0]))]);
+		if (nextRandom(builder) % 3 == 0) {
+			appendWords(builder, 1);
+		}
+	}
+	append(builder, "</p>");
+}
+
+static void addSyntheticCase(struct t_benchmark_case *benchmarkCase, const char *name, void (*generator)(struct t_builder *, size_t), size_t size, int numberOfDocuments) {
+	snprintf(benchmarkCase->name, sizeof(benchmarkCase->name), "%.63s", name);
+	struct t_builder builder = {NULL, 0, 0, 42};
+	for (int i = 0; i < numberOfDocuments; i++) {
+		if (i > 0) {
+			append(&builder, DOCUMENT_SEPARATOR);
+		}
+		generator(&builder, size);
+	}
+	splitDocuments(benchmarkCase, builder.text, builder.length);
+}
+
+static int addSyntheticCases(struct t_benchmark_case cases[]) {
+	addSyntheticCase(&cases[0], "synthetic_plain_text", generatePlainText, 1024 * 1024, 1);
+	addSyntheticCase(&cases[1], "synthetic_deep_nesting", generateDeepNesting, 64 * 1024, 4);
+	addSyntheticCase(&cases[2], "synthetic_tag_soup", generateTagSoup, 16 * 1024, 16);
+	addSyntheticCase(&cases[3], "synthetic_entities", generateEntities, 16 * 1024, 16);
+	return 4;
+}
+
+/* Benchmarks */
+
+/**
+ Scratch shared by the benchmarks, sized for the largest document of a case so that the harness itself allocates nothing while being measured
+ */
+struct t_benchmark_scratch {
+	char *displayText;
+	char *decodedText;
+	struct t_tag **tags;
+	int *numberOfTags;
+	int *numberOfVisibleCharachters;
+	struct t_format *formats;
+	struct t_parser_context *context;
+	//Builds the UTF-16 offset index as well
+	struct t_parser_context *indexingContext;
+	//Parses with the generic HTML dialect
+	struct t_parser_context *genericContext;
+	//Holds every document of the case
+	struct t_parse_cache *cache;
+	//Made up but plausible system font metrics for estimating heights
+	struct t_layout_metrics layoutMetrics;
+};
+
+static void freeTagLinks(struct t_tag tags[], int numberOfTags) {
+	for (int i = 0; i < numberOfTags; i++) {
+		free(tags[i].linkURL);
+		tags[i].linkURL = NULL;
+	}
+}
+
+/**
+ One pass of a benchmark over every document in a case
+
+ @return The time spent in the code being measured
+ */
+typedef double (*t_benchmark_pass)(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch);
+
+static double tokenizePass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double elapsed = 0;
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		struct t_document *document = &benchmarkCase->documents[d];
+		double start = now();
+		tokenizeHTML((char *)document->html, document->length, scratch->displayText, scratch->tags[0], &scratch->numberOfTags[0], &scratch->numberOfVisibleCharachters[0]);
+		elapsed += now() - start;
+		pauseAllocationCounting();
+		freeTagLinks(scratch->tags[0], scratch->numberOfTags[0]);
+		resumeAllocationCounting();
+	}
+	return elapsed;
+}
+
+static double linearizePass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	//Tokenize everything up front (unmeasured) since makeAttributesLinear consumes its input
+	pauseAllocationCounting();
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		struct t_document *document = &benchmarkCase->documents[d];
+		tokenizeHTML((char *)document->html, document->length, scratch->displayText, scratch->tags[d], &scratch->numberOfTags[d], &scratch->numberOfVisibleCharachters[d]);
+	}
+	resumeAllocationCounting();
+
+	double elapsed = 0;
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		int numberOfFormats = 0;
+		struct t_link_table links = {0};
+		double start = now();
+		makeAttributesLinear(scratch->tags[d], scratch->numberOfTags[d], scratch->formats, &numberOfFormats, scratch->numberOfVisibleCharachters[d], &links);
+		elapsed += now() - start;
+		pauseAllocationCounting();
+		freeLinkTable(&links, NULL);
+		resumeAllocationCounting();
+	}
+	return elapsed;
+}
+
+static double entitiesPass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double start = now();
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		decode_html_entities_utf8(scratch->decodedText, benchmarkCase->documents[d].html);
+	}
+	return now() - start;
+}
+
+/**
+ The whole legacy pipeline the way a caller of the flat array API runs it, including allocating its outputs
+ */
+static double pipelinePass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double start = now();
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		struct t_document *document = &benchmarkCase->documents[d];
+		char *displayText = malloc(document->length + 1);
+		struct t_tag *tags = malloc((maximumNumberOfTags(document->html, document->length) + 1) * sizeof(struct t_tag));
+		int numberOfTags = 0;
+		int numberOfVisibleCharachters = 0;
+		tokenizeHTML((char *)document->html, document->length, displayText, tags, &numberOfTags, &numberOfVisibleCharachters);
+
+		struct t_format *formats = malloc(maximumNumberOfLinearFormats(numberOfTags, numberOfVisibleCharachters) * sizeof(struct t_format));
+		int numberOfFormats = 0;
+		struct t_link_table links = {0};
+		makeAttributesLinear(tags, numberOfTags, formats, &numberOfFormats, numberOfVisibleCharachters, &links);
+
+		freeLinkTable(&links, NULL);
+		free(formats);
+		free(tags);
+		free(displayText);
+	}
+	return now() - start;
+}
+
+static double contextPass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double start = now();
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		struct t_parsed_document parsed;
+		parseHTMLWithContext(scratch->context, benchmarkCase->documents[d].html, benchmarkCase->documents[d].length, &parsed);
+	}
+	return now() - start;
+}
+
+static double inPlacePass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double elapsed = 0;
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		struct t_document *document = &benchmarkCase->documents[d];
+		//The parse destroys its input, so it gets a fresh copy each time
+		memcpy(scratch->displayText, document->html, document->length);
+		struct t_parsed_document parsed;
+		double start = now();
+		parseHTMLInPlaceWithContext(scratch->context, scratch->displayText, document->length, &parsed);
+		elapsed += now() - start;
+	}
+	return elapsed;
+}
+
+static double contextIndexPass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double start = now();
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		struct t_parsed_document parsed;
+		parseHTMLWithContext(scratch->indexingContext, benchmarkCase->documents[d].html, benchmarkCase->documents[d].length, &parsed);
+	}
+	return now() - start;
+}
+
+static double contextGenericPass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double start = now();
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		struct t_parsed_document parsed;
+		parseHTMLWithContext(scratch->genericContext, benchmarkCase->documents[d].html, benchmarkCase->documents[d].length, &parsed);
+	}
+	return now() - start;
+}
+
+/**
+ The first couple of hundred charachters of each document, the way a collapsed comment is shown
+ */
+static double previewPass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double start = now();
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		struct t_parsed_document parsed;
+		parsePreviewWithContext(scratch->context, benchmarkCase->documents[d].html, benchmarkCase->documents[d].length, PREVIEW_BUDGET_VISIBLE, 200, &parsed);
+	}
+	return now() - start;
+}
+
+/**
+ A keystroke in the middle of each document and its undo, the way a live preview reparses. Building the incremental document isn't measured
+ */
+static double incrementalEditPass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double elapsed = 0;
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		struct t_document *document = &benchmarkCase->documents[d];
+		struct t_parsed_document parsed;
+		pauseAllocationCounting();
+		struct t_incremental_document *incrementalDocument = createIncrementalDocument(document->html, document->length, HTML_DIALECT_REDDIT, &parsed);
+		resumeAllocationCounting();
+		double start = now();
+		editIncrementalDocument(incrementalDocument, document->length / 2, 0, "x", 1, &parsed);
+		editIncrementalDocument(incrementalDocument, document->length / 2, 1, NULL, 0, &parsed);
+		elapsed += now() - start;
+		pauseAllocationCounting();
+		freeIncrementalDocument(incrementalDocument);
+		resumeAllocationCounting();
+	}
+	return elapsed;
+}
+
+/**
+ Estimating the height of each (already parsed) document in a phone sized label
+ */
+static double layoutEstimatePass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double elapsed = 0;
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		const struct t_parsed_document *parsed = acquireParsedHTML(scratch->cache, benchmarkCase->documents[d].html, benchmarkCase->documents[d].length);
+		struct t_layout_estimate estimate;
+		double start = now();
+		estimateLayout(parsed->displayText, parsed->displayTextLength, parsed->formats, parsed->numberOfFormats, &scratch->layoutMetrics, 375, &estimate);
+		elapsed += now() - start;
+		releaseParsedHTML(parsed);
+	}
+	return elapsed;
+}
+
+static double cacheHitPass(struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch) {
+	double start = now();
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		const struct t_parsed_document *parsed = acquireParsedHTML(scratch->cache, benchmarkCase->documents[d].html, benchmarkCase->documents[d].length);
+		releaseParsedHTML(parsed);
+	}
+	return now() - start;
+}
+
+struct t_benchmark {
+	const char *name;
+	t_benchmark_pass pass;
+};
+
+static const struct t_benchmark benchmarks[] = {
+	{"tokenize", tokenizePass},
+	{"linearize", linearizePass},
+	{"entities", entitiesPass},
+	{"pipeline", pipelinePass},
+	{"context", contextPass},
+	{"in_place", inPlacePass},
+	{"context_index", contextIndexPass},
+	{"context_generic", contextGenericPass},
+	{"preview", previewPass},
+	{"incremental_edit", incrementalEditPass},
+	{"layout_estimate", layoutEstimatePass},
+	{"cache_hit", cacheHitPass},
+};
+
+static void prepareLayoutMetrics(struct t_layout_metrics *metrics) {
+	for (int face = 0; face < LAYOUT_FACE_COUNT; face++) {
+		struct t_font_metrics *fontMetrics = &metrics->faces[face];
+		bool isMonospaced = face == LAYOUT_FACE_CODE;
+		bool isBold = face == LAYOUT_FACE_BOLD || face == LAYOUT_FACE_BOLD_ITALICS;
+		for (int charachter = 0; charachter < 128; charachter++) {
+			float advance = isMonospaced ? 0.6 : charachter == ' ' ? 0.25 : (charachter >= 'A' && charachter <= 'Z') ? 0.65 : 0.52;
+			fontMetrics->asciiAdvances[charachter] = isBold ? advance * 1.08 : advance;
+		}
+		fontMetrics->otherAdvance = isMonospaced ? 0.6 : 0.55;
+		fontMetrics->wideAdvance = 1;
+		fontMetrics->ascent = 0.95;
+		fontMetrics->descent = 0.24;
+		fontMetrics->leading = 0;
+	}
+	metrics->baseFontSize = 17;
+	metrics->quotePadding = 20;
+	metrics->paragraphSpacing = 17 * 1.19 / 4;
+}
+
+static void prepareScratch(struct t_benchmark_scratch *scratch, struct t_benchmark_case *benchmarkCase) {
+	size_t largest = benchmarkCase->largestDocument + 1;
+	scratch->displayText = malloc(largest);
+	scratch->decodedText = malloc(largest);
+	scratch->formats = malloc(largest * sizeof(struct t_format));
+	scratch->tags = malloc(benchmarkCase->numberOfDocuments * sizeof(struct t_tag *));
+	scratch->numberOfTags = malloc(benchmarkCase->numberOfDocuments * sizeof(int));
+	scratch->numberOfVisibleCharachters = malloc(benchmarkCase->numberOfDocuments * sizeof(int));
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		struct t_document *document = &benchmarkCase->documents[d];
+		scratch->tags[d] = malloc((maximumNumberOfTags(document->html, document->length) + 1) * sizeof(struct t_tag));
+	}
+	//The first document doubles as scratch for tokenizePass, which runs over every document
+	free(scratch->tags[0]);
+	scratch->tags[0] = malloc(largest * sizeof(struct t_tag));
+	scratch->context = createParserContext();
+	scratch->indexingContext = createParserContext();
+	setParserContextBuildsUTF16Index(scratch->indexingContext, true);
+	scratch->genericContext = createParserContext();
+	setParserContextDialect(scratch->genericContext, HTML_DIALECT_GENERIC);
+	
+	//Big enough that nothing is ever evicted
+	scratch->cache = createParseCache(SIZE_MAX);
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		releaseParsedHTML(acquireParsedHTML(scratch->cache, benchmarkCase->documents[d].html, benchmarkCase->documents[d].length));
+	}
+	prepareLayoutMetrics(&scratch->layoutMetrics);
+}
+
+static void releaseScratch(struct t_benchmark_scratch *scratch, struct t_benchmark_case *benchmarkCase) {
+	for (int d = 0; d < benchmarkCase->numberOfDocuments; d++) {
+		free(scratch->tags[d]);
+	}
+	freeParserContext(scratch->context);
+	freeParserContext(scratch->indexingContext);
+	freeParserContext(scratch->genericContext);
+	freeParseCache(scratch->cache);
+	free(scratch->numberOfVisibleCharachters);
+	free(scratch->numberOfTags);
+	free(scratch->tags);
+	free(scratch->formats);
+	free(scratch->decodedText);
+	free(scratch->displayText);
+}
+
+/**
+ Run a benchmark until at least minimumTime has been measured (or it's taken far longer than that because most of each pass is setup), keeping the fastest pass
+ */
+static struct t_benchmark_result runBenchmark(const struct t_benchmark *benchmark, struct t_benchmark_case *benchmarkCase, struct t_benchmark_scratch *scratch, double minimumTime) {
+	//Warm up (and let the parser context grow to size) before counting anything
+	benchmark->pass(benchmarkCase, scratch);
+
+	resetAllocationCount();
+	double best = benchmark->pass(benchmarkCase, scratch);
+	long allocations = allocationCount();
+	double total = best;
+	int passes = 1;
+	double deadline = now() + minimumTime * 4;
+	while (passes < 3 || (total < minimumTime && now() < deadline)) {
+		double elapsed = benchmark->pass(benchmarkCase, scratch);
+		total += elapsed;
+		passes++;
+		if (elapsed < best) {
+			best = elapsed;
+		}
+	}
+
+	struct t_benchmark_result result;
+	snprintf(result.caseName, sizeof(result.caseName), "%.63s", benchmarkCase->name);
+	snprintf(result.benchmarkName, sizeof(result.benchmarkName), "%.31s", benchmark->name);
+	result.megabytesPerSecond = benchmarkCase->totalBytes / 1e6 / best;
+	result.nanosecondsPerDocument = best * 1e9 / benchmarkCase->numberOfDocuments;
+	result.allocationsPerDocument = (double)allocations / benchmarkCase->numberOfDocuments;
+	return result;
+}
+
+/* Baselines */
+
+static int loadBaseline(const char *path, struct t_benchmark_result results[]) {
+	FILE *file = fopen(path, "r");
+	if (file == NULL) {
+		fprintf(stderr, "Can't open baseline %s\n", path);
+		return 0;
+	}
+	int numberOfResults = 0;
+	char line[512];
+	while (fgets(line, sizeof(line), file) != NULL && numberOfResults < MAXIMUM_RESULTS) {
+		struct t_benchmark_result *result = &results[numberOfResults];
+		if (line[0] != '#' && sscanf(line, "%63s %31s %lf %lf %lf", result->caseName, result->benchmarkName, &result->megabytesPerSecond, &result->nanosecondsPerDocument, &result->allocationsPerDocument) == 5) {
+			numberOfResults++;
+		}
+	}
+	fclose(file);
+	return numberOfResults;
+}
+
+static void saveBaseline(const char *path, struct t_benchmark_result results[], int numberOfResults) {
+	FILE *file = fopen(path, "w");
+	if (file == NULL) {
+		fprintf(stderr, "Can't write baseline %s\n", path);
+		return;
+	}
+	fprintf(file, "# case\tbenchmark\tMB/s\tns/doc\tallocs/doc\n");
+	for (int i = 0; i < numberOfResults; i++) {
+		fprintf(file, "%s\t%s\t%.2f\t%.1f\t%.2f\n", results[i].caseName, results[i].benchmarkName, results[i].megabytesPerSecond, results[i].nanosecondsPerDocument, results[i].allocationsPerDocument);
+	}
+	fclose(file);
+}
+
+static const struct t_benchmark_result* findResult(const struct t_benchmark_result results[], int numberOfResults, const struct t_benchmark_result *like) {
+	for (int i = 0; i < numberOfResults; i++) {
+		if (strcmp(results[i].caseName, like->caseName) == 0 && strcmp(results[i].benchmarkName, like->benchmarkName) == 0) {
+			return &results[i];
+		}
+	}
+	return NULL;
+}
+
+static void printResult(const struct t_benchmark_result *result, const struct t_benchmark_result *baseline) {
+	printf("%-24s %-16s %10.1f %12.0f %11.2f", result->caseName, result->benchmarkName, result->megabytesPerSecond, result->nanosecondsPerDocument, result->allocationsPerDocument);
+	if (baseline != NULL) {
+		//Positive is faster than the baseline
+		double speedup = (baseline->nanosecondsPerDocument / result->nanosecondsPerDocument - 1) * 100;
+		printf(" %+9.1f%% %+11.2f", speedup, result->allocationsPerDocument - baseline->allocationsPerDocument);
+	}
+	printf("\n");
+}
+
+int main(int argc, const char *argv[]) {
+	const char *corpusDirectory = "corpus";
+	const char *filter = NULL;
+	const char *baselinePath = NULL;
+	const char *saveBaselinePath = NULL;
+	double minimumTime = 0.2;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--corpus") == 0 && i + 1 < argc) {
+			corpusDirectory = argv[++i];
+		}else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+			filter = argv[++i];
+		}else if (strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+			minimumTime = atof(argv[++i]);
+		}else if (strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+			baselinePath = argv[++i];
+		}else if (strcmp(argv[i], "--save-baseline") == 0 && i + 1 < argc) {
+			saveBaselinePath = argv[++i];
+		}else {
+			fprintf(stderr, "usage: %s [--corpus directory] [--filter text] [--min-time seconds] [--baseline file] [--save-baseline file]\n", argv[0]);
+			return 1;
+		}
+	}
+
+	static struct t_benchmark_case cases[MAXIMUM_CASES];
+	int numberOfCases = loadCorpus(cases, corpusDirectory);
+	numberOfCases += addSyntheticCases(&cases[numberOfCases]);
+
+	static struct t_benchmark_result baseline[MAXIMUM_RESULTS];
+	int numberOfBaselineResults = baselinePath != NULL ? loadBaseline(baselinePath, baseline) : 0;
+	static struct t_benchmark_result results[MAXIMUM_RESULTS];
+	int numberOfResults = 0;
+
+	printf("%-24s %-16s %10s %12s %11s", "case", "benchmark", "MB/s", "ns/doc", "allocs/doc");
+	if (baselinePath != NULL) {
+		printf(" %10s %11s", "vs base", "allocs");
+	}
+	printf("\n");
+
+	for (int c = 0; c < numberOfCases; c++) {
+		struct t_benchmark_case *benchmarkCase = &cases[c];
+		struct t_benchmark_scratch scratch;
+		prepareScratch(&scratch, benchmarkCase);
+		for (size_t b = 0; b < sizeof(benchmarks) / sizeof(benchmarks[0]); b++) {
+			char fullName[128];
+			snprintf(fullName, sizeof(fullName), "%.63s/%.31s", benchmarkCase->name, benchmarks[b].name);
+			if (filter != NULL && strstr(fullName, filter) == NULL) {
+				continue;
+			}
+			struct t_benchmark_result result = runBenchmark(&benchmarks[b], benchmarkCase, &scratch, minimumTime);
+			printResult(&result, baselinePath != NULL ? findResult(baseline, numberOfBaselineResults, &result) : NULL);
+			if (numberOfResults < MAXIMUM_RESULTS) {
+				results[numberOfResults++] = result;
+			}
+		}
+		releaseScratch(&scratch, benchmarkCase);
+		free(benchmarkCase->documents);
+		free(benchmarkCase->storage);
+	}
+
+	if (saveBaselinePath != NULL) {
+		saveBaseline(saveBaselinePath, results, numberOfResults);
+	}
+	return 0;
+}
@@ -0,0 +1,156 @@
+//
+//  parser_check.c
+//  HTMLFastParse
+//
+//  Regression checks for malformed input the parser has got wrong before. Built with AddressSanitizer by `make check`, so a case
+//  overrunning a buffer sized the way the headers say to size it fails loudly rather than just giving different output.
+//
+//  usage: parser_check
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "C_HTML_Parser.h"
+#include "IncrementalParse.h"
+
+static int numberOfFailures = 0;
+
+static void fail(const char *checkName, const char *html, const char *reason) {
+	printf("FAIL %s: %s\n  %s\n", checkName, reason, html);
+	numberOfFailures++;
+}
+
+/* Misnested tags */
+
+/**
+ Tokenize into flat arrays sized by maximumNumberOfTags, with nothing to spare so AddressSanitizer catches any tag written past the bound
+ */
+static void checkTagBound(const char *checkName, const char *html) {
+	size_t length = strlen(html);
+	int bound = maximumNumberOfTags(html, length);
+	char *input = malloc(length + 1);
+	memcpy(input, html, length + 1);
+	char *displayText = malloc(length + 1);
+	struct t_tag *tags = malloc((bound > 0 ? bound : 1) * sizeof(struct t_tag));
+	struct t_block *blocks = malloc((bound > 0 ? bound : 1) * sizeof(struct t_block));
+	int numberOfTags = 0;
+	int numberOfVisibleCharachters = 0;
+	int numberOfBlocks = 0;
+	tokenizeHTMLWithBlocks(input, length, displayText, tags, &numberOfTags, &numberOfVisibleCharachters, blocks, &numberOfBlocks);
+	if (numberOfTags > bound || numberOfBlocks > bound) {
+		fail(checkName, html, "more tags than maximumNumberOfTags");
+	}
+	
+	for (int i = 0; i < numberOfTags; i++) {
+		free(tags[i].linkURL);
+	}
+	free(blocks);
+	free(tags);
+	free(displayText);
+	free(input);
+}
+
+/**
+ Append the same piece of HTML to itself until it's count copies long
+ */
+static char* repeatHTML(const char *piece, int count) {
+	size_t pieceLength = strlen(piece);
+	char *html = malloc(pieceLength * count + 1);
+	for (int i = 0; i < count; i++) {
+		memcpy(&html[pieceLength * i], piece, pieceLength);
+	}
+	html[pieceLength * count] = 0x00;
+	return html;
+}
+
+static void checkMisnestedTags(void) {
+	checkTagBound("misnested inline styles", "<em><strong><sup><code>x</em>y</strong>z</sup>w</code>v");
+	checkTagBound("misnested link", "<p><strong><a href=\"http://x.com\">a<em>b</strong>c</a>d</em></p>");
+	checkTagBound("misnested blocks", "<blockquote><ul><li><strong>a<p>b</ul>c</strong></blockquote>");
+	checkTagBound("unmatched closing tags", "</em></strong><em>a</sup></p>b</em>");
+	
+	//Every closing tag here closes more inline styles than can be reopened
+	char *soup = repeatHTML("<em><strong><sup><code><del><a href=\"x\">x</em>", 256);
+	checkTagBound("repeated misnesting", soup);
+	free(soup);
+	char *deepSoup = repeatHTML("<strong><em>", 2048);
+	char *deepSoupClosed = malloc(strlen(deepSoup) + 32);
+	sprintf(deepSoupClosed, "%s</strong>x</em>", deepSoup);
+	checkTagBound("misnesting past the depth limit", deepSoupClosed);
+	free(deepSoupClosed);
+	free(deepSoup);
+}
+
+/* Incremental edits */
+
+/**
+ Find the style of the charachter at a visible position, with the link split out as its URL since link IDs differ between documents
+ */
+static uint64_t styleAtPosition(const struct t_parsed_document *document, unsigned int position, const char **linkURL) {
+	*linkURL = NULL;
+	for (int i = 0; i < document->numberOfFormats; i++) {
+		struct t_format format = document->formats[i];
+		if (format.startPosition <= position && position < format.endPosition) {
+			unsigned int linkID = formatLinkID(format);
+			if (linkID != 0) {
+				*linkURL = linkTableURL(&document->links, linkID);
+			}
+			return format.style & (((uint64_t)1 << T_FORMAT_LINK_ID_SHIFT) - 1);
+		}
+	}
+	return 0;
+}
+
+/**
+ Edit a document incrementally and check the result matches parsing the edited document from scratch
+ */
+static void checkIncrementalEdit(const char *checkName, const char *html, size_t editStart, size_t editLength, const char *replacement) {
+	struct t_parsed_document incremental;
+	struct t_incremental_document *document = createIncrementalDocument(html, strlen(html), HTML_DIALECT_REDDIT, &incremental);
+	editIncrementalDocument(document, editStart, editLength, replacement, strlen(replacement), &incremental);
+	
+	size_t editedLength = 0;
+	const char *edited = incrementalDocumentHTML(document, &editedLength);
+	struct t_parser_context *context = createParserContext();
+	struct t_parsed_document full;
+	parseHTMLWithContext(context, edited, editedLength, &full);
+	
+	if (incremental.displayTextLength != full.displayTextLength || memcmp(incremental.displayText, full.displayText, full.displayTextLength) != 0) {
+		fail(checkName, html, "display text differs from a full parse");
+	}else if (incremental.numberOfHumanVisibleCharachters != full.numberOfHumanVisibleCharachters || incremental.numberOfBlocks != full.numberOfBlocks) {
+		fail(checkName, html, "visible length or blocks differ from a full parse");
+	}else {
+		for (int position = 0; position < full.numberOfHumanVisibleCharachters; position++) {
+			const char *incrementalURL;
+			const char *fullURL;
+			bool isSameStyle = styleAtPosition(&incremental, position, &incrementalURL) == styleAtPosition(&full, position, &fullURL);
+			bool isSameLink = incrementalURL == fullURL || (incrementalURL != NULL && fullURL != NULL && strcmp(incrementalURL, fullURL) == 0);
+			if (!isSameStyle || !isSameLink) {
+				fail(checkName, html, "formats differ from a full parse");
+				break;
+			}
+		}
+	}
+	
+	freeParserContext(context);
+	freeIncrementalDocument(document);
+}
+
+static void checkIncrementalEdits(void) {
+	//Resynchronising at a visible position of 0 or 1 collapses the next new line differently
+	checkIncrementalEdit("edit near the start of the text", "<div class=\"md\"><p></p><p>c\nd</p></div>", 19, 0, "x");
+}
+
+int main(int argc, char *argv[]) {
+	checkMisnestedTags();
+	checkIncrementalEdits();
+	
+	if (numberOfFailures > 0) {
+		printf("%i checks failed\n", numberOfFailures);
+		return 1;
+	}
+	printf("All checks passed\n");
+	return 0;
+}
@@ -0,0 +1,172 @@
+//
+//  Allocator.c
+//  HTMLFastParse
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "Allocator.h"
+
+static void* mallocAllocate(void *context, size_t size) {
+	return malloc(size);
+}
+
+static void* mallocReallocate(void *context, void *pointer, size_t oldSize, size_t newSize) {
+	return realloc(pointer, newSize);
+}
+
+static void mallocDeallocate(void *context, void *pointer, size_t size) {
+	free(pointer);
+}
+
+const struct t_allocator mallocAllocator = {
+	mallocAllocate,
+	mallocReallocate,
+	mallocDeallocate,
+	NULL
+};
+
+//Every allocation is aligned to this so any struct can be placed in the arena
+#define ARENA_ALIGNMENT (sizeof(max_align_t))
+
+struct t_arena_block {
+	struct t_arena_block *next;
+	size_t capacity;
+	size_t used;
+	max_align_t data[];
+};
+
+struct t_arena {
+	//Blocks of the regular size. These are kept across resets
+	struct t_arena_block *firstBlock;
+	struct t_arena_block *currentBlock;
+	//Blocks made for allocations larger than blockSize. These are released on reset
+	struct t_arena_block *oversizedBlocks;
+	size_t blockSize;
+	//The most recent allocation, which can be grown or released in place
+	void *lastAllocation;
+};
+
+static struct t_arena_block* createArenaBlock(size_t capacity) {
+	struct t_arena_block *block = malloc(sizeof(struct t_arena_block) + capacity);
+	block->next = NULL;
+	block->capacity = capacity;
+	block->used = 0;
+	return block;
+}
+
+static size_t alignedSize(size_t size) {
+	return (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+}
+
+struct t_arena* createArena(size_t blockSize) {
+	struct t_arena *arena = malloc(sizeof(struct t_arena));
+	arena->blockSize = alignedSize(blockSize > 0 ? blockSize : 1);
+	arena->firstBlock = createArenaBlock(arena->blockSize);
+	arena->currentBlock = arena->firstBlock;
+	arena->oversizedBlocks = NULL;
+	arena->lastAllocation = NULL;
+	return arena;
+}
+
+static void* arenaAllocate(void *context, size_t size) {
+	struct t_arena *arena = context;
+	size = alignedSize(size);
+	
+	//Too big to ever fit in a regular block, give it a block of its own
+	if (size > arena->blockSize) {
+		struct t_arena_block *block = createArenaBlock(size);
+		block->used = size;
+		block->next = arena->oversizedBlocks;
+		arena->oversizedBlocks = block;
+		arena->lastAllocation = NULL;
+		return block->data;
+	}
+	
+	struct t_arena_block *block = arena->currentBlock;
+	if (block->capacity - block->used < size) {
+		//Move on to the next block (reusing one from before a reset if we have it)
+		if (block->next == NULL) {
+			block->next = createArenaBlock(arena->blockSize);
+		}
+		block = block->next;
+		block->used = 0;
+		arena->currentBlock = block;
+	}
+	
+	void *pointer = (char *)block->data + block->used;
+	block->used += size;
+	arena->lastAllocation = pointer;
+	return pointer;
+}
+
+static void* arenaReallocate(void *context, void *pointer, size_t oldSize, size_t newSize) {
+	struct t_arena *arena = context;
+	if (pointer == NULL) {
+		return arenaAllocate(context, newSize);
+	}
+	
+	//If we are the most recent allocation we can usually just grow (or shrink) in place
+	struct t_arena_block *block = arena->currentBlock;
+	if (pointer == arena->lastAllocation) {
+		size_t offset = (char *)pointer - (char *)block->data;
+		if (offset + alignedSize(newSize) <= block->capacity) {
+			block->used = offset + alignedSize(newSize);
+			return pointer;
+		}
+	}else if (newSize <= oldSize) {
+		return pointer;
+	}
+	
+	void *newPointer = arenaAllocate(context, newSize);
+	memcpy(newPointer, pointer, oldSize < newSize ? oldSize : newSize);
+	return newPointer;
+}
+
+static void arenaDeallocate(void *context, void *pointer, size_t size) {
+	struct t_arena *arena = context;
+	//Only the most recent allocation can be given back, everything else waits for a reset
+	if (pointer == arena->lastAllocation) {
+		arena->currentBlock->used = (char *)pointer - (char *)arena->currentBlock->data;
+		arena->lastAllocation = NULL;
+	}
+}
+
+struct t_allocator arenaAllocator(struct t_arena *arena) {
+	struct t_allocator allocator = {
+		arenaAllocate,
+		arenaReallocate,
+		arenaDeallocate,
+		arena
+	};
+	return allocator;
+}
+
+static void freeArenaBlocks(struct t_arena_block *block) {
+	while (block != NULL) {
+		struct t_arena_block *next = block->next;
+		free(block);
+		block = next;
+	}
+}
+
+/**
+ Release every allocation made from the arena in one go. Regular blocks are kept around for reuse
+ 
+ @param arena The arena
+ */
+void resetArena(struct t_arena *arena) {
+	freeArenaBlocks(arena->oversizedBlocks);
+	arena->oversizedBlocks = NULL;
+	arena->currentBlock = arena->firstBlock;
+	arena->currentBlock->used = 0;
+	arena->lastAllocation = NULL;
+}
+
+void freeArena(struct t_arena *arena) {
+	freeArenaBlocks(arena->oversizedBlocks);
+	freeArenaBlocks(arena->firstBlock);
+	free(arena);
+}
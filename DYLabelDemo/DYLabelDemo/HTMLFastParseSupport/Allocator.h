@@ -0,0 +1,57 @@
+//
+//  Allocator.h
+//  HTMLFastParse
+//
+
+#ifndef Allocator_h
+#define Allocator_h
+
+#include <stddef.h>
+#include "ParseStatistics.h"
+
+/**
+ A pluggable allocator. Everything the parser allocates (scratch space, tag names, link URLs and results) goes through one of these
+ */
+struct t_allocator {
+	void* (*allocate)(void *context, size_t size);
+	//Like realloc. oldSize is the size the pointer was allocated (or last reallocated) with
+	void* (*reallocate)(void *context, void *pointer, size_t oldSize, size_t newSize);
+	//Release a single allocation. Allocators which release everything at once (i.e. arenas) may ignore this
+	void (*deallocate)(void *context, void *pointer, size_t size);
+	void *context;
+};
+
+/**
+ The default allocator, backed by malloc/realloc/free
+ */
+extern const struct t_allocator mallocAllocator;
+
+static inline void* allocatorAllocate(const struct t_allocator *allocator, size_t size) {
+	PARSE_STATISTICS_ADD(allocations, 1);
+	PARSE_STATISTICS_ADD(allocatedBytes, size);
+	return allocator->allocate(allocator->context, size);
+}
+
+static inline void* allocatorReallocate(const struct t_allocator *allocator, void *pointer, size_t oldSize, size_t newSize) {
+	PARSE_STATISTICS_ADD(allocations, 1);
+	PARSE_STATISTICS_ADD(allocatedBytes, newSize);
+	return allocator->reallocate(allocator->context, pointer, oldSize, newSize);
+}
+
+static inline void allocatorDeallocate(const struct t_allocator *allocator, void *pointer, size_t size) {
+	if (pointer != NULL) {
+		allocator->deallocate(allocator->context, pointer, size);
+	}
+}
+
+/**
+ A bump allocator. Allocations are carved out of large blocks and individual frees are ignored; everything is released at once by resetArena/freeArena.
+ Use this when parsing lots of small documents so that a whole parse result can be thrown away in one go
+ */
+struct t_arena;
+struct t_arena* createArena(size_t blockSize);
+struct t_allocator arenaAllocator(struct t_arena *arena);
+void resetArena(struct t_arena *arena);
+void freeArena(struct t_arena *arena);
+
+#endif /* Allocator_h */
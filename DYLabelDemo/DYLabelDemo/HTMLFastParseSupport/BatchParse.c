@@ -0,0 +1,210 @@
+//
+//  BatchParse.c
+//  HTMLFastParse
+//
+//  Parses a whole batch of documents (i.e. every comment in a thread) across a pool of worker threads.
+//  Each worker owns a parser context and an arena for its scratch space and takes documents from its own share of the batch, stealing from
+//  the other workers once its share runs out so that a few huge documents don't leave the rest of the pool idle.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "BatchParse.h"
+#include "C_HTML_Parser.h"
+#include "Allocator.h"
+
+//Size of each worker's arena blocks
+#define WORKER_ARENA_BLOCK_SIZE (256 * 1024)
+
+/**
+ A range of document indices [head, tail) packed into one word so the owner (taking from the head) and thieves (taking from the tail) can race with a single compare and swap
+ */
+struct t_work_queue {
+	_Atomic uint64_t range;
+};
+
+struct t_batch_worker {
+	pthread_t thread;
+	int index;
+	struct t_batch *batch;
+	struct t_arena *arena;
+	struct t_allocator allocator;
+};
+
+struct t_batch {
+	const struct t_document *documents;
+	//Per document results, still in each worker's arena
+	struct t_parsed_document *parsed;
+	struct t_work_queue *queues;
+	struct t_batch_worker *workers;
+	int numberOfWorkers;
+};
+
+static uint64_t packRange(uint32_t head, uint32_t tail) {
+	return ((uint64_t)head << 32) | tail;
+}
+
+/**
+ Take the next document from the front of our own queue
+ 
+ @return The document index or -1 if the queue is empty
+ */
+static int takeFromHead(struct t_work_queue *queue) {
+	uint64_t range = atomic_load(&queue->range);
+	while (true) {
+		uint32_t head = (uint32_t)(range >> 32);
+		uint32_t tail = (uint32_t)range;
+		if (head >= tail) {
+			return -1;
+		}
+		if (atomic_compare_exchange_weak(&queue->range, &range, packRange(head + 1, tail))) {
+			return (int)head;
+		}
+	}
+}
+
+/**
+ Steal a document from the back of someone else's queue
+ 
+ @return The document index or -1 if the queue is empty
+ */
+static int stealFromTail(struct t_work_queue *queue) {
+	uint64_t range = atomic_load(&queue->range);
+	while (true) {
+		uint32_t head = (uint32_t)(range >> 32);
+		uint32_t tail = (uint32_t)range;
+		if (head >= tail) {
+			return -1;
+		}
+		if (atomic_compare_exchange_weak(&queue->range, &range, packRange(head, tail - 1))) {
+			return (int)(tail - 1);
+		}
+	}
+}
+
+static size_t alignUp(size_t size, size_t alignment) {
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+static void* batchWorkerMain(void *context) {
+	struct t_batch_worker *worker = context;
+	struct t_batch *batch = worker->batch;
+	struct t_parser_context *parserContext = createParserContext();
+	
+	//Work through our own share first, then help everyone else starting with our neighbour
+	for (int offset = 0; offset < batch->numberOfWorkers; offset++) {
+		struct t_work_queue *queue = &batch->queues[(worker->index + offset) % batch->numberOfWorkers];
+		int documentIndex;
+		while ((documentIndex = offset == 0 ? takeFromHead(queue) : stealFromTail(queue)) >= 0) {
+			const struct t_document *document = &batch->documents[documentIndex];
+			struct t_parsed_document parsed;
+			parseHTMLWithContext(parserContext, document->html, document->length, &parsed);
+			
+			//The context's results only last until its next document so hold on to a copy until the batch is packed
+			void *storage = allocatorAllocate(&worker->allocator, packedDocumentSize(&parsed));
+			packParsedDocument(&parsed, &batch->parsed[documentIndex], storage);
+		}
+	}
+	
+	freeParserContext(parserContext);
+	return NULL;
+}
+
+/**
+ Copy every document's results out of the worker arenas into a single block, in input order
+ */
+static struct t_batch_result* packBatchResult(struct t_parsed_document parsed[], int numberOfDocuments) {
+	//Lay the block out as [result][documents][each document's formats, links and text...] so everything stays aligned
+	size_t documentsOffset = alignUp(sizeof(struct t_batch_result), sizeof(max_align_t));
+	size_t packedOffset = alignUp(documentsOffset + numberOfDocuments * sizeof(struct t_parsed_document), sizeof(max_align_t));
+	size_t resultSize = packedOffset;
+	for (int i = 0; i < numberOfDocuments; i++) {
+		resultSize += packedDocumentSize(&parsed[i]);
+	}
+	
+	char *block = malloc(resultSize);
+	struct t_batch_result *result = (struct t_batch_result *)block;
+	result->documents = (struct t_parsed_document *)(block + documentsOffset);
+	result->numberOfDocuments = numberOfDocuments;
+	result->resultSize = resultSize;
+	
+	char *cursor = block + packedOffset;
+	for (int i = 0; i < numberOfDocuments; i++) {
+		packParsedDocument(&parsed[i], &result->documents[i], cursor);
+		cursor += packedDocumentSize(&parsed[i]);
+	}
+	return result;
+}
+
+/**
+ Parse a batch of documents in parallel
+ 
+ @param documents The documents to parse
+ @param numberOfDocuments The number of documents
+ @param numberOfThreads How many worker threads to use. Zero or less uses one per online CPU
+ @return The results in input order, all in a single allocation. Release with freeBatchResult
+ */
+struct t_batch_result* parseHTMLBatch(const struct t_document documents[], int numberOfDocuments, int numberOfThreads) {
+	if (numberOfThreads <= 0) {
+		long onlineCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+		numberOfThreads = onlineCPUs > 0 ? (int)onlineCPUs : 1;
+	}
+	if (numberOfThreads > numberOfDocuments) {
+		numberOfThreads = numberOfDocuments > 0 ? numberOfDocuments : 1;
+	}
+	
+	struct t_batch batch;
+	batch.documents = documents;
+	batch.parsed = calloc(numberOfDocuments > 0 ? numberOfDocuments : 1, sizeof(struct t_parsed_document));
+	batch.numberOfWorkers = numberOfThreads;
+	batch.queues = malloc(numberOfThreads * sizeof(struct t_work_queue));
+	batch.workers = malloc(numberOfThreads * sizeof(struct t_batch_worker));
+	
+	//Start everyone off with an even, contiguous share
+	for (int i = 0; i < numberOfThreads; i++) {
+		uint32_t head = (uint32_t)((long long)numberOfDocuments * i / numberOfThreads);
+		uint32_t tail = (uint32_t)((long long)numberOfDocuments * (i + 1) / numberOfThreads);
+		atomic_init(&batch.queues[i].range, packRange(head, tail));
+	}
+	
+	for (int i = 0; i < numberOfThreads; i++) {
+		struct t_batch_worker *worker = &batch.workers[i];
+		worker->index = i;
+		worker->batch = &batch;
+		worker->arena = createArena(WORKER_ARENA_BLOCK_SIZE);
+		worker->allocator = arenaAllocator(worker->arena);
+	}
+	//The calling thread is worker zero
+	for (int i = 1; i < numberOfThreads; i++) {
+		if (pthread_create(&batch.workers[i].thread, NULL, batchWorkerMain, &batch.workers[i]) != 0) {
+			//Couldn't start it, the others will steal its share
+			batch.workers[i].thread = pthread_self();
+		}
+	}
+	batchWorkerMain(&batch.workers[0]);
+	for (int i = 1; i < numberOfThreads; i++) {
+		if (!pthread_equal(batch.workers[i].thread, pthread_self())) {
+			pthread_join(batch.workers[i].thread, NULL);
+		}
+	}
+	
+	struct t_batch_result *result = packBatchResult(batch.parsed, numberOfDocuments);
+	
+	for (int i = 0; i < numberOfThreads; i++) {
+		freeArena(batch.workers[i].arena);
+	}
+	free(batch.workers);
+	free(batch.queues);
+	free(batch.parsed);
+	return result;
+}
+
+void freeBatchResult(struct t_batch_result *result) {
+	free(result);
+}
@@ -0,0 +1,33 @@
+//
+//  BatchParse.h
+//  HTMLFastParse
+//
+
+#ifndef BatchParse_h
+#define BatchParse_h
+
+#include <stddef.h>
+#include "C_HTML_Parser.h"
+
+/**
+ A document to be parsed as part of a batch
+ */
+struct t_document {
+	const char *html;
+	size_t length;
+};
+
+/**
+ The result of parseHTMLBatch. documents and everything they reference live in one allocation
+ */
+struct t_batch_result {
+	//In the same order as the input documents
+	struct t_parsed_document *documents;
+	int numberOfDocuments;
+	size_t resultSize;
+};
+
+struct t_batch_result* parseHTMLBatch(const struct t_document documents[], int numberOfDocuments, int numberOfThreads);
+void freeBatchResult(struct t_batch_result *result);
+
+#endif /* BatchParse_h */
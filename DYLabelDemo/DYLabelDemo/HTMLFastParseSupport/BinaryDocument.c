@@ -0,0 +1,568 @@
+//
+//  BinaryDocument.c
+//  HTMLFastParse
+//
+//  A binary layout for finished parses, so they can be sent over the wire or cached on disk and used without parsing the HTML again.
+//  Everything is little-endian. A file is a header, the document records one after another and an index of where each record starts:
+//
+//    file header    "HFPD", uint16 version, uint16 header size, uint64 number of documents, uint64 offset of the index
+//    records        each starting on an 8 byte boundary
+//    index          uint64 offset of each record
+//
+//  A record is a header of uint32s (record length, display text length, visible charachters, formats, encoded format bytes, links, link text
+//  bytes, flags, blocks, encoded block bytes) followed by the null terminated display text, a uint32 offset into the link text for each link,
+//  the link text (null terminated URLs, unique since the parser already interns them), the formats and the blocks. Each format is four varints:
+//  its start as a delta from the previous format's start, its length, the low 32 bits of its style and its link ID. Each block is five varints:
+//  its start as a delta from the previous block's start, its length, its kind, quote depth and list depth, in the order the tokenizer closed
+//  them. Readers hand out views straight into the record, so opening a cached thread costs a page fault instead of a parse.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "BinaryDocument.h"
+
+#define FILE_MAGIC "HFPD"
+#define FILE_HEADER_SIZE 24
+#define RECORD_HEADER_SIZE 40
+//The most bytes a 32 bit varint takes
+#define MAXIMUM_VARINT_SIZE 5
+//How much a file writer collects before writing it out
+#define WRITER_BUFFER_SIZE (256 * 1024)
+
+enum t_record_flags {
+	RECORD_FLAG_VALID_UTF8 = 1 << 0,
+};
+
+static void storeUInt16(unsigned char destination[], uint16_t value) {
+	destination[0] = (unsigned char)value;
+	destination[1] = (unsigned char)(value >> 8);
+}
+
+static void storeUInt32(unsigned char destination[], uint32_t value) {
+	for (int i = 0; i < 4; i++) {
+		destination[i] = (unsigned char)(value >> (i * 8));
+	}
+}
+
+static void storeUInt64(unsigned char destination[], uint64_t value) {
+	for (int i = 0; i < 8; i++) {
+		destination[i] = (unsigned char)(value >> (i * 8));
+	}
+}
+
+static uint16_t loadUInt16(const unsigned char source[]) {
+	return (uint16_t)(source[0] | source[1] << 8);
+}
+
+static uint32_t loadUInt32(const unsigned char source[]) {
+	return (uint32_t)source[0] | (uint32_t)source[1] << 8 | (uint32_t)source[2] << 16 | (uint32_t)source[3] << 24;
+}
+
+static uint64_t loadUInt64(const unsigned char source[]) {
+	return (uint64_t)loadUInt32(source) | (uint64_t)loadUInt32(&source[4]) << 32;
+}
+
+static unsigned char* storeVarint(unsigned char *destination, uint32_t value) {
+	while (value >= 0x80) {
+		*destination++ = (unsigned char)(value | 0x80);
+		value >>= 7;
+	}
+	*destination++ = (unsigned char)value;
+	return destination;
+}
+
+/**
+ Read a varint, refusing anything which runs past the end or doesn't fit in 32 bits
+ */
+static bool loadVarint(const unsigned char **cursor, const unsigned char *end, uint32_t *value) {
+	uint32_t result = 0;
+	for (int shift = 0; shift < MAXIMUM_VARINT_SIZE * 7; shift += 7) {
+		if (*cursor >= end) {
+			return false;
+		}
+		unsigned char byte = *(*cursor)++;
+		if (shift == 28 && byte > 0x0F) {
+			return false;
+		}
+		result |= (uint32_t)(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0) {
+			*value = result;
+			return true;
+		}
+	}
+	return false;
+}
+
+static uint64_t alignUp(uint64_t size, uint64_t alignment) {
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+/* Records */
+
+/**
+ The most bytes encodeParsedDocument can write for a document
+ 
+ @param document The document
+ @return An upper bound on the size of its record
+ */
+size_t encodedDocumentSize(const struct t_parsed_document *document) {
+	size_t size = alignUp(RECORD_HEADER_SIZE + document->displayTextLength + 1, 4);
+	size += (size_t)document->links.numberOfLinks * 4 + document->links.linkTextLength;
+	size += (size_t)document->numberOfFormats * 4 * MAXIMUM_VARINT_SIZE;
+	size += (size_t)document->numberOfBlocks * 5 * MAXIMUM_VARINT_SIZE;
+	return alignUp(size, 8);
+}
+
+/**
+ Write a document's record, i.e. straight after makeAttributesLinear or as part of a file
+ 
+ @param document The document
+ @param destination Where to write it, at least encodedDocumentSize bytes
+ @return The length of the record, a multiple of 8
+ */
+size_t encodeParsedDocument(const struct t_parsed_document *document, void *destination) {
+	unsigned char *record = destination;
+	const struct t_link_table *links = &document->links;
+	unsigned char *cursor = &record[RECORD_HEADER_SIZE];
+	memcpy(cursor, document->displayText, document->displayTextLength);
+	cursor += document->displayTextLength;
+	*cursor++ = 0x00;
+	while ((cursor - record) % 4 != 0) {
+		*cursor++ = 0x00;
+	}
+	
+	for (int i = 0; i < links->numberOfLinks; i++) {
+		storeUInt32(cursor, (uint32_t)links->linkOffsets[i]);
+		cursor += 4;
+	}
+	if (links->linkTextLength > 0) {
+		memcpy(cursor, links->linkText, links->linkTextLength);
+		cursor += links->linkTextLength;
+	}
+	
+	//Deltas are taken from the previous start rather than end so they wrap around correctly even if formats were ever out of order
+	unsigned char *formatsStart = cursor;
+	unsigned int previousStart = 0;
+	for (int i = 0; i < document->numberOfFormats; i++) {
+		struct t_format format = document->formats[i];
+		cursor = storeVarint(cursor, format.startPosition - previousStart);
+		cursor = storeVarint(cursor, format.endPosition - format.startPosition);
+		cursor = storeVarint(cursor, (uint32_t)format.style);
+		cursor = storeVarint(cursor, formatLinkID(format));
+		previousStart = format.startPosition;
+	}
+	size_t formatsLength = cursor - formatsStart;
+	
+	//Blocks come out in the order they closed, so inner blocks before the ones holding them and the deltas wrap around the same way
+	unsigned char *blocksStart = cursor;
+	previousStart = 0;
+	for (int i = 0; i < document->numberOfBlocks; i++) {
+		struct t_block block = document->blocks[i];
+		cursor = storeVarint(cursor, block.startPosition - previousStart);
+		cursor = storeVarint(cursor, block.endPosition - block.startPosition);
+		cursor = storeVarint(cursor, block.kind);
+		cursor = storeVarint(cursor, block.quoteDepth);
+		cursor = storeVarint(cursor, block.listDepth);
+		previousStart = block.startPosition;
+	}
+	size_t blocksLength = cursor - blocksStart;
+	while ((cursor - record) % 8 != 0) {
+		*cursor++ = 0x00;
+	}
+	
+	size_t recordLength = cursor - record;
+	storeUInt32(&record[0], (uint32_t)recordLength);
+	storeUInt32(&record[4], (uint32_t)document->displayTextLength);
+	storeUInt32(&record[8], (uint32_t)document->numberOfHumanVisibleCharachters);
+	storeUInt32(&record[12], (uint32_t)document->numberOfFormats);
+	storeUInt32(&record[16], (uint32_t)formatsLength);
+	storeUInt32(&record[20], (uint32_t)links->numberOfLinks);
+	storeUInt32(&record[24], (uint32_t)links->linkTextLength);
+	storeUInt32(&record[28], document->isValidUTF8 ? RECORD_FLAG_VALID_UTF8 : 0);
+	storeUInt32(&record[32], (uint32_t)document->numberOfBlocks);
+	storeUInt32(&record[36], (uint32_t)blocksLength);
+	return recordLength;
+}
+
+/**
+ Get a view of a record. Only the header is checked against the bytes available; formats, blocks and links are checked as they're read
+ 
+ @param record The record
+ @param availableLength How many bytes can be read from record
+ @param view (returned) The document
+ @return false if the record is malformed or truncated
+ */
+bool readDocumentRecord(const void *record, size_t availableLength, struct t_document_view *view) {
+	const unsigned char *bytes = record;
+	if (availableLength < RECORD_HEADER_SIZE) {
+		return false;
+	}
+	uint32_t recordLength = loadUInt32(&bytes[0]);
+	uint32_t displayTextLength = loadUInt32(&bytes[4]);
+	uint32_t numberOfHumanVisibleCharachters = loadUInt32(&bytes[8]);
+	uint32_t numberOfFormats = loadUInt32(&bytes[12]);
+	uint32_t formatsLength = loadUInt32(&bytes[16]);
+	uint32_t numberOfLinks = loadUInt32(&bytes[20]);
+	uint32_t linkTextLength = loadUInt32(&bytes[24]);
+	uint32_t flags = loadUInt32(&bytes[28]);
+	uint32_t numberOfBlocks = loadUInt32(&bytes[32]);
+	uint32_t blocksLength = loadUInt32(&bytes[36]);
+	if (recordLength > availableLength || numberOfHumanVisibleCharachters > INT_MAX || numberOfFormats > INT_MAX || numberOfLinks > INT_MAX || numberOfBlocks > INT_MAX) {
+		return false;
+	}
+	
+	//Sections are laid out in 64 bits so that nothing can wrap around
+	uint64_t linkOffsetsStart = alignUp(RECORD_HEADER_SIZE + (uint64_t)displayTextLength + 1, 4);
+	uint64_t linkTextStart = linkOffsetsStart + (uint64_t)numberOfLinks * 4;
+	uint64_t formatsStart = linkTextStart + linkTextLength;
+	uint64_t blocksStart = formatsStart + formatsLength;
+	if (blocksStart + blocksLength > recordLength) {
+		return false;
+	}
+	if (bytes[RECORD_HEADER_SIZE + displayTextLength] != 0x00 || (linkTextLength > 0 && bytes[formatsStart - 1] != 0x00)) {
+		return false;
+	}
+	
+	view->displayText = (const char *)&bytes[RECORD_HEADER_SIZE];
+	view->displayTextLength = displayTextLength;
+	view->numberOfHumanVisibleCharachters = (int)numberOfHumanVisibleCharachters;
+	view->isValidUTF8 = (flags & RECORD_FLAG_VALID_UTF8) != 0;
+	view->numberOfFormats = (int)numberOfFormats;
+	view->numberOfLinks = (int)numberOfLinks;
+	view->encodedFormats = &bytes[formatsStart];
+	view->encodedFormatsLength = formatsLength;
+	view->numberOfBlocks = (int)numberOfBlocks;
+	view->encodedBlocks = &bytes[blocksStart];
+	view->encodedBlocksLength = blocksLength;
+	view->linkOffsets = &bytes[linkOffsetsStart];
+	view->linkText = (const char *)&bytes[linkTextStart];
+	view->linkTextLength = linkTextLength;
+	return true;
+}
+
+void startDecodingFormats(const struct t_document_view *view, struct t_format_decoder *decoder) {
+	decoder->cursor = view->encodedFormats;
+	decoder->end = view->encodedFormats + view->encodedFormatsLength;
+	decoder->previousStart = 0;
+	decoder->remainingFormats = view->numberOfFormats;
+	decoder->view = view;
+}
+
+/**
+ Read a view's next format
+ 
+ @param decoder The decoder
+ @param format (returned) The format, the same as makeAttributesLinear produced. Its link ID is for documentViewLinkURL
+ @return false once there are no formats left, or if the rest are malformed
+ */
+bool decodeNextFormat(struct t_format_decoder *decoder, struct t_format *format) {
+	if (decoder->remainingFormats <= 0) {
+		return false;
+	}
+	const struct t_document_view *view = decoder->view;
+	uint32_t startDelta, length, style, linkID;
+	bool isValid = loadVarint(&decoder->cursor, decoder->end, &startDelta) && loadVarint(&decoder->cursor, decoder->end, &length) && loadVarint(&decoder->cursor, decoder->end, &style) && loadVarint(&decoder->cursor, decoder->end, &linkID);
+	unsigned int start = decoder->previousStart + startDelta;
+	unsigned int visibleLength = (unsigned int)view->numberOfHumanVisibleCharachters;
+	if (!isValid || linkID > (uint32_t)view->numberOfLinks || length > visibleLength || start > visibleLength - length) {
+		decoder->remainingFormats = 0;
+		return false;
+	}
+	
+	format->style = style | (uint64_t)linkID << T_FORMAT_LINK_ID_SHIFT;
+	format->startPosition = start;
+	format->endPosition = start + length;
+	decoder->previousStart = start;
+	decoder->remainingFormats--;
+	return true;
+}
+
+void startDecodingBlocks(const struct t_document_view *view, struct t_block_decoder *decoder) {
+	decoder->cursor = view->encodedBlocks;
+	decoder->end = view->encodedBlocks + view->encodedBlocksLength;
+	decoder->previousStart = 0;
+	decoder->remainingBlocks = view->numberOfBlocks;
+	decoder->view = view;
+}
+
+/**
+ Read a view's next block
+ 
+ @param decoder The decoder
+ @param block (returned) The block, the same as the tokenizer produced
+ @return false once there are no blocks left, or if the rest are malformed
+ */
+bool decodeNextBlock(struct t_block_decoder *decoder, struct t_block *block) {
+	if (decoder->remainingBlocks <= 0) {
+		return false;
+	}
+	const struct t_document_view *view = decoder->view;
+	uint32_t startDelta, length, kind, quoteDepth, listDepth;
+	bool isValid = loadVarint(&decoder->cursor, decoder->end, &startDelta) && loadVarint(&decoder->cursor, decoder->end, &length) && loadVarint(&decoder->cursor, decoder->end, &kind) && loadVarint(&decoder->cursor, decoder->end, &quoteDepth) && loadVarint(&decoder->cursor, decoder->end, &listDepth);
+	unsigned int start = decoder->previousStart + startDelta;
+	unsigned int visibleLength = (unsigned int)view->numberOfHumanVisibleCharachters;
+	if (!isValid || kind > UCHAR_MAX || quoteDepth > UCHAR_MAX || listDepth > UCHAR_MAX || length > visibleLength || start > visibleLength - length) {
+		decoder->remainingBlocks = 0;
+		return false;
+	}
+	
+	block->startPosition = start;
+	block->endPosition = start + length;
+	block->kind = (unsigned char)kind;
+	block->quoteDepth = (unsigned char)quoteDepth;
+	block->listDepth = (unsigned char)listDepth;
+	decoder->previousStart = start;
+	decoder->remainingBlocks--;
+	return true;
+}
+
+/**
+ The URL of one of a view's links
+ 
+ @param view The document
+ @param linkID A format's link ID
+ @return The null terminated URL, NULL if there's no such link
+ */
+const char* documentViewLinkURL(const struct t_document_view *view, unsigned int linkID) {
+	if (linkID == 0 || linkID > (unsigned int)view->numberOfLinks) {
+		return NULL;
+	}
+	uint32_t offset = loadUInt32(&view->linkOffsets[(linkID - 1) * 4]);
+	return offset < view->linkTextLength ? &view->linkText[offset] : NULL;
+}
+
+/* Writing files */
+
+struct t_document_file_writer {
+	int file;
+	//Where the next record goes
+	uint64_t offset;
+	uint64_t *recordOffsets;
+	uint64_t numberOfDocuments;
+	size_t recordOffsetsCapacity;
+	unsigned char *buffer;
+	size_t bufferLength;
+	size_t bufferCapacity;
+	bool hasFailed;
+};
+
+static bool writeAll(int file, const void *bytes, size_t length) {
+	const unsigned char *cursor = bytes;
+	while (length > 0) {
+		ssize_t written = write(file, cursor, length);
+		if (written <= 0) {
+			return false;
+		}
+		cursor += written;
+		length -= written;
+	}
+	return true;
+}
+
+static void flushWriter(struct t_document_file_writer *writer) {
+	if (writer->bufferLength > 0 && !writer->hasFailed && !writeAll(writer->file, writer->buffer, writer->bufferLength)) {
+		writer->hasFailed = true;
+	}
+	writer->bufferLength = 0;
+}
+
+static void addRecordOffset(struct t_document_file_writer *writer, uint64_t offset) {
+	if (writer->numberOfDocuments == writer->recordOffsetsCapacity) {
+		writer->recordOffsetsCapacity = writer->recordOffsetsCapacity > 0 ? writer->recordOffsetsCapacity * 2 : 1024;
+		writer->recordOffsets = realloc(writer->recordOffsets, writer->recordOffsetsCapacity * sizeof(uint64_t));
+	}
+	writer->recordOffsets[writer->numberOfDocuments++] = offset;
+}
+
+static void storeFileHeader(unsigned char header[], uint64_t numberOfDocuments, uint64_t indexOffset) {
+	memcpy(header, FILE_MAGIC, 4);
+	storeUInt16(&header[4], BINARY_DOCUMENT_VERSION);
+	storeUInt16(&header[6], FILE_HEADER_SIZE);
+	storeUInt64(&header[8], numberOfDocuments);
+	storeUInt64(&header[16], indexOffset);
+}
+
+/**
+ Start writing a file of documents
+ 
+ @param file An empty file open for writing. The writer doesn't close it
+ @return The writer. The file isn't readable until finishDocumentFileWriter
+ */
+struct t_document_file_writer* createDocumentFileWriter(int file) {
+	struct t_document_file_writer *writer = calloc(1, sizeof(struct t_document_file_writer));
+	writer->file = file;
+	writer->bufferCapacity = WRITER_BUFFER_SIZE;
+	writer->buffer = malloc(writer->bufferCapacity);
+	//The index offset stays zero until the file is finished, which readers refuse
+	storeFileHeader(writer->buffer, 0, 0);
+	writer->bufferLength = FILE_HEADER_SIZE;
+	writer->offset = FILE_HEADER_SIZE;
+	return writer;
+}
+
+/**
+ Append a document to a file
+ 
+ @param writer The writer
+ @param document The document, i.e. a parser context's result
+ @return false if writing has failed
+ */
+bool writeParsedDocument(struct t_document_file_writer *writer, const struct t_parsed_document *document) {
+	size_t size = encodedDocumentSize(document);
+	if (writer->bufferLength + size > writer->bufferCapacity) {
+		flushWriter(writer);
+		if (size > writer->bufferCapacity) {
+			writer->bufferCapacity = size;
+			free(writer->buffer);
+			writer->buffer = malloc(writer->bufferCapacity);
+		}
+	}
+	size_t recordLength = encodeParsedDocument(document, &writer->buffer[writer->bufferLength]);
+	addRecordOffset(writer, writer->offset);
+	writer->bufferLength += recordLength;
+	writer->offset += recordLength;
+	return !writer->hasFailed;
+}
+
+/**
+ Append records which were already encoded with encodeParsedDocument, i.e. by several threads at once
+ 
+ @param writer The writer
+ @param records The records, back to back
+ @param length Their total length
+ @return false if the records are malformed or writing has failed
+ */
+bool writeEncodedDocuments(struct t_document_file_writer *writer, const void *records, size_t length) {
+	const unsigned char *bytes = records;
+	size_t position = 0;
+	while (position < length) {
+		uint32_t recordLength = length - position >= RECORD_HEADER_SIZE ? loadUInt32(&bytes[position]) : 0;
+		if (recordLength < RECORD_HEADER_SIZE || recordLength % 8 != 0 || recordLength > length - position) {
+			writer->hasFailed = true;
+			return false;
+		}
+		addRecordOffset(writer, writer->offset + position);
+		position += recordLength;
+	}
+	flushWriter(writer);
+	if (!writer->hasFailed && !writeAll(writer->file, records, length)) {
+		writer->hasFailed = true;
+	}
+	writer->offset += length;
+	return !writer->hasFailed;
+}
+
+/**
+ Write a file's index and header and free the writer
+ 
+ @param writer The writer
+ @return false if anything couldn't be written, in which case the file isn't readable
+ */
+bool finishDocumentFileWriter(struct t_document_file_writer *writer) {
+	flushWriter(writer);
+	uint64_t indexOffset = writer->offset;
+	for (uint64_t i = 0; i < writer->numberOfDocuments; i++) {
+		if (writer->bufferLength + 8 > writer->bufferCapacity) {
+			flushWriter(writer);
+		}
+		storeUInt64(&writer->buffer[writer->bufferLength], writer->recordOffsets[i]);
+		writer->bufferLength += 8;
+	}
+	flushWriter(writer);
+	
+	unsigned char header[FILE_HEADER_SIZE];
+	storeFileHeader(header, writer->numberOfDocuments, indexOffset);
+	bool isWritten = !writer->hasFailed && pwrite(writer->file, header, FILE_HEADER_SIZE, 0) == FILE_HEADER_SIZE;
+	
+	free(writer->recordOffsets);
+	free(writer->buffer);
+	free(writer);
+	return isWritten;
+}
+
+/* Reading files */
+
+struct t_document_file {
+	const unsigned char *bytes;
+	size_t length;
+	uint64_t numberOfDocuments;
+	uint64_t indexOffset;
+	uint16_t headerSize;
+};
+
+/**
+ Map a file of documents
+ 
+ @param path The file
+ @return The file, NULL if it can't be read or isn't a finished file of a version we understand. Release with closeDocumentFile
+ */
+struct t_document_file* openDocumentFile(const char *path) {
+	int descriptor = open(path, O_RDONLY);
+	if (descriptor < 0) {
+		return NULL;
+	}
+	struct stat status;
+	if (fstat(descriptor, &status) != 0 || status.st_size < FILE_HEADER_SIZE) {
+		close(descriptor);
+		return NULL;
+	}
+	size_t length = (size_t)status.st_size;
+	void *mapping = mmap(NULL, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+	close(descriptor);
+	if (mapping == MAP_FAILED) {
+		return NULL;
+	}
+	
+	const unsigned char *bytes = mapping;
+	uint16_t headerSize = loadUInt16(&bytes[6]);
+	uint64_t numberOfDocuments = loadUInt64(&bytes[8]);
+	uint64_t indexOffset = loadUInt64(&bytes[16]);
+	bool isValid = memcmp(bytes, FILE_MAGIC, 4) == 0 && loadUInt16(&bytes[4]) == BINARY_DOCUMENT_VERSION && headerSize >= FILE_HEADER_SIZE;
+	isValid = isValid && indexOffset >= headerSize && indexOffset <= length && numberOfDocuments <= (length - indexOffset) / 8;
+	if (!isValid) {
+		munmap(mapping, length);
+		return NULL;
+	}
+	
+	struct t_document_file *file = malloc(sizeof(struct t_document_file));
+	file->bytes = bytes;
+	file->length = length;
+	file->numberOfDocuments = numberOfDocuments;
+	file->indexOffset = indexOffset;
+	file->headerSize = headerSize;
+	return file;
+}
+
+uint64_t documentFileCount(const struct t_document_file *file) {
+	return file->numberOfDocuments;
+}
+
+/**
+ Get a view of one of a file's documents. Nothing is copied; only the pages the view is read from are ever touched
+ 
+ @param file The file
+ @param index The document's index, in the order they were written
+ @param view (returned) The document, valid until the file is closed
+ @return false if there's no such document or its record is malformed
+ */
+bool documentFileView(const struct t_document_file *file, uint64_t index, struct t_document_view *view) {
+	if (index >= file->numberOfDocuments) {
+		return false;
+	}
+	uint64_t offset = loadUInt64(&file->bytes[file->indexOffset + index * 8]);
+	if (offset < file->headerSize || offset >= file->indexOffset) {
+		return false;
+	}
+	return readDocumentRecord(&file->bytes[offset], file->indexOffset - offset, view);
+}
+
+void closeDocumentFile(struct t_document_file *file) {
+	munmap((void *)file->bytes, file->length);
+	free(file);
+}
@@ -0,0 +1,83 @@
+//
+//  BinaryDocument.h
+//  HTMLFastParse
+//
+
+#ifndef BinaryDocument_h
+#define BinaryDocument_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "C_HTML_Parser.h"
+
+//Bumped whenever the layout changes in a way older readers can't skip over
+#define BINARY_DOCUMENT_VERSION 2
+
+/**
+ A parsed document read straight out of its binary record, without copying or decoding anything up front. The pointers are into the record
+ */
+struct t_document_view {
+	//Null terminated display text
+	const char *displayText;
+	size_t displayTextLength;
+	int numberOfHumanVisibleCharachters;
+	bool isValidUTF8;
+	int numberOfFormats;
+	int numberOfLinks;
+	//Use a format decoder and documentViewLinkURL to read these
+	const unsigned char *encodedFormats;
+	size_t encodedFormatsLength;
+	int numberOfBlocks;
+	//Use a block decoder to read these
+	const unsigned char *encodedBlocks;
+	size_t encodedBlocksLength;
+	const unsigned char *linkOffsets;
+	const char *linkText;
+	size_t linkTextLength;
+};
+
+/**
+ Where reading a view's formats is up to. Start one with startDecodingFormats
+ */
+struct t_format_decoder {
+	const unsigned char *cursor;
+	const unsigned char *end;
+	unsigned int previousStart;
+	int remainingFormats;
+	const struct t_document_view *view;
+};
+
+/**
+ Where reading a view's blocks is up to. Start one with startDecodingBlocks
+ */
+struct t_block_decoder {
+	const unsigned char *cursor;
+	const unsigned char *end;
+	unsigned int previousStart;
+	int remainingBlocks;
+	const struct t_document_view *view;
+};
+
+size_t encodedDocumentSize(const struct t_parsed_document *document);
+size_t encodeParsedDocument(const struct t_parsed_document *document, void *destination);
+bool readDocumentRecord(const void *record, size_t availableLength, struct t_document_view *view);
+void startDecodingFormats(const struct t_document_view *view, struct t_format_decoder *decoder);
+bool decodeNextFormat(struct t_format_decoder *decoder, struct t_format *format);
+void startDecodingBlocks(const struct t_document_view *view, struct t_block_decoder *decoder);
+bool decodeNextBlock(struct t_block_decoder *decoder, struct t_block *block);
+const char* documentViewLinkURL(const struct t_document_view *view, unsigned int linkID);
+
+struct t_document_file_writer;
+struct t_document_file_writer* createDocumentFileWriter(int file);
+bool writeParsedDocument(struct t_document_file_writer *writer, const struct t_parsed_document *document);
+bool writeEncodedDocuments(struct t_document_file_writer *writer, const void *records, size_t length);
+bool finishDocumentFileWriter(struct t_document_file_writer *writer);
+
+struct t_document_file;
+struct t_document_file* openDocumentFile(const char *path);
+uint64_t documentFileCount(const struct t_document_file *file);
+bool documentFileView(const struct t_document_file *file, uint64_t index, struct t_document_view *view);
+void closeDocumentFile(struct t_document_file *file);
+
+#endif /* BinaryDocument_h */
@@ -16,12 +16,64 @@
 #include "t_format.h"
 #include "Stack.h"
 #include "entities.h"
+#include "Allocator.h"
+#include "TextScan.h"
+#include "ParseStatistics.h"
 
 //Disable printf
 #define printf(fmt, ...) (0)
 
-//Enable reddit tune. Comment this out to remove them
-#define reddit_mode 1;
+//For the functions each dialect gets its own copy of, so the compiler can fold that dialect's rules into them
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+
+/**
+ The rules of a dialect of HTML. Only ever used through a constant from DIALECT_POLICIES, so each dialect's tokenizer is compiled with its rules folded in
+ instead of testing them for every byte
+ */
+struct t_dialect_policy {
+	//Drop new lines which follow another new line or come before any text
+	bool isCollapsingNewLines;
+	//Turn <br/> into a new line
+	bool isBreakingLines;
+	//Treat <br> and <hr> as self closing even without the '/'
+	bool isClosingVoidTags;
+	//What each item of an unordered list starts with (at most 8 bytes), and how many NSString charachters that is
+	const char *bulletMarker;
+	size_t bulletMarkerLength;
+	int bulletMarkerVisibleLength;
+	//What each kind of tag counts as in this dialect (i.e. <b> is <strong>), TAG_UNKNOWN for tags it ignores
+	unsigned char tagKinds[TAG_KIND_COUNT];
+};
+
+//Tags every dialect takes at face value
+#define COMMON_TAG_KINDS \
+	[TAG_A] = TAG_A, [TAG_BLOCKQUOTE] = TAG_BLOCKQUOTE, [TAG_BR] = TAG_BR, [TAG_CODE] = TAG_CODE, [TAG_DEL] = TAG_DEL, [TAG_DIV] = TAG_DIV, \
+	[TAG_EM] = TAG_EM, [TAG_H1] = TAG_H1, [TAG_H2] = TAG_H2, [TAG_H3] = TAG_H3, [TAG_H4] = TAG_H4, [TAG_H5] = TAG_H5, [TAG_H6] = TAG_H6, \
+	[TAG_HR] = TAG_HR, [TAG_LI] = TAG_LI, [TAG_OL] = TAG_OL, [TAG_P] = TAG_P, [TAG_PRE] = TAG_PRE, [TAG_STRONG] = TAG_STRONG, \
+	[TAG_SUP] = TAG_SUP, [TAG_UL] = TAG_UL
+
+static const struct t_dialect_policy DIALECT_POLICIES[HTML_DIALECT_COUNT] = {
+	[HTML_DIALECT_REDDIT] = {
+		//Reddit sends double new lines, and new lines between blockquotes and p tags, which mess up quote formatting
+		.isCollapsingNewLines = true,
+		//Reddit already sends a new line after <br/> tags so it'd be duplicated in effect
+		.isBreakingLines = false,
+		.isClosingVoidTags = false,
+		.bulletMarker = "\xE2\x80\xA2 ",
+		.bulletMarkerLength = 4,
+		.bulletMarkerVisibleLength = 2,
+		.tagKinds = {COMMON_TAG_KINDS},
+	},
+	[HTML_DIALECT_GENERIC] = {
+		.isCollapsingNewLines = false,
+		.isBreakingLines = true,
+		.isClosingVoidTags = true,
+		.bulletMarker = "\xE2\x80\xA2 ",
+		.bulletMarkerLength = 4,
+		.bulletMarkerVisibleLength = 2,
+		.tagKinds = {COMMON_TAG_KINDS, [TAG_B] = TAG_STRONG, [TAG_I] = TAG_EM, [TAG_S] = TAG_DEL, [TAG_STRIKE] = TAG_DEL},
+	},
+};
 
 
 /**
@@ -54,419 +106,2557 @@ int getVisibleByteEffectForCharachter(unsigned char charachter) {
 	}
 }
 
+//How much display text we stage before handing it to the text callback
+#define TOKENIZER_TEXT_BUFFER_SIZE 4096
+
 /**
- Tockenize and extract tag info from the input and then output the cleaned string alongisde a tag array with relevant position info
- 
- @param input Input text as a char array
- @param inputLength The number of charachters (as bytes) to read, excluding the null byte!
- @param displayText The char array to write the clean, display text to
- @param completedTags (returned) The array to write the t_format structs to (provides position and tag info). Tags positions are CHARACHTER relative, not byte relative! Usable in NSAttributedString etc
- @param numberOfTags (returned) The number of tags discovered
+ The state of an in progress (streaming) tokenization. Everything required to pick up where the previous chunk left off lives here
  */
-void tokenizeHTML(char input[],size_t inputLength,char displayText[], struct t_tag completedTags[], int* numberOfTags, int* numberOfHumanVisibleCharachters) {
-	//A stack used for processing tags. The stack size allocates space for x number of POINTERS. Ie this is not creating an overflow vulnerability AFAIK
-	struct Stack* htmlTags = createStack((int)inputLength);
-	//Completed / filled tags
-	//struct t_format completedTags[(int)inputLength];
-	int completedTagsPosition = 0;
+struct t_tokenizer {
+	//A stack used for processing tags
+	struct Stack htmlTags;
 	
 	//Used to track if we are currently reading the label of an HTML tag
-	bool isInTag = false;
-	char *tagNameCharArray = malloc(inputLength * sizeof(char) + 1); //+1 for a null byte
-	char *tagNameBuffer = &tagNameCharArray[0];//Hack to get our buffer on the stack because it's a very fast allocation
-	int tagNameCopyPosition = 0;
+	bool isInTag;
+	//Set once the placeholder for the opening tag we're reading is on the stack. It isn't when the stack is already STACK_MAXIMUM_DEPTH deep
+	bool isPlaceholderPushed;
+	//Opening tags dropped for being too deep, the closing tags which come next are theirs
+	unsigned int ignoredOpenTags;
+	//Set when we've just read a '<' and still need the next charachter to find out if we are an opening or closing tag
+	bool isTagOpenPending;
+	//Tags are read straight out of the input, only one split across chunks is copied here until its '>' arrives
+	char *tagNameBuffer;
+	size_t tagNameCopyPosition;
+	size_t tagNameCapacity;
 	
 	//Used to track if we are currently reading an HTML entity
-	bool isInHTMLEntity = false;
-	char *htmlEntityCharArray = malloc(inputLength * sizeof(char) + 1); //+1 for a null byte
-	char *htmlEntityBuffer = &htmlEntityCharArray[0];//Hack to get our buffer on the stack because it's a very fast allocation
-	int htmlEntityCopyPosition = 0;
+	//Only used when an entity is split across chunks, otherwise entities are decoded straight out of the input
+	bool isInHTMLEntity;
+	char htmlEntityBuffer[HTML_ENTITY_MAX_LENGTH];
+	size_t htmlEntityCopyPosition;
+	
+	//Display text which has not been handed to the text callback yet
+	char *textBuffer;
+	size_t textBufferPosition;
+	size_t textBufferCapacity;
 	
-	int stringCopyPosition = 0;
 	//Used for applying tokens, DO NOT USE FOR MEMORY WORK. This is used because NSString handles multibyte charachters as single charachters and not as multiple like we have to
-	int stringVisiblePosition = 0;
+	int stringVisiblePosition;
+	//Validation of all the display text so far, so broken UTF-8 is caught here rather than by NSString disagreeing with stringVisiblePosition
+	struct t_utf8_validator utf8Validator;
 	
-	char previous = 0x00;
-    //The current index label (i.e. 1,2,3) of the list, USHRT_MAX for unordered
-    unsigned short currentListValue = 0x00;
+	char previous;
+	//The current index label (i.e. 1,2,3) of the list, USHRT_MAX for unordered
+	unsigned short currentListValue;
+	//How many quotes and lists are open, for the blocks we emit
+	unsigned int quoteDepth;
+	unsigned int listDepth;
 	
-	for (int i = 0; i < inputLength; i++) {
-		char current = input[i];
-		if (current == '<') {
-			isInTag = true;
-			tagNameCopyPosition = 0;
-			
-			//If there's a next charachter (data validation) and it's NOT '/' (i.e. we're an open tag) we want to create a new formatter on the stack
-			if (i+1 < inputLength && input[i+1] != '/') {
-				struct t_tag format;
-                format.tag = NULL;
-				format.startPosition = stringVisiblePosition;
-				push(htmlTags,format);
-			}
-			
-		}else if (current == '>') {
-			//We've hit an unencoded less than which terminates an HTML tag
-			isInTag = false;
-			//Terminate the buffer
-			tagNameBuffer[tagNameCopyPosition] = 0x00;
-			
-			//Are we a closing HTML tag (i.e. the first character in our tag is a '/')
-			if (tagNameBuffer[0] == '/') {
-				//We are a closing tag, commit
-                struct t_tag* formatP = pop(htmlTags);
-                //Make sure we didn't get a NULL from popping an empty stack
-                if (formatP != 0) {
-                    struct t_tag format = *formatP;
-                    format.endPosition = stringVisiblePosition;
-                    completedTags[completedTagsPosition] = format;
-                    completedTagsPosition++;
-                }
-			}
-			//Are we a self closing tag like <br/> or <hr/>?
-			else if ((tagNameCopyPosition > 0 && tagNameBuffer[tagNameCopyPosition-1] == '/')) {
-				//These tags are special because they're an action in it of themselves so they both start themselves and commit all in one.
-				struct t_tag format = *pop(htmlTags);
-				
-				/* special cases, take a shortcut and remove the tags */
-				if (strncmp(tagNameBuffer, "br/", 3) == 0) {
-					//We're a <br/> tag, drop a new line into the actual text and remove the tag
-					//IGNORE THESE WHEN USING THE REDDIT MODE because Reddit already sends a new line after <br/> tags so it's duplicated in effect
-#ifndef reddit_mode
-					displayText[stringCopyPosition] = '\n';
-					stringCopyPosition++;
-					stringVisiblePosition++;
-#endif
-				}else {
-					//We're not a known case, add the tag into the extracted tag array
-					long tagNameLength = (tagNameCopyPosition + 1) * sizeof(char);
-					char *newTagBuffer = malloc(tagNameLength);
-					strncpy(newTagBuffer,tagNameBuffer,tagNameLength);
-					
-					format.tag = newTagBuffer;
-					format.startPosition = stringVisiblePosition;
-					format.endPosition = stringVisiblePosition;
-					
-					completedTags[completedTagsPosition] = format;
-					completedTagsPosition++;
-				}
-				
-				
-			}else {
-				//No -- so let's push the operation onto our stack
-				//We've ended the tag definition, so pull the tag from the buffer and push that on to the stack
-				long tagNameLength = (tagNameCopyPosition + 1) * sizeof(char);
-				char *newTagBuffer = malloc(tagNameLength);
-				memset(newTagBuffer, 0x0, tagNameLength);
-				strncpy(newTagBuffer,tagNameBuffer,tagNameLength);
-                struct t_tag* formatP = pop(htmlTags);
-                //Make sure we didn't get a NULL from popping an empty stack
-                //If we end up failing here the text will be horribly mangled however "broken formatting" IMHO is better than a full crash or worse a sec issue
-                if (formatP != 0) {
-                    struct t_tag format = *formatP;
-                    format.tag = newTagBuffer;
-                    push(htmlTags,format);
-                }
-                
-                //Add textual descriptors for order/unordered lists
-                if (strncmp(newTagBuffer, "ol", 2) == 0) {
-                    //Ordered list
-                    currentListValue = 1;
-                }else if (strncmp(newTagBuffer, "ul", 2) == 0) {
-                    //Unordered list
-                    currentListValue = USHRT_MAX;
-                }else if (strncmp(newTagBuffer, "li", 2) == 0) {
-                    //Apply current list index
-                    if (currentListValue == USHRT_MAX) {
-                        stringVisiblePosition += 2;
-                        displayText[stringCopyPosition++] = 0xE2;
-                        displayText[stringCopyPosition++] = 0x80;
-                        displayText[stringCopyPosition++] = 0xA2;
-                        displayText[stringCopyPosition++] = ' ';
-                    }else {
-                        int written = sprintf(&displayText[stringCopyPosition], "%i. ",currentListValue);
-                        stringCopyPosition += written;
-                        stringVisiblePosition += written;
-                        currentListValue++;
-                    }
-                }
-			}
-            tagNameCopyPosition = 0;
-		}else if (current == '&') {
-			//We are starting an HTML entitiy;
-			isInHTMLEntity = true;
-			htmlEntityCopyPosition = 0;
-			htmlEntityBuffer[htmlEntityCopyPosition] = '&';
-			htmlEntityCopyPosition++;
-		}else if (isInHTMLEntity == true && current == ';') {
-			//We are finishing an HTML entity
-			isInHTMLEntity = false;
-			htmlEntityBuffer[htmlEntityCopyPosition] = ';';
-			htmlEntityCopyPosition++;
-			htmlEntityBuffer[htmlEntityCopyPosition] = 0x00;
-			htmlEntityCopyPosition++;
-			
-			//Are we decoding into a tag (i.e. into the url portion of <a href='http://test/forks?t=yes&f=no'/>
-			if (isInTag) {
-				//Yes!
-				size_t numberDecodedBytes = decode_html_entities_utf8(&tagNameBuffer[tagNameCopyPosition], htmlEntityBuffer);
-				tagNameCopyPosition += numberDecodedBytes;
-			}else {
-				//Expand into regular text
-				size_t numberDecodedBytes = decode_html_entities_utf8(&displayText[stringCopyPosition], htmlEntityBuffer);
-                for (unsigned long decodedI = 0; decodedI < numberDecodedBytes; decodedI++) {
-                    //Add the visual effect for each characher. This lets us also handle when decode sends back a tag it can't decode.
-                    //Also helpful incase we have codes which decode to multiple charachters, which could happen
-                    stringVisiblePosition += getVisibleByteEffectForCharachter(displayText[stringCopyPosition + decodedI]);
-                }
-				
-				stringCopyPosition += numberDecodedBytes;
-			}
-			
-			
-		}else {
-			if (isInTag) {
-				tagNameBuffer[tagNameCopyPosition] = current;
-				tagNameCopyPosition++;
-			}else if (isInHTMLEntity) {
-				htmlEntityBuffer[htmlEntityCopyPosition] = current;
-				htmlEntityCopyPosition++;
-			}else {
-				
-				//Don't allow double new lines (thanks redddit for sending these?)
-                //Don't allow just new lines (happens between blockquotes and p tags, again reddit issue)
-				//This messes up quote formatting
-#ifdef reddit_mode
-				if ((current != '\n' || previous != '\n') && (current != '\n' || stringVisiblePosition > 1 )) {
-#endif
-					previous = current;
-					displayText[stringCopyPosition] = current;
-					stringVisiblePosition+=getVisibleByteEffectForCharachter(current);
-					stringCopyPosition++;
-#ifdef reddit_mode
-				}
-#endif
-				
-			}
+	//Picks which specialized tokenizer the chunks go through
+	enum t_html_dialect dialect;
+	
+	t_tokenizer_text_callback textCallback;
+	t_tokenizer_tag_callback tagCallback;
+	//Optional, NULL when nobody wants the blocks
+	t_tokenizer_block_callback blockCallback;
+	void *callbackContext;
+	
+	//Where all of our scratch space comes from
+	struct t_allocator allocator;
+	//Where the link URLs of emitted tags come from. Usually the same as allocator
+	struct t_allocator linkAllocator;
+};
+
+/**
+ Make sure a growable buffer can hold at least `required` bytes
+ 
+ @param allocator The allocator the buffer came from
+ @param buffer The buffer to grow (may be moved)
+ @param capacity The current capacity of the buffer, updated if we grow
+ @param required The number of bytes we need
+ */
+static void ensureBufferCapacity(const struct t_allocator *allocator, char **buffer, size_t *capacity, size_t required) {
+	if (required <= *capacity) {
+		return;
+	}
+	size_t newCapacity = *capacity * 2;
+	if (newCapacity < required) {
+		newCapacity = required;
+	}
+	*buffer = allocatorReallocate(allocator, *buffer, *capacity, newCapacity);
+	*capacity = newCapacity;
+}
+
+/**
+ Make sure a growable array can hold at least `required` elements
+ 
+ @param allocator The allocator the array came from
+ @param array The array to grow (may be moved)
+ @param capacity The current capacity of the array in elements, updated if we grow
+ @param required The number of elements we need
+ @param elementSize The size of one element
+ */
+static void ensureArrayCapacity(const struct t_allocator *allocator, void **array, size_t *capacity, size_t required, size_t elementSize) {
+	if (required <= *capacity) {
+		return;
+	}
+	size_t newCapacity = *capacity * 2;
+	if (newCapacity < required) {
+		newCapacity = required;
+	}
+	*array = allocatorReallocate(allocator, *array, *capacity * elementSize, newCapacity * elementSize);
+	*capacity = newCapacity;
+}
+
+/**
+ Release the link URL of a tag produced by the tokenizer
+ 
+ @param allocator The allocator the tag came from
+ @param tag The tag
+ */
+static void freeTagLinkURL(const struct t_allocator *allocator, struct t_tag *tag) {
+	if (tag->linkURL != NULL) {
+		allocatorDeallocate(allocator, tag->linkURL, strlen(tag->linkURL) + 1);
+		tag->linkURL = NULL;
+	}
+}
+
+/**
+ Hand all staged display text to the text callback
+ 
+ @param tokenizer The tokenizer
+ */
+static void flushDisplayText(struct t_tokenizer *tokenizer) {
+	if (tokenizer->textBufferPosition > 0) {
+		tokenizer->textCallback(tokenizer->callbackContext, tokenizer->textBuffer, tokenizer->textBufferPosition);
+		tokenizer->textBufferPosition = 0;
+	}
+}
+
+/**
+ Get a pointer into the display text staging buffer which has room for at least `length` more bytes, flushing or growing the buffer if needed
+ 
+ @param tokenizer The tokenizer
+ @param length The number of bytes the caller is about to write
+ @return Where the caller should write to. The caller must advance textBufferPosition by however much it actually wrote
+ */
+static char* reserveDisplayText(struct t_tokenizer *tokenizer, size_t length) {
+	if (tokenizer->textBufferPosition + length > tokenizer->textBufferCapacity) {
+		flushDisplayText(tokenizer);
+		ensureBufferCapacity(&tokenizer->allocator, &tokenizer->textBuffer, &tokenizer->textBufferCapacity, length);
+	}
+	return &tokenizer->textBuffer[tokenizer->textBufferPosition];
+}
+
+/**
+ Put the tokenizer back into the state it's in before it has seen any input
+ 
+ @param tokenizer The tokenizer
+ */
+static void resetTokenizer(struct t_tokenizer *tokenizer) {
+	//Run through the unclosed tags so we can free them
+	while (!isEmpty(&tokenizer->htmlTags)) {
+		struct t_tag* formatP = pop(&tokenizer->htmlTags);
+		//Make sure we didn't get a NULL from popping an empty stack
+		if (formatP != NULL) {
+			printf("!!! UNCLOSED TAG: %i starts at %i ends at %i\n",formatP->kind,formatP->startPosition,formatP->endPosition);
+			PARSE_STATISTICS_ADD(tagsUnclosed, 1);
+			freeTagLinkURL(&tokenizer->linkAllocator, formatP);
 		}
 	}
-    
-    //Check if the last tag is incomplete (i.e. "blah blah <tag") so we can remove the unfinished tag from the stack
-    if (tagNameCopyPosition > 0) {
-        printf("!!! Found incomplete tag, popping and continuing...");
-        pop(htmlTags);
-    }
-    
-	//and now terminate our output.
-	displayText[stringCopyPosition] = 0x00;
 	
-	//Run through the unclosed tags so we can either process them and or free them
-	while (!isEmpty(htmlTags)) {
-        struct t_tag* formatP = pop(htmlTags);
-        //Make sure we didn't get a NULL from popping an empty stack
-        if (formatP != NULL) {
-            struct t_tag in = *formatP;
-            printf("!!! UNCLOSED TAG: %s starts at %i ends at %i\n",in.tag,in.startPosition,in.endPosition);
-            free(in.tag);
-        }
+	tokenizer->isInTag = false;
+	tokenizer->isTagOpenPending = false;
+	tokenizer->isPlaceholderPushed = false;
+	tokenizer->ignoredOpenTags = 0;
+	tokenizer->tagNameCopyPosition = 0;
+	tokenizer->isInHTMLEntity = false;
+	tokenizer->htmlEntityCopyPosition = 0;
+	tokenizer->textBufferPosition = 0;
+	tokenizer->stringVisiblePosition = 0;
+	memset(&tokenizer->utf8Validator, 0, sizeof(struct t_utf8_validator));
+	tokenizer->previous = 0x00;
+	tokenizer->currentListValue = 0x00;
+	tokenizer->quoteDepth = 0;
+	tokenizer->listDepth = 0;
+}
+
+/**
+ Create a streaming tokenizer
+ 
+ @param allocator Where the tokenizer's scratch space and the link URLs of emitted tags are allocated from. NULL uses malloc
+ @param textCallback Receives display text
+ @param tagCallback Receives completed tags. Their link URLs belong to the caller and must be released through the same allocator
+ @param callbackContext Passed through to the callbacks
+ @return The tokenizer. Release with freeTokenizer
+ */
+struct t_tokenizer* createTokenizer(const struct t_allocator *allocator, t_tokenizer_text_callback textCallback, t_tokenizer_tag_callback tagCallback, void *callbackContext) {
+	if (allocator == NULL) {
+		allocator = &mallocAllocator;
 	}
+	struct t_tokenizer *tokenizer = allocatorAllocate(allocator, sizeof(struct t_tokenizer));
+	tokenizer->allocator = *allocator;
+	tokenizer->linkAllocator = *allocator;
+	allocator = &tokenizer->allocator;
+	//Typical nesting fits in the stack itself, it only goes to the allocator for deeper documents
+	initializeStack(&tokenizer->htmlTags, allocator);
 	
-	//Now print out all tags
+	tokenizer->tagNameCapacity = 64;
+	tokenizer->tagNameBuffer = allocatorAllocate(allocator, tokenizer->tagNameCapacity);
+	tokenizer->textBufferCapacity = TOKENIZER_TEXT_BUFFER_SIZE;
+	tokenizer->textBuffer = allocatorAllocate(allocator, tokenizer->textBufferCapacity);
 	
-	for (int i = 0; i < completedTagsPosition; i++) {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-variable"
-		struct t_tag inTag = completedTags[i];
-		printf("TAG: %s starts at %i ends at %i\n",inTag.tag,inTag.startPosition,inTag.endPosition);
-#pragma GCC diagnostic pop
-	}
-	*numberOfTags = completedTagsPosition;
-	*numberOfHumanVisibleCharachters = stringVisiblePosition;
+	tokenizer->textCallback = textCallback;
+	tokenizer->tagCallback = tagCallback;
+	tokenizer->blockCallback = NULL;
+	tokenizer->callbackContext = callbackContext;
+	tokenizer->dialect = HTML_DIALECT_REDDIT;
 	
-	//Release everything that's not necessary
-	prepareForFree(htmlTags);
-	free(htmlTags);
-	free(tagNameCharArray);
-	free(htmlEntityCharArray);
+	resetTokenizer(tokenizer);
+	return tokenizer;
 }
 
-void print_t_format(struct t_format format) {
-	printf("Format [%i,%i): Bold %i, Italic %i, Struck %i, Code %i, Exponent %i, Quote %i, H%i, ListNest %i LinkURL %s\n",format.startPosition,format.endPosition,format.isBold,format.isItalics,format.isStruck,format.isCode,format.exponentLevel,format.quoteLevel,format.hLevel,format.listNestLevel,format.linkURL);
+/**
+ Choose the dialect of HTML the tokenizer parses. Reddit's is the default. Only change it between documents
+ 
+ @param tokenizer The tokenizer
+ @param dialect The dialect
+ */
+void setTokenizerDialect(struct t_tokenizer *tokenizer, enum t_html_dialect dialect) {
+	tokenizer->dialect = dialect;
+}
+
+/**
+ Have the tokenizer emit a block for every paragraph, quote, list item, heading and preformatted text as it's closed. Off by default
+ 
+ @param tokenizer The tokenizer
+ @param blockCallback Receives the blocks with the tokenizer's callback context, or NULL to stop emitting them
+ */
+void setTokenizerBlockCallback(struct t_tokenizer *tokenizer, t_tokenizer_block_callback blockCallback) {
+	tokenizer->blockCallback = blockCallback;
 }
 
+void freeTokenizer(struct t_tokenizer *tokenizer) {
+	resetTokenizer(tokenizer);
+	//Copy the allocator out, the tokenizer itself is about to go away
+	struct t_allocator allocator = tokenizer->allocator;
+	releaseStack(&tokenizer->htmlTags);
+	allocatorDeallocate(&allocator, tokenizer->tagNameBuffer, tokenizer->tagNameCapacity);
+	allocatorDeallocate(&allocator, tokenizer->textBuffer, tokenizer->textBufferCapacity);
+	allocatorDeallocate(&allocator, tokenizer, sizeof(struct t_tokenizer));
+}
 
 /**
- Compare two t_formats. Returns 0 for the same, 1 if different in anyway
+ A piece of a tag's contents. It points into the input, or for a tag split across chunks into the tokenizer's copy of it
+ */
+struct t_span {
+	const char *start;
+	size_t length;
+};
+
+/**
+ One attribute of a tag. The value is empty for attributes without one (i.e. <input disabled>)
+ */
+struct t_tag_attribute {
+	struct t_span name;
+	struct t_span value;
+};
+
+/**
+ If a charachter separates the name and attributes of a tag
+ */
+static ALWAYS_INLINE bool isTagWhitespace(char charachter) {
+	return charachter == ' ' || charachter == '\t' || charachter == '\n' || charachter == '\r' || charachter == '\f';
+}
+
+/**
+ Find the length of the tag name at the start of a tag's contents (i.e. "a" for "a href=...")
  
- @param format1 The first t_format struct
- @param format2 The second t_format struct
- @return 0 or 1
+ @param tagContents The contents of the tag, without the '<' and '>'
+ @param length The length of tagContents
+ @return The length of the name
  */
-int t_format_cmp(struct t_format format1,struct t_format format2) {
-	//Doubles are 8 bytes, which covers all the boolean properties and a tiny bit of the link pointer
-	//Tip from one of the LLVM people at WWDC`18
-	double format1Sum = *(((double*)&format1.isBold));
-	double format2Sum = *(((double*)&format2.isBold));
-    //Get the next 8 bytes
-    //double format3Sum = *((1 + (double*)&format1.isBold));
-    //double format4Sum = *((1 + (double*)&format2.isBold));
-	if (format1Sum != format2Sum /*|| format3Sum != format4Sum*/) {
-		return 1;
-	}if (format1.linkURL != format2.linkURL || ((format1.linkURL != NULL && format2.linkURL == NULL) || (format2.linkURL != NULL && format1.linkURL == NULL)) || (format1.linkURL != NULL && format2.linkURL != NULL && strcmp(format1.linkURL, format2.linkURL) != 0)) {
-		return 1;
-	}else {
-		return 0;
+static size_t tagNameLength(const char *tagContents, size_t length) {
+	size_t nameLength = 0;
+	while (nameLength < length) {
+		char charachter = tagContents[nameLength];
+		if (charachter == '/' || isTagWhitespace(charachter)) {
+			break;
+		}
+		nameLength++;
 	}
+	return nameLength;
 }
 
+/**
+ Read the next attribute of a tag. Values may be double quoted, single quoted or unquoted, and an unterminated quote runs to the end of the tag
+ 
+ @param tagContents The contents of the tag, without the '<' and '>'
+ @param length The length of tagContents
+ @param position Where to carry on reading from. Start it after the tag name
+ @param attribute (returned) The attribute
+ @return false once there are no more attributes
+ */
+static bool readTagAttribute(const char *tagContents, size_t length, size_t *position, struct t_tag_attribute *attribute) {
+	size_t i = *position;
+	//Whitespace and the '/' of a self closing tag come between attributes
+	while (i < length && (isTagWhitespace(tagContents[i]) || tagContents[i] == '/')) {
+		i++;
+	}
+	if (i >= length) {
+		*position = i;
+		return false;
+	}
+	
+	//The name runs until whitespace, '/' or '='. A leading '=' is part of the name
+	size_t nameStart = i++;
+	while (i < length && !isTagWhitespace(tagContents[i]) && tagContents[i] != '/' && tagContents[i] != '=') {
+		i++;
+	}
+	attribute->name.start = &tagContents[nameStart];
+	attribute->name.length = i - nameStart;
+	attribute->value.start = &tagContents[i];
+	attribute->value.length = 0;
+	
+	size_t afterName = i;
+	while (i < length && isTagWhitespace(tagContents[i])) {
+		i++;
+	}
+	if (i >= length || tagContents[i] != '=') {
+		//No value, the next attribute starts straight after the name
+		*position = afterName;
+		return true;
+	}
+	i++;
+	while (i < length && isTagWhitespace(tagContents[i])) {
+		i++;
+	}
+	
+	if (i < length && (tagContents[i] == '"' || tagContents[i] == '\'')) {
+		char quote = tagContents[i++];
+		size_t valueStart = i;
+		while (i < length && tagContents[i] != quote) {
+			i++;
+		}
+		attribute->value.start = &tagContents[valueStart];
+		attribute->value.length = i - valueStart;
+		//Skip the closing quote
+		if (i < length) {
+			i++;
+		}
+	}else {
+		size_t valueStart = i;
+		while (i < length && !isTagWhitespace(tagContents[i])) {
+			i++;
+		}
+		attribute->value.start = &tagContents[valueStart];
+		attribute->value.length = i - valueStart;
+	}
+	*position = i;
+	return true;
+}
 
 /**
- Takes in overlapping t_format tags and simplifies them into 1D range suitable for use in NSAttributedString. Destroys inputTags in the process!
+ Find an attribute of a tag by its name, ignoring case. Like a browser, only the first of repeated attributes counts
  
- @param inputTags Overlapping tags buffer (given by tokenizeHTML)
- @param numberOfInputTags The number of inputTags
- @param simplifiedTags (return) Simplified tags buffer (return value)
- @param numberOfSimplifiedTags (return) the number of found simplified tags
- @param displayTextLength The size of the text that we will be applying these tags to
+ @param tagContents The contents of the tag, without the '<' and '>'
+ @param length The length of tagContents
+ @param name The name, in lower case
+ @param nameLength The length of name
+ @param value (returned) The attribute's value, still encoded
+ @return false if the tag doesn't have the attribute
  */
-void makeAttributesLinear(struct t_tag inputTags[], int numberOfInputTags, struct t_format simplifiedTags[], int* numberOfSimplifiedTags, int displayTextLength) {
-	//Create our state array
-	size_t bufferSize = displayTextLength * sizeof(struct t_format);
-	struct t_format *displayTextFormat = malloc(bufferSize);
-	//Init everything to zero in a single pass memory zero
-	memset(displayTextFormat, 0, bufferSize);
+static bool findTagAttribute(const char *tagContents, size_t length, const char *name, size_t nameLength, struct t_span *value) {
+	size_t position = tagNameLength(tagContents, length);
+	struct t_tag_attribute attribute;
+	while (readTagAttribute(tagContents, length, &position, &attribute)) {
+		if (attribute.name.length != nameLength) {
+			continue;
+		}
+		size_t i = 0;
+		while (i < nameLength && (attribute.name.start[i] | 0x20) == name[i]) {
+			i++;
+		}
+		if (i == nameLength) {
+			*value = attribute.value;
+			return true;
+		}
+	}
+	return false;
+}
 
-	//Apply format from each tag
-	for (int i = 0; i < numberOfInputTags; i++) {
-		struct t_tag tag = inputTags[i];
-		char* tagText = tag.tag;
+/**
+ Decode the entities in an attribute value, or just measure the result
+ 
+ @param destination Where to write the value, or NULL to only measure it
+ @param value The value
+ @return The number of bytes the decoded value takes
+ */
+static size_t decodeAttributeValue(char *destination, struct t_span value) {
+	char scratch[HTML_ENTITY_MAX_DECODED_LENGTH];
+	size_t decodedLength = 0;
+	size_t i = 0;
+	while (i < value.length) {
+		const char *ampersand = memchr(&value.start[i], '&', value.length - i);
+		size_t runLength = ampersand != NULL ? (size_t)(ampersand - &value.start[i]) : value.length - i;
+		if (destination != NULL) {
+			memcpy(&destination[decodedLength], &value.start[i], runLength);
+		}
+		decodedLength += runLength;
+		i += runLength;
+		if (ampersand == NULL) {
+			break;
+		}
 		
-		if (tagText == NULL) {
-			printf("NULL TAG TEXT?? SKIPPING!");
-		}else if (strncmp(tagText, "strong", 6) == 0) {
-			//Apply bold to all
-			for (int j = tag.startPosition; j < tag.endPosition; j++) {
-				displayTextFormat[j].isBold = 1;
-			}
-		}else if (strncmp(tagText, "em", 2) == 0) {
-			//Apply italics to all
-			for (int j = tag.startPosition; j < tag.endPosition; j++) {
-				displayTextFormat[j].isItalics = 1;
-			}
-		}else if (strncmp(tagText, "del", 3) == 0) {
-			//Apply strike to all
-			for (int j = tag.startPosition; j < tag.endPosition; j++) {
-				displayTextFormat[j].isStruck = 1;
-			}
-		}else if (strncmp(tagText, "code", 4) == 0) {
-			//Apply CODE! to all
-			for (int j = tag.startPosition; j < tag.endPosition; j++) {
-				displayTextFormat[j].isCode = 1;
-			}
-		}else if (strncmp(tagText, "blockquote", 10) == 0) {
-			//Increase quote level
-			for (int j = tag.startPosition; j < tag.endPosition; j++) {
-				displayTextFormat[j].quoteLevel++;
-			}
-		}else if (strncmp(tagText, "sup", 3) == 0) {
-			//Increase superscript level
-			for (int j = tag.startPosition; j < tag.endPosition; j++) {
-				displayTextFormat[j].exponentLevel++;
-			}
-		}else if (tagText[0] == 'h' && tagText[1] >= '1' && tagText[1] <= '6') {
-			//Set our header level
-			for (int j = tag.startPosition; j < tag.endPosition; j++) {
-				displayTextFormat[j].hLevel = tagText[1] - '0';
-			}
-		}else if (strncmp(tagText, "a href=", 7) == 0) {
-			//We first need to extract the link
-			long tagTextLength = strlen(tagText);
-			char *url = malloc(tagTextLength-7);
-			//Extract the URL
-			int z = 8;
-			for (; z < tagTextLength; z++) {
-				if (tagText[z] == '"') {
-					break;
-				}else {
-					url[z-8] = tagText[z];
-				}
-			}
-			url[z-8] = 0x00;
-			
-			//Set our link
-			for (int j = tag.startPosition; j < tag.endPosition; j++) {
-				displayTextFormat[j].linkURL = url;
+		//An entity which could carry on past the end of the value isn't one
+		long entityLength = scan_html_entity(&value.start[i], value.length - i);
+		size_t numberDecodedBytes = 0;
+		if (entityLength > 0) {
+			numberDecodedBytes = decode_html_entity_utf8(destination != NULL ? &destination[decodedLength] : scratch, &value.start[i], entityLength);
+		}
+		if (numberDecodedBytes == 0) {
+			//Not something we can decode, the '&' is just text
+			if (destination != NULL) {
+				destination[decodedLength] = '&';
 			}
-			
-			//If we never got into the loop above (and so url is never stored else where), free it now.
-			if (tag.endPosition - tag.startPosition <= 0) {
-				free(url);
+			decodedLength++;
+			i++;
+		}else {
+			if (destination != NULL) {
+				PARSE_STATISTICS_ADD(entitiesDecoded, 1);
 			}
-			
-        }else if (strncmp(tagText, "ol", 2) == 0 || (strncmp(tagText, "ul", 2) == 0)) {
-            //Apply list intendation
-            for (int j = tag.startPosition; j < tag.endPosition; j++) {
-                displayTextFormat[j].listNestLevel++;
-            }
-        }
-        else {
-			printf("Unknown tag: %s\n",tagText);
+			decodedLength += numberDecodedBytes;
+			i += entityLength;
 		}
-		
-		
-		//Destroy inputTags data as warned
-		free(tag.tag);
-		tag.tag = NULL;
+	}
+	return decodedLength;
+}
+
+/**
+ Pull the link out of an <a href="..."> tag
+ 
+ @param tokenizer The tokenizer (for its link allocator)
+ @param tagContents The contents of the tag, without the '<' and '>'
+ @param length The length of tagContents
+ @return The link (allocated by the tokenizer's link allocator) or NULL if the tag doesn't have one
+ */
+static char* extractLinkURL(struct t_tokenizer *tokenizer, const char *tagContents, size_t length) {
+	struct t_span href;
+	if (!findTagAttribute(tagContents, length, "href", 4, &href)) {
+		return NULL;
+	}
+	//Most links don't have any entities in them, which saves decoding twice to find out how much space we need
+	bool hasEntities = memchr(href.start, '&', href.length) != NULL;
+	size_t urlLength = hasEntities ? decodeAttributeValue(NULL, href) : href.length;
+	char *url = allocatorAllocate(&tokenizer->linkAllocator, urlLength + 1);
+	if (hasEntities) {
+		decodeAttributeValue(url, href);
+	}else {
+		memcpy(url, href.start, urlLength);
+	}
+	url[urlLength] = 0x00;
+	return url;
+}
+
+/**
+ If tags of a kind are blocks, see t_block
+ */
+static ALWAYS_INLINE bool isBlockTagKind(enum t_tag_kind kind) {
+	switch (kind) {
+		case TAG_P:
+		case TAG_BLOCKQUOTE:
+		case TAG_LI:
+		case TAG_H1:
+		case TAG_H2:
+		case TAG_H3:
+		case TAG_H4:
+		case TAG_H5:
+		case TAG_H6:
+		case TAG_PRE:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/**
+ Keep count of the open quotes and lists as tags are pushed onto and popped off the stack
+ 
+ @param tokenizer The tokenizer
+ @param kind The kind of the tag pushed or popped
+ @param change 1 for a push, -1 for a pop
+ */
+static ALWAYS_INLINE void countBlockNesting(struct t_tokenizer *tokenizer, unsigned char kind, int change) {
+	if (kind == TAG_BLOCKQUOTE) {
+		tokenizer->quoteDepth += change;
+	}else if (kind == TAG_OL || kind == TAG_UL) {
+		tokenizer->listDepth += change;
+	}
+}
+
+/**
+ Describe a block tag as a t_block
+ 
+ @param tag The tag, with its end position filled in
+ @param quoteDepth The number of quotes the block is in, counting itself
+ @param listDepth The number of lists the block is in
+ @return The block
+ */
+static struct t_block blockForTag(const struct t_tag *tag, unsigned int quoteDepth, unsigned int listDepth) {
+	struct t_block block;
+	block.startPosition = tag->startPosition;
+	block.endPosition = tag->endPosition;
+	block.kind = tag->kind;
+	block.quoteDepth = quoteDepth < UCHAR_MAX ? quoteDepth : UCHAR_MAX;
+	block.listDepth = listDepth < UCHAR_MAX ? listDepth : UCHAR_MAX;
+	return block;
+}
+
+/**
+ Hand a closed tag to the block callback if it's a block
+ 
+ @param tokenizer The tokenizer, with the tag already popped
+ @param tag The tag
+ */
+static ALWAYS_INLINE void emitBlock(struct t_tokenizer *tokenizer, const struct t_tag *tag) {
+	if (tokenizer->blockCallback == NULL || !isBlockTagKind(tag->kind)) {
+		return;
+	}
+	//A quote counts itself, but it's already off the stack
+	tokenizer->blockCallback(tokenizer->callbackContext, blockForTag(tag, tokenizer->quoteDepth + (tag->kind == TAG_BLOCKQUOTE), tokenizer->listDepth));
+}
+
+/**
+ If tags of a kind are inline styles, which carry on past a closing tag misnested inside them (i.e. the <i> in <b><i></b></i>)
+ */
+static ALWAYS_INLINE bool isReopenedTagKind(enum t_tag_kind kind) {
+	switch (kind) {
+		case TAG_A:
+		case TAG_B:
+		case TAG_CODE:
+		case TAG_DEL:
+		case TAG_EM:
+		case TAG_I:
+		case TAG_S:
+		case TAG_STRIKE:
+		case TAG_STRONG:
+		case TAG_SUP:
+			return true;
+		default:
+			return false;
+	}
+}
+
+/**
+ Copy a tag's link URL so a reopened tag has its own
+ 
+ @param tokenizer The tokenizer (for its link allocator)
+ @param linkURL The link, or NULL
+ @return The copy (allocated by the tokenizer's link allocator) or NULL
+ */
+static char* copyLinkURL(struct t_tokenizer *tokenizer, const char *linkURL) {
+	if (linkURL == NULL) {
+		return NULL;
+	}
+	size_t length = strlen(linkURL) + 1;
+	char *copy = allocatorAllocate(&tokenizer->linkAllocator, length);
+	memcpy(copy, linkURL, length);
+	return copy;
+}
+
+/**
+ End a tag taken off the stack at the current position and hand it over
+ 
+ @param tokenizer The tokenizer
+ @param format The tag
+ */
+static ALWAYS_INLINE void emitClosedTag(struct t_tokenizer *tokenizer, struct t_tag format) {
+	format.endPosition = tokenizer->stringVisiblePosition;
+	countBlockNesting(tokenizer, format.kind, -1);
+	printf("TAG: %i starts at %i ends at %i\n",format.kind,format.startPosition,format.endPosition);
+	emitBlock(tokenizer, &format);
+	tokenizer->tagCallback(tokenizer->callbackContext, format);
+	PARSE_STATISTICS_ADD(tagsClosed, 1);
+}
+
+/**
+ Close the innermost open tag of a kind. Like a browser, any tags opened inside it close along with it and the inline styles among them are
+ reopened so they carry on. A closing tag with nothing of its kind open is ignored rather than closing whatever happens to be on top
+ 
+ @param tokenizer The tokenizer
+ @param kind The kind of the closing tag
+ */
+static void closeTag(struct t_tokenizer *tokenizer, enum t_tag_kind kind) {
+	struct Stack *htmlTags = &tokenizer->htmlTags;
+	int match = findInStack(htmlTags, kind);
+	if (kind >= TAG_H1 && kind <= TAG_H6) {
+		//Any closing heading closes whichever heading is open, as it would in a browser
+		for (int heading = TAG_H1; heading <= TAG_H6; heading++) {
+			int index = findInStack(htmlTags, heading);
+			match = index > match ? index : match;
+		}
+	}
+	if (match < 0) {
+		PARSE_STATISTICS_ADD(emptyStackPops, 1);
+		return;
+	}
+	int top = stackSize(htmlTags) - 1;
+	if (match == top) {
+		emitClosedTag(tokenizer, *pop(htmlTags));
+		return;
 	}
 	
-	for (int i = 0; i < displayTextLength; i++) {
-		//print_t_format(displayTextFormat[i]);
+	//Misnested. Close everything above the match innermost first, leaving a fresh copy of the innermost inline styles in their place.
+	//Only MAXIMUM_REOPENED_TAGS are reopened, which keeps the number of tags within maximumNumberOfTags
+	PARSE_STATISTICS_ADD(tagsMisnested, top - match);
+	int numberOfReopenedTags = 0;
+	for (int i = top; i > match; i--) {
+		struct t_tag* formatP = stackItem(htmlTags, i);
+		struct t_tag format = *formatP;
+		if (isReopenedTagKind(formatP->kind) && numberOfReopenedTags < MAXIMUM_REOPENED_TAGS) {
+			formatP->startPosition = tokenizer->stringVisiblePosition;
+			formatP->linkURL = copyLinkURL(tokenizer, format.linkURL);
+			numberOfReopenedTags++;
+		}else {
+			//Not coming back, so the slide below skips it
+			formatP->kind = TAG_UNKNOWN;
+		}
+		emitClosedTag(tokenizer, format);
 	}
-	printf("--------\n");
+	emitClosedTag(tokenizer, *stackItem(htmlTags, match));
 	
-	//Now that each charachter has it's style, let's simplify to a 1D
-	*numberOfSimplifiedTags = 0;
-	unsigned int activeStyleStart = 0;
-	for (int i = 1; i < displayTextLength; i++) {
-		if (t_format_cmp(displayTextFormat[activeStyleStart], displayTextFormat[i]) != 0) {
-			//We're different, so commit our previous style (with start and ends) and adopt the current one
-			displayTextFormat[i-1].startPosition = activeStyleStart;
-			displayTextFormat[i-1].endPosition = i;
-			simplifiedTags[*numberOfSimplifiedTags] = displayTextFormat[i-1];
-			
-			if (displayTextFormat[i-1].linkURL) {
-				simplifiedTags[*numberOfSimplifiedTags].linkURL = malloc(strlen(displayTextFormat[i-1].linkURL) + 1);
-				memcpy(simplifiedTags[*numberOfSimplifiedTags].linkURL, displayTextFormat[i-1].linkURL, strlen(displayTextFormat[i-1].linkURL) + 1);
-			}
-			
-			print_t_format(displayTextFormat[i-1]);
-			*numberOfSimplifiedTags+=1;
-			activeStyleStart = i;
+	//Then slide the reopened tags down over the match and everything which didn't survive. None are blocks, quotes or lists so the nesting counts stay put
+	int size = match;
+	for (int i = match + 1; i <= top; i++) {
+		struct t_tag* formatP = stackItem(htmlTags, i);
+		if (isReopenedTagKind(formatP->kind)) {
+			*stackItem(htmlTags, size++) = *formatP;
 		}
 	}
+	truncateStack(htmlTags, size);
+}
+
+/**
+ Handle the closing '>' of a tag
+ 
+ @param tokenizer The tokenizer
+ @param policy The rules of the dialect being parsed
+ @param tagNameBuffer The contents of the tag, without the '<' and '>'
+ @param tagNameCopyPosition The length of tagNameBuffer
+ */
+static ALWAYS_INLINE void completeTag(struct t_tokenizer *tokenizer, const struct t_dialect_policy *policy, const char *tagNameBuffer, size_t tagNameCopyPosition) {
+	if (!tokenizer->isInTag) {
+		//A stray '>' outside of any tag. It's dropped, and mustn't touch the tags which are open
+		PARSE_STATISTICS_ADD(emptyStackPops, 1);
+		return;
+	}
+	//We've hit an unencoded less than which terminates an HTML tag
+	tokenizer->isInTag = false;
+	tokenizer->tagNameCopyPosition = 0;
 	
-	//and commit the final style
-	//We need to make sure we have displayed text otherwise we over/underflow here
-	if (displayTextLength > 0) {
-		displayTextFormat[displayTextLength-1].startPosition = activeStyleStart;
-		displayTextFormat[displayTextLength-1].endPosition = displayTextLength;
-		simplifiedTags[*numberOfSimplifiedTags] = displayTextFormat[displayTextLength-1];
-		if (displayTextFormat[displayTextLength-1].linkURL) {
-			simplifiedTags[*numberOfSimplifiedTags].linkURL = malloc(strlen(displayTextFormat[displayTextLength-1].linkURL) + 1);
-			memcpy(simplifiedTags[*numberOfSimplifiedTags].linkURL, displayTextFormat[displayTextLength-1].linkURL, strlen(displayTextFormat[displayTextLength-1].linkURL) + 1);
+	//Are we a closing HTML tag (i.e. the first character in our tag is a '/')
+	if (tagNameCopyPosition > 0 && tagNameBuffer[0] == '/') {
+		if (tokenizer->ignoredOpenTags > 0) {
+			//Still inside tags which were too deep to open, so this closes one of them
+			tokenizer->ignoredOpenTags--;
+			return;
 		}
-		print_t_format(displayTextFormat[displayTextLength-1]);
-		*numberOfSimplifiedTags+=1;
+		closeTag(tokenizer, policy->tagKinds[classifyTagName(&tagNameBuffer[1], tagNameLength(&tagNameBuffer[1], tagNameCopyPosition - 1))]);
+		return;
 	}
 	
-	//now free
-	for (int i = 0; i < displayTextLength; i++) {
-		//do we have a linkURL and is it either different from the next one or are we the last one
-		//this is neccesary so we don't double free the URL
-		if (displayTextFormat[i].linkURL && ((i + 1 < displayTextLength && displayTextFormat[i+1].linkURL != displayTextFormat[i].linkURL) || (i+1 >= displayTextLength))) {
-			free(displayTextFormat[i].linkURL);
-			displayTextFormat[i].linkURL = NULL;
+	//Classify the tag once, from here on we only deal in kinds
+	enum t_tag_kind kind = policy->tagKinds[classifyTagName(tagNameBuffer, tagNameLength(tagNameBuffer, tagNameCopyPosition))];
+	
+	//Are we a self closing tag like <br/> or <hr/>?
+	bool isSelfClosing = tagNameCopyPosition > 0 && tagNameBuffer[tagNameCopyPosition-1] == '/';
+	if (policy->isClosingVoidTags && (kind == TAG_BR || kind == TAG_HR)) {
+		isSelfClosing = true;
+	}
+	if (isSelfClosing) {
+		//These tags are special because they're an action in it of themselves so they both start themselves and commit all in one.
+		//Drop the placeholder pushed by our '<', everything it held is rewritten below
+		if (tokenizer->isPlaceholderPushed) {
+			pop(&tokenizer->htmlTags);
+		}
+		PARSE_STATISTICS_ADD(tagsSelfClosed, 1);
+		
+		/* special cases, take a shortcut and remove the tags */
+		if (kind == TAG_BR) {
+			//We're a <br/> tag, drop a new line into the actual text (if the dialect wants one) and remove the tag
+			if (policy->isBreakingLines) {
+				*reserveDisplayText(tokenizer, 1) = '\n';
+				tokenizer->textBufferPosition++;
+				tokenizer->stringVisiblePosition++;
+			}
+		}else {
+			//We're not a known case, add the tag into the extracted tag array
+			struct t_tag format;
+			format.kind = kind;
+			format.linkURL = kind == TAG_A ? extractLinkURL(tokenizer, tagNameBuffer, tagNameCopyPosition) : NULL;
+			format.startPosition = tokenizer->stringVisiblePosition;
+			format.endPosition = tokenizer->stringVisiblePosition;
+			
+			tokenizer->tagCallback(tokenizer->callbackContext, format);
 		}
+		return;
+	}
+	
+	if (!tokenizer->isPlaceholderPushed) {
+		//Too deep to open. Its contents become part of whatever's open around it
+		tokenizer->ignoredOpenTags++;
+		PARSE_STATISTICS_ADD(tagsTooDeep, 1);
+		return;
 	}
 	
-	free(displayTextFormat);
+	//No -- so let's fill in the placeholder on top of our stack
+	struct t_tag* formatP = stackItem(&tokenizer->htmlTags, stackSize(&tokenizer->htmlTags) - 1);
+	formatP->kind = kind;
+	formatP->linkURL = kind == TAG_A ? extractLinkURL(tokenizer, tagNameBuffer, tagNameCopyPosition) : NULL;
+	countBlockNesting(tokenizer, kind, 1);
+	PARSE_STATISTICS_ADD(tagsOpened, 1);
+	
+	//Add textual descriptors for order/unordered lists
+	if (kind == TAG_OL) {
+		//Ordered list
+		tokenizer->currentListValue = 1;
+	}else if (kind == TAG_UL) {
+		//Unordered list
+		tokenizer->currentListValue = USHRT_MAX;
+	}else if (kind == TAG_LI) {
+		//Apply current list index. The longest marker is "65535. " plus sprintf's null byte
+		char *displayText = reserveDisplayText(tokenizer, 8);
+		if (tokenizer->currentListValue == USHRT_MAX) {
+			memcpy(displayText, policy->bulletMarker, policy->bulletMarkerLength);
+			tokenizer->textBufferPosition += policy->bulletMarkerLength;
+			tokenizer->stringVisiblePosition += policy->bulletMarkerVisibleLength;
+		}else {
+			int written = sprintf(displayText, "%i. ",tokenizer->currentListValue);
+			tokenizer->textBufferPosition += written;
+			tokenizer->stringVisiblePosition += written;
+			tokenizer->currentListValue++;
+		}
+	}
+}
+
+/**
+ Add a single charachter which has no special meaning to either the tag we're reading or the display text
+ 
+ @param tokenizer The tokenizer
+ @param current The charachter
+ @param policy The rules of the dialect being parsed
+ */
+static ALWAYS_INLINE void appendCharachter(struct t_tokenizer *tokenizer, char current, const struct t_dialect_policy *policy) {
+	if (tokenizer->isInTag) {
+		ensureBufferCapacity(&tokenizer->allocator, &tokenizer->tagNameBuffer, &tokenizer->tagNameCapacity, tokenizer->tagNameCopyPosition + 1);
+		tokenizer->tagNameBuffer[tokenizer->tagNameCopyPosition++] = current;
+	}else {
+		
+		//Don't allow double new lines (thanks redddit for sending these?)
+		//Don't allow just new lines (happens between blockquotes and p tags, again reddit issue)
+		//This messes up quote formatting
+		if (policy->isCollapsingNewLines && current == '\n' && (tokenizer->previous == '\n' || tokenizer->stringVisiblePosition <= 1)) {
+			return;
+		}
+		tokenizer->previous = current;
+		*reserveDisplayText(tokenizer, 1) = current;
+		tokenizer->textBufferPosition++;
+		tokenizer->stringVisiblePosition+=getVisibleByteEffectForCharachter(current);
+		validateUTF8(&tokenizer->utf8Validator, &current, 1);
+	}
+}
+
+/**
+ Decode a complete HTML entity (i.e. "&amp;") into the display text. Entities in tags are left alone until an attribute is read (see extractLinkURL)
+ 
+ @param tokenizer The tokenizer
+ @param entity The entity, including the '&' and ';'
+ @param length The length of entity
+ */
+static void appendHTMLEntity(struct t_tokenizer *tokenizer, const char entity[], size_t length) {
+	//Entities we can't decode are copied over as they are
+	size_t maximumLength = length > HTML_ENTITY_MAX_DECODED_LENGTH ? length : HTML_ENTITY_MAX_DECODED_LENGTH;
+	char *destination = reserveDisplayText(tokenizer, maximumLength);
+	
+	size_t numberDecodedBytes = decode_html_entity_utf8(destination, entity, length);
+	if (numberDecodedBytes == 0) {
+		memcpy(destination, entity, length);
+		numberDecodedBytes = length;
+		PARSE_STATISTICS_ADD(entitiesFailed, 1);
+	}else {
+		PARSE_STATISTICS_ADD(entitiesDecoded, 1);
+	}
+	
+	for (unsigned long decodedI = 0; decodedI < numberDecodedBytes; decodedI++) {
+		//Add the visual effect for each characher. This lets us also handle when decode sends back a tag it can't decode.
+		//Also helpful incase we have codes which decode to multiple charachters, which could happen
+		tokenizer->stringVisiblePosition += getVisibleByteEffectForCharachter(destination[decodedI]);
+	}
+	//Numeric entities can name surrogates, which don't make valid UTF-8
+	validateUTF8(&tokenizer->utf8Validator, destination, numberDecodedBytes);
+	tokenizer->textBufferPosition += numberDecodedBytes;
+}
+
+/**
+ Give up on a partial entity that was held over from the last chunk, it's just text after all
+ 
+ @param tokenizer The tokenizer
+ @param policy The rules of the dialect being parsed
+ */
+static ALWAYS_INLINE void abandonHTMLEntity(struct t_tokenizer *tokenizer, const struct t_dialect_policy *policy) {
+	tokenizer->isInHTMLEntity = false;
+	PARSE_STATISTICS_ADD(entitiesFailed, 1);
+	//Everything after the '&' is alphanumeric (or '#') so it can't mean anything special either
+	for (size_t i = 0; i < tokenizer->htmlEntityCopyPosition; i++) {
+		appendCharachter(tokenizer, tokenizer->htmlEntityBuffer[i], policy);
+	}
+}
+
+/**
+ Continue an entity which was split across chunks
+ 
+ @param tokenizer The tokenizer
+ @param chunk The new chunk
+ @param chunkLength The length of chunk
+ @param policy The rules of the dialect being parsed
+ @return The number of bytes of chunk that were consumed
+ */
+static ALWAYS_INLINE size_t continueHTMLEntity(struct t_tokenizer *tokenizer, const char chunk[], size_t chunkLength, const struct t_dialect_policy *policy) {
+	size_t previousLength = tokenizer->htmlEntityCopyPosition;
+	size_t copyLength = HTML_ENTITY_MAX_LENGTH - previousLength;
+	if (copyLength > chunkLength) {
+		copyLength = chunkLength;
+	}
+	memcpy(&tokenizer->htmlEntityBuffer[previousLength], chunk, copyLength);
+	
+	long entityLength = scan_html_entity(tokenizer->htmlEntityBuffer, previousLength + copyLength);
+	if (entityLength < 0) {
+		//Still can't tell, so this entire chunk belongs to the entity
+		tokenizer->htmlEntityCopyPosition += copyLength;
+		return chunkLength;
+	}else if (entityLength > 0) {
+		tokenizer->isInHTMLEntity = false;
+		appendHTMLEntity(tokenizer, tokenizer->htmlEntityBuffer, entityLength);
+		return entityLength - previousLength;
+	}else {
+		abandonHTMLEntity(tokenizer, policy);
+		return 0;
+	}
+}
+
+/**
+ Copy the run of plain text (if any) at the start of text into the display text
+ 
+ @param tokenizer The tokenizer
+ @param text The text to scan
+ @param length The number of bytes available
+ @return The number of bytes consumed
+ */
+static size_t appendPlainText(struct t_tokenizer *tokenizer, const char text[], size_t length) {
+	int visibleLength = 0;
+	size_t runLength = scanPlainText(text, length, &visibleLength, &tokenizer->utf8Validator);
+	if (runLength == 0) {
+		return 0;
+	}
+	
+	if (runLength >= tokenizer->textBufferCapacity) {
+		//Too big to be worth staging, hand it straight over
+		flushDisplayText(tokenizer);
+		tokenizer->textCallback(tokenizer->callbackContext, text, runLength);
+	}else {
+		memcpy(reserveDisplayText(tokenizer, runLength), text, runLength);
+		tokenizer->textBufferPosition += runLength;
+	}
+	tokenizer->stringVisiblePosition += visibleLength;
+	tokenizer->previous = text[runLength - 1];
+	return runLength;
+}
+
+/**
+ Find the end of the run of tag contents at the start of text, which is either its '>' or a '<' starting another tag
+ 
+ @param text The text to scan
+ @param length The number of bytes available
+ @return The length of the run, length if the chunk ends first
+ */
+static ALWAYS_INLINE size_t scanTagContents(const char text[], size_t length) {
+	size_t i = 0;
+	while (i < length && text[i] != '>' && text[i] != '<') {
+		i++;
+	}
+	return i;
+}
+
+/**
+ Push the placeholder for an opening tag, which is filled in once the tag is complete
+ 
+ @param tokenizer The tokenizer
+ */
+static ALWAYS_INLINE void pushPlaceholderTag(struct t_tokenizer *tokenizer) {
+	struct t_tag format;
+	format.kind = TAG_UNKNOWN;
+	format.linkURL = NULL;
+	format.startPosition = tokenizer->stringVisiblePosition;
+	format.endPosition = 0;
+	//Past STACK_MAXIMUM_DEPTH the tag is dropped instead
+	tokenizer->isPlaceholderPushed = push(&tokenizer->htmlTags, format);
+}
+
+/**
+ The tokenizer's main loop, written once for every dialect. See tokenizeChunk
+ 
+ @param policy The rules of the dialect being parsed, always one of DIALECT_POLICIES so they fold away
+ */
+static ALWAYS_INLINE void tokenizeChunkWithPolicy(struct t_tokenizer *tokenizer, const char chunk[], size_t chunkLength, const struct t_dialect_policy *policy) {
+	size_t i = 0;
+	if (tokenizer->isInHTMLEntity) {
+		i = continueHTMLEntity(tokenizer, chunk, chunkLength, policy);
+	}
+	
+	for (; i < chunkLength; i++) {
+		//Most of a document is plain text, so skip over as much of it as we can in bulk rather than byte by byte
+		if (!tokenizer->isInTag) {
+			i += appendPlainText(tokenizer, &chunk[i], chunkLength - i);
+			if (i >= chunkLength) {
+				break;
+			}
+		}else if (!tokenizer->isTagOpenPending) {
+			//The rest of a tag which started in an earlier chunk, copy as much of it as we have
+			size_t runLength = scanTagContents(&chunk[i], chunkLength - i);
+			ensureBufferCapacity(&tokenizer->allocator, &tokenizer->tagNameBuffer, &tokenizer->tagNameCapacity, tokenizer->tagNameCopyPosition + runLength);
+			memcpy(&tokenizer->tagNameBuffer[tokenizer->tagNameCopyPosition], &chunk[i], runLength);
+			tokenizer->tagNameCopyPosition += runLength;
+			i += runLength;
+			if (i >= chunkLength) {
+				break;
+			}
+		}
+		
+		char current = chunk[i];
+		
+		//If the last charachter was a '<' and we're NOT '/' (i.e. it was an open tag) we want to create a new formatter on the stack
+		if (tokenizer->isTagOpenPending) {
+			tokenizer->isTagOpenPending = false;
+			if (current != '/') {
+				pushPlaceholderTag(tokenizer);
+			}
+		}
+		
+		if (current == '<') {
+			if (tokenizer->isPlaceholderPushed && tokenizer->isInTag) {
+				//The tag we were reading never finished, forget it rather than leave its placeholder open
+				pop(&tokenizer->htmlTags);
+			}
+			tokenizer->isPlaceholderPushed = false;
+			tokenizer->isInTag = true;
+			tokenizer->tagNameCopyPosition = 0;
+			
+			//Most tags are entirely inside the chunk, those are read straight out of it without copying anything
+			size_t tagLength = scanTagContents(&chunk[i + 1], chunkLength - i - 1);
+			if (i + 1 + tagLength < chunkLength && chunk[i + 1 + tagLength] == '>') {
+				if (tagLength == 0 || chunk[i + 1] != '/') {
+					pushPlaceholderTag(tokenizer);
+				}
+				completeTag(tokenizer, policy, &chunk[i + 1], tagLength);
+				i += tagLength + 1;
+			}else {
+				tokenizer->isTagOpenPending = true;
+			}
+		}else if (current == '>') {
+			completeTag(tokenizer, policy, tokenizer->tagNameBuffer, tokenizer->tagNameCopyPosition);
+		}else if (current == '&' && !tokenizer->isInTag) {
+			//We are starting an HTML entitiy. Find where it ends so we can decode it right out of the input
+			long entityLength = scan_html_entity(&chunk[i], chunkLength - i);
+			if (entityLength > 0) {
+				appendHTMLEntity(tokenizer, &chunk[i], entityLength);
+				i += entityLength - 1;
+			}else if (entityLength < 0) {
+				//The chunk ends part way through what may be an entity, hold on to it until the next chunk
+				tokenizer->isInHTMLEntity = true;
+				tokenizer->htmlEntityCopyPosition = chunkLength - i;
+				memcpy(tokenizer->htmlEntityBuffer, &chunk[i], tokenizer->htmlEntityCopyPosition);
+				break;
+			}else {
+				//Not an entity, just a stray '&'
+				appendCharachter(tokenizer, current, policy);
+			}
+		}else {
+			appendCharachter(tokenizer, current, policy);
+		}
+	}
+	
+	flushDisplayText(tokenizer);
+}
+
+//Each dialect's own copy of the tokenizer
+static void tokenizeRedditChunk(struct t_tokenizer *tokenizer, const char chunk[], size_t chunkLength) {
+	tokenizeChunkWithPolicy(tokenizer, chunk, chunkLength, &DIALECT_POLICIES[HTML_DIALECT_REDDIT]);
+}
+
+static void tokenizeGenericChunk(struct t_tokenizer *tokenizer, const char chunk[], size_t chunkLength) {
+	tokenizeChunkWithPolicy(tokenizer, chunk, chunkLength, &DIALECT_POLICIES[HTML_DIALECT_GENERIC]);
+}
+
+/**
+ Tokenize the next chunk of a document. Tags, entities, and list numbering may be split across chunks however you like.
+ All display text and every tag completed by this chunk is handed to the tokenizer's callbacks before this returns.
+ 
+ @param tokenizer The tokenizer created by createTokenizer
+ @param chunk The next bytes of the document
+ @param chunkLength The number of bytes in chunk
+ */
+void tokenizeChunk(struct t_tokenizer *tokenizer, const char chunk[], size_t chunkLength) {
+	PARSE_STATISTICS_START(start);
+	//The dialect is picked once per chunk, never per byte
+	if (tokenizer->dialect == HTML_DIALECT_GENERIC) {
+		tokenizeGenericChunk(tokenizer, chunk, chunkLength);
+	}else {
+		tokenizeRedditChunk(tokenizer, chunk, chunkLength);
+	}
+	PARSE_STATISTICS_ADD(bytesScanned, chunkLength);
+	PARSE_STATISTICS_STOP(start, tokenizeCycles);
+}
+
+/**
+ Finish a streaming tokenization. Unclosed and incomplete (i.e. "blah blah <tag") tags are dropped. The tokenizer is reset afterwards and can be used for another document
+ 
+ @param tokenizer The tokenizer
+ @param numberOfHumanVisibleCharachters (returned) The visible length of all the display text emitted for this document
+ @param isDisplayTextValidUTF8 (returned) If all of that display text is well formed UTF-8. When it isn't, the visible length won't match what NSString makes of it. May be NULL
+ */
+void finishTokenizer(struct t_tokenizer *tokenizer, int* numberOfHumanVisibleCharachters, bool *isDisplayTextValidUTF8) {
+	PARSE_STATISTICS_START(start);
+	//An entity that never finished is just text
+	if (tokenizer->isInHTMLEntity) {
+		abandonHTMLEntity(tokenizer, &DIALECT_POLICIES[tokenizer->dialect]);
+	}
+	flushDisplayText(tokenizer);
+	*numberOfHumanVisibleCharachters = tokenizer->stringVisiblePosition;
+	bool isValid = finishUTF8Validation(&tokenizer->utf8Validator);
+	if (isDisplayTextValidUTF8 != NULL) {
+		*isDisplayTextValidUTF8 = isValid;
+	}
+	resetTokenizer(tokenizer);
+	PARSE_STATISTICS_STOP(start, tokenizeCycles);
+}
+
+/**
+ If tags of a kind do nothing in makeAttributesLinear
+ */
+static bool isUnstyledTagKind(enum t_tag_kind kind) {
+	switch (kind) {
+		case TAG_STRONG:
+		case TAG_EM:
+		case TAG_DEL:
+		case TAG_CODE:
+		case TAG_BLOCKQUOTE:
+		case TAG_SUP:
+		case TAG_H1:
+		case TAG_H2:
+		case TAG_H3:
+		case TAG_H4:
+		case TAG_H5:
+		case TAG_H6:
+		case TAG_A:
+		case TAG_OL:
+		case TAG_UL:
+			return false;
+		default:
+			return true;
+	}
+}
+
+/**
+ Capture the tokenizer's state so tokenizing can later be restarted from this point. Only works between blocks: right after a chunk which ended outside
+ of any tag or entity, with nothing but unstyled tags which aren't blocks open (so everything the document has produced so far is final)
+ 
+ @param tokenizer The tokenizer
+ @param checkpoint (returned) The state
+ @return false if the tokenizer isn't somewhere it can be restarted from
+ */
+bool saveTokenizerCheckpoint(struct t_tokenizer *tokenizer, struct t_tokenizer_checkpoint *checkpoint) {
+	if (tokenizer->isInTag || tokenizer->isTagOpenPending || tokenizer->isInHTMLEntity) {
+		return false;
+	}
+	int numberOfOpenTags = stackSize(&tokenizer->htmlTags);
+	if (numberOfOpenTags > TOKENIZER_CHECKPOINT_MAX_OPEN_TAGS) {
+		return false;
+	}
+	for (int i = 0; i < numberOfOpenTags; i++) {
+		unsigned char kind = stackItem(&tokenizer->htmlTags, i)->kind;
+		//Blocks need their real start position when they close, which a restored tag doesn't have
+		if (!isUnstyledTagKind(kind) || isBlockTagKind(kind)) {
+			return false;
+		}
+		checkpoint->openTagKinds[i] = kind;
+	}
+	checkpoint->numberOfOpenTags = numberOfOpenTags;
+	checkpoint->stringVisiblePosition = tokenizer->stringVisiblePosition;
+	checkpoint->previous = tokenizer->previous;
+	checkpoint->currentListValue = tokenizer->currentListValue;
+	checkpoint->utf8Validator = tokenizer->utf8Validator;
+	return true;
+}
+
+/**
+ Put a tokenizer back into a state captured by saveTokenizerCheckpoint, dropping whatever it was in the middle of
+ 
+ @param tokenizer The tokenizer
+ @param checkpoint The state. A zeroed checkpoint is the start of a document
+ */
+void restoreTokenizerCheckpoint(struct t_tokenizer *tokenizer, const struct t_tokenizer_checkpoint *checkpoint) {
+	resetTokenizer(tokenizer);
+	for (int i = 0; i < checkpoint->numberOfOpenTags; i++) {
+		//Unstyled tags are ignored once closed, so where they started doesn't matter
+		struct t_tag format;
+		format.kind = checkpoint->openTagKinds[i];
+		format.linkURL = NULL;
+		format.startPosition = 0;
+		format.endPosition = 0;
+		push(&tokenizer->htmlTags, format);
+		countBlockNesting(tokenizer, format.kind, 1);
+	}
+	tokenizer->stringVisiblePosition = checkpoint->stringVisiblePosition;
+	tokenizer->previous = checkpoint->previous;
+	tokenizer->currentListValue = checkpoint->currentListValue;
+	tokenizer->utf8Validator = checkpoint->utf8Validator;
+}
+
+/**
+ If tokenizing from two checkpoints gives the same results, apart from being shifted by the difference in their visible positions
+ */
+bool isSameTokenizerCheckpoint(const struct t_tokenizer_checkpoint *a, const struct t_tokenizer_checkpoint *b) {
+	if (a->numberOfOpenTags != b->numberOfOpenTags || memcmp(a->openTagKinds, b->openTagKinds, a->numberOfOpenTags) != 0) {
+		return false;
+	}
+	//The visible position and the previous charachter only decide whether Reddit new lines are dropped. That tests for a position of at most 1,
+	//which 0 and 1 still pass after one more charachter, so only positions of 2 or more are interchangeable
+	int positionA = a->stringVisiblePosition < 2 ? a->stringVisiblePosition : 2;
+	int positionB = b->stringVisiblePosition < 2 ? b->stringVisiblePosition : 2;
+	if (positionA != positionB || (a->previous == '\n') != (b->previous == '\n')) {
+		return false;
+	}
+	if (a->currentListValue != b->currentListValue) {
+		return false;
+	}
+	const struct t_utf8_validator *validatorA = &a->utf8Validator;
+	const struct t_utf8_validator *validatorB = &b->utf8Validator;
+	if (validatorA->isInvalid != validatorB->isInvalid || validatorA->pendingContinuations != validatorB->pendingContinuations) {
+		return false;
+	}
+	//The allowed range is left over from the last charachter unless we're part way through one
+	return validatorA->pendingContinuations == 0 || (validatorA->nextMinimum == validatorB->nextMinimum && validatorA->nextMaximum == validatorB->nextMaximum);
+}
+
+/**
+ Output position for tokenizeHTML, which collects the streaming tokenizer's output into flat arrays
+ */
+struct t_array_output {
+	char *displayText;
+	size_t stringCopyPosition;
+	struct t_tag *completedTags;
+	int completedTagsPosition;
+	//NULL unless the caller wants blocks
+	struct t_block *blocks;
+	int blocksPosition;
+};
+
+static void appendTextToArray(void *context, const char text[], size_t length) {
+	struct t_array_output *output = context;
+	memcpy(&output->displayText[output->stringCopyPosition], text, length);
+	output->stringCopyPosition += length;
+}
+
+static void appendTagToArray(void *context, struct t_tag tag) {
+	struct t_array_output *output = context;
+	output->completedTags[output->completedTagsPosition++] = tag;
+}
+
+static void appendBlockToArray(void *context, struct t_block block) {
+	struct t_array_output *output = context;
+	output->blocks[output->blocksPosition++] = block;
+}
+
+static void tokenizeHTMLToArrays(char input[],size_t inputLength,char displayText[], struct t_tag completedTags[], int* numberOfTags, int* numberOfHumanVisibleCharachters, struct t_block blocks[], int* numberOfBlocks, const struct t_allocator *allocator) {
+	struct t_array_output output;
+	output.displayText = displayText;
+	output.stringCopyPosition = 0;
+	output.completedTags = completedTags;
+	output.completedTagsPosition = 0;
+	output.blocks = blocks;
+	output.blocksPosition = 0;
+	
+	struct t_tokenizer *tokenizer = createTokenizer(allocator, appendTextToArray, appendTagToArray, &output);
+	if (blocks != NULL) {
+		setTokenizerBlockCallback(tokenizer, appendBlockToArray);
+	}
+	tokenizeChunk(tokenizer, input, inputLength);
+	finishTokenizer(tokenizer, numberOfHumanVisibleCharachters, NULL);
+	freeTokenizer(tokenizer);
+	
+	//and now terminate our output.
+	displayText[output.stringCopyPosition] = 0x00;
+	*numberOfTags = output.completedTagsPosition;
+	if (numberOfBlocks != NULL) {
+		*numberOfBlocks = output.blocksPosition;
+	}
+}
+
+/**
+ Tockenize and extract tag info from the input and then output the cleaned string alongisde a tag array with relevant position info
+ 
+ @param input Input text as a char array
+ @param inputLength The number of charachters (as bytes) to read, excluding the null byte!
+ @param displayText The char array to write the clean, display text to
+ @param completedTags (returned) The array to write the t_format structs to (provides position and tag info). Tags positions are CHARACHTER relative, not byte relative! Usable in NSAttributedString etc
+ Needs room for maximumNumberOfTags(input, inputLength) tags, or use tokenizeHTMLToVector and let it grow as needed
+ @param numberOfTags (returned) The number of tags discovered
+ */
+void tokenizeHTML(char input[],size_t inputLength,char displayText[], struct t_tag completedTags[], int* numberOfTags, int* numberOfHumanVisibleCharachters) {
+	tokenizeHTMLWithAllocator(input, inputLength, displayText, completedTags, numberOfTags, numberOfHumanVisibleCharachters, &mallocAllocator);
+}
+
+/**
+ tokenizeHTML, but with the scratch space and tag names allocated from allocator. The tag names in completedTags must be released through the same allocator (makeAttributesLinearWithAllocator does this)
+ */
+void tokenizeHTMLWithAllocator(char input[],size_t inputLength,char displayText[], struct t_tag completedTags[], int* numberOfTags, int* numberOfHumanVisibleCharachters, const struct t_allocator *allocator) {
+	tokenizeHTMLToArrays(input, inputLength, displayText, completedTags, numberOfTags, numberOfHumanVisibleCharachters, NULL, NULL, allocator);
+}
+
+/**
+ tokenizeHTML, which also fills in a table of the document's blocks as it goes so paragraph level attributes can be applied once per block
+ 
+ @param blocks (returned) The blocks, in the order they were closed. Needs room for maximumNumberOfTags(input, inputLength) blocks
+ @param numberOfBlocks (returned) The number of blocks
+ */
+void tokenizeHTMLWithBlocks(char input[],size_t inputLength,char displayText[], struct t_tag completedTags[], int* numberOfTags, int* numberOfHumanVisibleCharachters, struct t_block blocks[], int* numberOfBlocks) {
+	tokenizeHTMLToArrays(input, inputLength, displayText, completedTags, numberOfTags, numberOfHumanVisibleCharachters, blocks, numberOfBlocks, &mallocAllocator);
+}
+
+/**
+ An upper bound on the number of tags tokenizeHTML can find in the input. Every tag needs its own '<', apart from the inline styles reopened
+ after a misnested closing tag, of which each closing tag makes at most MAXIMUM_REOPENED_TAGS
+ 
+ @param input The HTML
+ @param inputLength The length of input in bytes
+ @return The bound
+ */
+int maximumNumberOfTags(const char input[], size_t inputLength) {
+	int count = 0;
+	const char *end = input + inputLength;
+	const char *position = input;
+	while (position < end && (position = memchr(position, '<', end - position)) != NULL) {
+		count++;
+		position++;
+		if (position < end && *position == '/') {
+			count += MAXIMUM_REOPENED_TAGS;
+		}
+	}
+	return count;
+}
+
+/**
+ Display text being compacted into the same buffer it's being read from. Text which would overtake what the tokenizer has read so far waits in carry until there's room
+ */
+struct t_in_place_output {
+	char *buffer;
+	size_t writePosition;
+	//Everything before this has been read and may be overwritten
+	size_t readLimit;
+	char *carry;
+	size_t carryLength;
+	size_t carryCapacity;
+	const struct t_allocator *allocator;
+};
+
+//How much input tokenizeInPlace hands the tokenizer at once. A slice's display text always fits in the staging buffer, so the tokenizer only
+//calls back once it has read the whole slice and everything before readLimit really is free
+#define IN_PLACE_SLICE_SIZE (TOKENIZER_TEXT_BUFFER_SIZE / 4)
+
+/**
+ Move as much carried text into the buffer as there is room for
+ */
+static void drainInPlaceCarry(struct t_in_place_output *output) {
+	size_t room = output->readLimit - output->writePosition;
+	size_t length = output->carryLength < room ? output->carryLength : room;
+	memcpy(&output->buffer[output->writePosition], output->carry, length);
+	output->writePosition += length;
+	output->carryLength -= length;
+	memmove(output->carry, &output->carry[length], output->carryLength);
+}
+
+static void appendTextInPlace(struct t_in_place_output *output, const char text[], size_t length) {
+	if (output->carryLength > 0) {
+		drainInPlaceCarry(output);
+	}
+	//Text has to stay in order, so nothing goes straight in while some is still carried
+	size_t room = output->carryLength == 0 ? output->readLimit - output->writePosition : 0;
+	size_t directLength = length < room ? length : room;
+	//text may be the input itself
+	memmove(&output->buffer[output->writePosition], text, directLength);
+	output->writePosition += directLength;
+	if (directLength < length) {
+		ensureBufferCapacity(output->allocator, &output->carry, &output->carryCapacity, output->carryLength + length - directLength);
+		memcpy(&output->carry[output->carryLength], &text[directLength], length - directLength);
+		output->carryLength += length - directLength;
+	}
+}
+
+/**
+ Tokenize a whole document whose display text is going into the document's own buffer. The tokenizer's text callback must end up in appendTextInPlace with output
+ 
+ @param tokenizer The tokenizer
+ @param output The output, with buffer set to the document. Afterwards readLimit is the end of the document and some text may still be carried
+ @param inputLength The length of the document
+ @param numberOfHumanVisibleCharachters (returned) See finishTokenizer
+ @param isDisplayTextValidUTF8 (returned) See finishTokenizer
+ */
+static void tokenizeInPlace(struct t_tokenizer *tokenizer, struct t_in_place_output *output, size_t inputLength, int* numberOfHumanVisibleCharachters, bool *isDisplayTextValidUTF8) {
+	output->writePosition = 0;
+	output->carryLength = 0;
+	for (size_t sliceStart = 0; sliceStart < inputLength; sliceStart += IN_PLACE_SLICE_SIZE) {
+		size_t sliceLength = inputLength - sliceStart < IN_PLACE_SLICE_SIZE ? inputLength - sliceStart : IN_PLACE_SLICE_SIZE;
+		output->readLimit = sliceStart + sliceLength;
+		tokenizeChunk(tokenizer, &output->buffer[sliceStart], sliceLength);
+	}
+	output->readLimit = inputLength;
+	finishTokenizer(tokenizer, numberOfHumanVisibleCharachters, isDisplayTextValidUTF8);
+}
+
+/**
+ Output position for tokenizeHTMLInPlace
+ */
+struct t_in_place_array_output {
+	struct t_in_place_output text;
+	struct t_tag *completedTags;
+	int completedTagsPosition;
+};
+
+static void appendTextToInPlaceArray(void *context, const char text[], size_t length) {
+	struct t_in_place_array_output *output = context;
+	appendTextInPlace(&output->text, text, length);
+}
+
+static void appendTagToInPlaceArray(void *context, struct t_tag tag) {
+	struct t_in_place_array_output *output = context;
+	output->completedTags[output->completedTagsPosition++] = tag;
+}
+
+/**
+ tokenizeHTML, but the display text is compacted into the input buffer itself instead of a second buffer of the same size.
+ Markup always takes up at least as many bytes as the text it turns into, apart from list markers ("65535. " from "<li>") which have to wait
+ in a small side buffer whenever they'd overtake the input which hasn't been read yet
+ 
+ @param buffer The HTML. Overwritten with the null terminated display text
+ @param inputLength The length of the HTML, excluding the null byte!
+ @param bufferCapacity The size of buffer, at least inputLength + 1
+ @param displayTextLength (returned) The length of the display text
+ @param completedTags (returned) See tokenizeHTML
+ @param numberOfTags (returned) The number of tags discovered
+ @param numberOfHumanVisibleCharachters (returned) The visible length of the display text
+ @return false if the display text was longer than bufferCapacity allows (a long list with next to no other markup), leaving buffer with neither the HTML nor the display text. The tags are still returned and need releasing
+ */
+bool tokenizeHTMLInPlace(char buffer[], size_t inputLength, size_t bufferCapacity, size_t *displayTextLength, struct t_tag completedTags[], int* numberOfTags, int* numberOfHumanVisibleCharachters) {
+	struct t_in_place_array_output output;
+	output.text.buffer = buffer;
+	output.text.carry = NULL;
+	output.text.carryCapacity = 0;
+	output.text.allocator = &mallocAllocator;
+	output.completedTags = completedTags;
+	output.completedTagsPosition = 0;
+	
+	struct t_tokenizer *tokenizer = createTokenizer(&mallocAllocator, appendTextToInPlaceArray, appendTagToInPlaceArray, &output);
+	tokenizeInPlace(tokenizer, &output.text, inputLength, numberOfHumanVisibleCharachters, NULL);
+	freeTokenizer(tokenizer);
+	
+	//Whatever is left over can use the rest of the buffer now, except for the null byte
+	output.text.readLimit = bufferCapacity - 1;
+	if (output.text.carryLength > 0) {
+		drainInPlaceCarry(&output.text);
+	}
+	bool isComplete = output.text.carryLength == 0;
+	free(output.text.carry);
+	
+	buffer[output.text.writePosition] = 0x00;
+	*displayTextLength = output.text.writePosition;
+	*numberOfTags = output.completedTagsPosition;
+	return isComplete;
+}
+
+/**
+ Output position for tokenizeHTMLToVector
+ */
+struct t_vector_output {
+	char *displayText;
+	size_t stringCopyPosition;
+	struct t_tag_vector *tags;
+	const struct t_allocator *allocator;
+};
+
+static void appendTextToVectorOutput(void *context, const char text[], size_t length) {
+	struct t_vector_output *output = context;
+	memcpy(&output->displayText[output->stringCopyPosition], text, length);
+	output->stringCopyPosition += length;
+}
+
+static void appendTagToVector(void *context, struct t_tag tag) {
+	struct t_vector_output *output = context;
+	struct t_tag_vector *tags = output->tags;
+	ensureArrayCapacity(output->allocator, (void **)&tags->tags, &tags->capacity, tags->numberOfTags + 1, sizeof(struct t_tag));
+	tags->tags[tags->numberOfTags++] = tag;
+}
+
+/**
+ tokenizeHTML, but the tags are collected into a vector which grows with the number of tags found instead of needing room for the worst case up front
+ 
+ @param input Input text as a char array
+ @param inputLength The number of charachters (as bytes) to read, excluding the null byte!
+ @param displayText The char array to write the clean, display text to
+ @param tags (returned) Replaced with the tags found. Start from a zeroed vector; reusing a vector reuses its storage. Release with freeTagVector
+ @param numberOfHumanVisibleCharachters (returned) The visible length of the display text
+ @param allocator Where the scratch space, the vector and the link URLs are allocated from. NULL uses malloc
+ */
+void tokenizeHTMLToVector(const char input[], size_t inputLength, char displayText[], struct t_tag_vector *tags, int* numberOfHumanVisibleCharachters, const struct t_allocator *allocator) {
+	if (allocator == NULL) {
+		allocator = &mallocAllocator;
+	}
+	struct t_vector_output output;
+	output.displayText = displayText;
+	output.stringCopyPosition = 0;
+	output.tags = tags;
+	output.allocator = allocator;
+	tags->numberOfTags = 0;
+	
+	struct t_tokenizer *tokenizer = createTokenizer(allocator, appendTextToVectorOutput, appendTagToVector, &output);
+	tokenizeChunk(tokenizer, input, inputLength);
+	finishTokenizer(tokenizer, numberOfHumanVisibleCharachters, NULL);
+	freeTokenizer(tokenizer);
+	
+	displayText[output.stringCopyPosition] = 0x00;
+}
+
+/**
+ Release a tag vector along with any link URLs still held by its tags
+ 
+ @param tags The vector. Left empty and ready for reuse
+ @param allocator The allocator given to tokenizeHTMLToVector
+ */
+void freeTagVector(struct t_tag_vector *tags, const struct t_allocator *allocator) {
+	if (allocator == NULL) {
+		allocator = &mallocAllocator;
+	}
+	for (int i = 0; i < tags->numberOfTags; i++) {
+		freeTagLinkURL(allocator, &tags->tags[i]);
+	}
+	allocatorDeallocate(allocator, tags->tags, tags->capacity * sizeof(struct t_tag));
+	tags->tags = NULL;
+	tags->numberOfTags = 0;
+	tags->capacity = 0;
+}
+
+
+void print_t_format(struct t_format format) {
+	printf("Format [%i,%i): Bold %i, Italic %i, Struck %i, Code %i, Exponent %i, Quote %i, H%i, ListNest %i Link %u\n",format.startPosition,format.endPosition,formatIsBold(format),formatIsItalics(format),formatIsStruck(format),formatIsCode(format),formatExponentLevel(format),formatQuoteLevel(format),formatHLevel(format),formatListNestLevel(format),formatLinkID(format));
+}
+
+
+/**
+ Compare two t_formats. Returns 0 for the same, 1 if different in anyway
+ 
+ @param format1 The first t_format struct
+ @param format2 The second t_format struct
+ @return 0 or 1
+ */
+int t_format_cmp(struct t_format format1,struct t_format format2) {
+	//Everything but the range is packed into style, links included (as IDs)
+	return format1.style != format2.style;
+}
+
+
+/**
+ The kinds of formatting a tag can apply over its range
+ */
+enum t_attribute_kind {
+	ATTRIBUTE_BOLD,
+	ATTRIBUTE_ITALICS,
+	ATTRIBUTE_STRUCK,
+	ATTRIBUTE_CODE,
+	ATTRIBUTE_QUOTE,
+	ATTRIBUTE_EXPONENT,
+	ATTRIBUTE_LIST,
+	ATTRIBUTE_HEADER,
+	ATTRIBUTE_LINK,
+	ATTRIBUTE_KIND_COUNT
+};
+
+/**
+ A recognized tag, clamped to the display text
+ */
+struct t_attribute {
+	unsigned int startPosition;
+	unsigned int endPosition;
+	enum t_attribute_kind kind;
+	unsigned char hLevel;
+	//Index into the link table plus one, for ATTRIBUTE_LINK
+	unsigned int linkID;
+};
+
+/**
+ Where an attribute starts or stops applying
+ */
+struct t_boundary {
+	unsigned int position;
+	int attributeIndex;
+	bool isEnd;
+};
+
+static int t_boundary_cmp(const void *a, const void *b) {
+	const struct t_boundary *boundary1 = a;
+	const struct t_boundary *boundary2 = b;
+	if (boundary1->position != boundary2->position) {
+		return boundary1->position < boundary2->position ? -1 : 1;
+	}
+	return boundary1->attributeIndex - boundary2->attributeIndex;
+}
+
+/**
+ Push onto a max heap of attribute indices. Headers and links don't nest like the counters do, the most recently completed tag wins, so we keep the active ones ordered by their index
+ */
+static void attributeHeapPush(int heap[], int *heapSize, int attributeIndex) {
+	int child = (*heapSize)++;
+	while (child > 0) {
+		int parent = (child - 1) / 2;
+		if (heap[parent] >= attributeIndex) {
+			break;
+		}
+		heap[child] = heap[parent];
+		child = parent;
+	}
+	heap[child] = attributeIndex;
+}
+
+static void attributeHeapPop(int heap[], int *heapSize) {
+	int last = heap[--(*heapSize)];
+	int parent = 0;
+	while (true) {
+		int child = parent * 2 + 1;
+		if (child >= *heapSize) {
+			break;
+		}
+		if (child + 1 < *heapSize && heap[child + 1] > heap[child]) {
+			child++;
+		}
+		if (heap[child] <= last) {
+			break;
+		}
+		heap[parent] = heap[child];
+		parent = child;
+	}
+	if (*heapSize > 0) {
+		heap[parent] = last;
+	}
+}
+
+/**
+ Get the most recent attribute on a heap which still applies at position, discarding any which have ended
+ 
+ @return The attribute index or -1 if none are active
+ */
+static int activeAttribute(int heap[], int *heapSize, struct t_attribute attributes[], unsigned int position) {
+	while (*heapSize > 0 && attributes[heap[0]].endPosition <= position) {
+		attributeHeapPop(heap, heapSize);
+	}
+	return *heapSize > 0 ? heap[0] : -1;
+}
+
+/**
+ Scratch space for makeAttributesLinear. It only ever grows so it can be kept around and reused for the next document
+ */
+struct t_linear_scratch {
+	const struct t_allocator *allocator;
+	struct t_attribute *attributes;
+	size_t attributesCapacity;
+	//boundaries and sortBuffer always have the same capacity
+	struct t_boundary *boundaries;
+	struct t_boundary *sortBuffer;
+	size_t boundariesCapacity;
+	//headerHeap and linkHeap always have the same capacity
+	int *headerHeap;
+	int *linkHeap;
+	size_t heapCapacity;
+	//Open addressing table of link IDs (zero is empty) used to intern link URLs. Only the first linkSlotsMask + 1 slots are in use
+	unsigned int *linkSlots;
+	size_t linkSlotsCapacity;
+	size_t linkSlotsMask;
+};
+
+static void reserveLinearScratch(struct t_linear_scratch *scratch, size_t numberOfTags) {
+	const struct t_allocator *allocator = scratch->allocator;
+	size_t required = numberOfTags > 0 ? numberOfTags : 1;
+	ensureArrayCapacity(allocator, (void **)&scratch->attributes, &scratch->attributesCapacity, required, sizeof(struct t_attribute));
+	
+	size_t heapCapacity = scratch->heapCapacity;
+	ensureArrayCapacity(allocator, (void **)&scratch->headerHeap, &scratch->heapCapacity, required, sizeof(int));
+	ensureArrayCapacity(allocator, (void **)&scratch->linkHeap, &heapCapacity, required, sizeof(int));
+	
+	size_t boundariesCapacity = scratch->boundariesCapacity;
+	ensureArrayCapacity(allocator, (void **)&scratch->boundaries, &scratch->boundariesCapacity, required * 2, sizeof(struct t_boundary));
+	ensureArrayCapacity(allocator, (void **)&scratch->sortBuffer, &boundariesCapacity, required * 2, sizeof(struct t_boundary));
+}
+
+static void freeLinearScratch(struct t_linear_scratch *scratch) {
+	const struct t_allocator *allocator = scratch->allocator;
+	allocatorDeallocate(allocator, scratch->sortBuffer, scratch->boundariesCapacity * sizeof(struct t_boundary));
+	allocatorDeallocate(allocator, scratch->boundaries, scratch->boundariesCapacity * sizeof(struct t_boundary));
+	allocatorDeallocate(allocator, scratch->linkSlots, scratch->linkSlotsCapacity * sizeof(unsigned int));
+	allocatorDeallocate(allocator, scratch->linkHeap, scratch->heapCapacity * sizeof(int));
+	allocatorDeallocate(allocator, scratch->headerHeap, scratch->heapCapacity * sizeof(int));
+	allocatorDeallocate(allocator, scratch->attributes, scratch->attributesCapacity * sizeof(struct t_attribute));
+}
+
+/**
+ Sort boundaries with a bottom up merge sort. Unlike qsort this never allocates behind our back
+ 
+ @param boundaries The boundaries to sort
+ @param sortBuffer Scratch space for at least numberOfBoundaries boundaries
+ @param numberOfBoundaries The number of boundaries
+ @return Whichever of boundaries or sortBuffer ended up holding the sorted boundaries
+ */
+static struct t_boundary* sortBoundaries(struct t_boundary boundaries[], struct t_boundary sortBuffer[], int numberOfBoundaries) {
+	struct t_boundary *source = boundaries;
+	struct t_boundary *destination = sortBuffer;
+	for (int width = 1; width < numberOfBoundaries; width *= 2) {
+		for (int left = 0; left < numberOfBoundaries; left += width * 2) {
+			int middle = left + width < numberOfBoundaries ? left + width : numberOfBoundaries;
+			int right = left + width * 2 < numberOfBoundaries ? left + width * 2 : numberOfBoundaries;
+			int i = left, j = middle, k = left;
+			while (i < middle && j < right) {
+				destination[k++] = t_boundary_cmp(&source[j], &source[i]) < 0 ? source[j++] : source[i++];
+			}
+			while (i < middle) {
+				destination[k++] = source[i++];
+			}
+			while (j < right) {
+				destination[k++] = source[j++];
+			}
+		}
+		struct t_boundary *swap = source;
+		source = destination;
+		destination = swap;
+	}
+	return source;
+}
+
+/**
+ Commit a finished run to the output
+ */
+static void commitRun(struct t_format format, unsigned int startPosition, unsigned int endPosition, struct t_format simplifiedTags[], int* numberOfSimplifiedTags) {
+	format.startPosition = startPosition;
+	format.endPosition = endPosition;
+	print_t_format(format);
+	simplifiedTags[*numberOfSimplifiedTags] = format;
+	*numberOfSimplifiedTags+=1;
+	PARSE_STATISTICS_ADD(runsEmitted, 1);
+}
+
+static uint32_t hashLinkURL(const char linkURL[], size_t length) {
+	//FNV-1a
+	uint32_t hash = 2166136261u;
+	for (size_t i = 0; i < length; i++) {
+		hash = (hash ^ (unsigned char)linkURL[i]) * 16777619u;
+	}
+	return hash;
+}
+
+static unsigned int* findLinkSlot(struct t_linear_scratch *scratch, const struct t_link_table *links, const char linkURL[], size_t length) {
+	size_t slot = hashLinkURL(linkURL, length) & scratch->linkSlotsMask;
+	while (scratch->linkSlots[slot] != 0) {
+		const char *existing = linkTableURL(links, scratch->linkSlots[slot]);
+		if (strncmp(existing, linkURL, length) == 0 && existing[length] == 0x00) {
+			break;
+		}
+		slot = (slot + 1) & scratch->linkSlotsMask;
+	}
+	return &scratch->linkSlots[slot];
+}
+
+/**
+ Get the interning table ready for a document with up to numberOfNewLinks more links than are already in the link table
+ */
+static void prepareLinkSlots(struct t_linear_scratch *scratch, const struct t_link_table *links, size_t numberOfNewLinks) {
+	//Keep the table at most half full
+	size_t numberOfSlots = 16;
+	while (numberOfSlots < (links->numberOfLinks + numberOfNewLinks) * 2) {
+		numberOfSlots *= 2;
+	}
+	ensureArrayCapacity(scratch->allocator, (void **)&scratch->linkSlots, &scratch->linkSlotsCapacity, numberOfSlots, sizeof(unsigned int));
+	scratch->linkSlotsMask = numberOfSlots - 1;
+	memset(scratch->linkSlots, 0, numberOfSlots * sizeof(unsigned int));
+	
+	//Links already in the table are shared too
+	for (int i = 0; i < links->numberOfLinks; i++) {
+		const char *linkURL = links->linkText + links->linkOffsets[i];
+		*findLinkSlot(scratch, links, linkURL, strlen(linkURL)) = i + 1;
+	}
+}
+
+/**
+ Add a link to a link table, reusing the existing entry if the same URL is already there. prepareLinkSlots must have been called first
+ 
+ @param linkURL The link's URL, which is copied
+ @return The link's ID
+ */
+static unsigned int internLink(struct t_linear_scratch *scratch, struct t_link_table *links, const char linkURL[], const struct t_allocator *allocator) {
+	size_t length = strlen(linkURL);
+	unsigned int *slot = findLinkSlot(scratch, links, linkURL, length);
+	if (*slot != 0) {
+		return *slot;
+	}
+	
+	ensureBufferCapacity(allocator, &links->linkText, &links->linkTextCapacity, links->linkTextLength + length + 1);
+	ensureArrayCapacity(allocator, (void **)&links->linkOffsets, &links->capacity, links->numberOfLinks + 1, sizeof(size_t));
+	memcpy(&links->linkText[links->linkTextLength], linkURL, length + 1);
+	links->linkOffsets[links->numberOfLinks++] = links->linkTextLength;
+	links->linkTextLength += length + 1;
+	*slot = links->numberOfLinks;
+	return *slot;
+}
+
+/**
+ Pack a level into the bits of a style word, saturating rather than spilling into the next field
+ */
+static uint64_t styleLevel(int level, int shift) {
+	return (uint64_t)(level < T_FORMAT_MAX_LEVEL ? level : T_FORMAT_MAX_LEVEL) << shift;
+}
+
+/**
+ Takes in overlapping t_format tags and simplifies them into 1D range suitable for use in NSAttributedString. Destroys inputTags in the process!
+ 
+ @param inputTags Overlapping tags buffer (given by tokenizeHTML)
+ @param numberOfInputTags The number of inputTags
+ @param simplifiedTags (return) Simplified tags buffer (return value). Needs room for maximumNumberOfLinearFormats(numberOfInputTags, displayTextLength) formats
+ @param numberOfSimplifiedTags (return) the number of found simplified tags
+ @param displayTextLength The size of the text that we will be applying these tags to
+ @param links (return) The links the simplified tags refer to by ID, each unique URL stored once. Start from a zeroed table and release with freeLinkTable
+ */
+void makeAttributesLinear(struct t_tag inputTags[], int numberOfInputTags, struct t_format simplifiedTags[], int* numberOfSimplifiedTags, int displayTextLength, struct t_link_table *links) {
+	makeAttributesLinearWithAllocator(inputTags, numberOfInputTags, simplifiedTags, numberOfSimplifiedTags, displayTextLength, links, &mallocAllocator);
+}
+
+/**
+ The sweep behind makeAttributesLinear. See makeAttributesLinearWithAllocator
+ 
+ @param scratch Scratch space, grown if needed. The link table grows from the same allocator
+ @param links Where the link URLs of recognized links are interned. Anything already in it is kept and shared
+ @param linkAllocator The allocator inputTags' link URLs came from, used to release them. NULL leaves them to whoever else has the same tags
+ */
+static void linearizeTags(struct t_linear_scratch *scratch, struct t_tag inputTags[], int numberOfInputTags, struct t_format simplifiedTags[], int* numberOfSimplifiedTags, int displayTextLength, struct t_link_table *links, const struct t_allocator *linkAllocator) {
+	PARSE_STATISTICS_START(start);
+	*numberOfSimplifiedTags = 0;
+	unsigned int textLength = displayTextLength > 0 ? (unsigned int)displayTextLength : 0;
+	
+	reserveLinearScratch(scratch, numberOfInputTags);
+	struct t_attribute *attributes = scratch->attributes;
+	int numberOfAttributes = 0;
+	bool isLinkSlotsReady = false;
+	
+	//Work out what each tag does
+	for (int i = 0; i < numberOfInputTags; i++) {
+		struct t_tag tag = inputTags[i];
+		struct t_attribute attribute;
+		attribute.hLevel = 0;
+		attribute.linkID = 0;
+		
+		bool isRecognized = true;
+		switch (tag.kind) {
+			case TAG_STRONG:
+				attribute.kind = ATTRIBUTE_BOLD;
+				break;
+			case TAG_EM:
+				attribute.kind = ATTRIBUTE_ITALICS;
+				break;
+			case TAG_DEL:
+				attribute.kind = ATTRIBUTE_STRUCK;
+				break;
+			case TAG_CODE:
+				attribute.kind = ATTRIBUTE_CODE;
+				break;
+			case TAG_BLOCKQUOTE:
+				attribute.kind = ATTRIBUTE_QUOTE;
+				break;
+			case TAG_SUP:
+				attribute.kind = ATTRIBUTE_EXPONENT;
+				break;
+			case TAG_H1:
+			case TAG_H2:
+			case TAG_H3:
+			case TAG_H4:
+			case TAG_H5:
+			case TAG_H6:
+				attribute.kind = ATTRIBUTE_HEADER;
+				attribute.hLevel = tag.kind - TAG_H1 + 1;
+				break;
+			case TAG_A:
+				attribute.kind = ATTRIBUTE_LINK;
+				//Only links we could extract a URL from do anything
+				isRecognized = tag.linkURL != NULL;
+				break;
+			case TAG_OL:
+			case TAG_UL:
+				attribute.kind = ATTRIBUTE_LIST;
+				break;
+			default:
+				printf("Unknown tag: %i\n",tag.kind);
+				PARSE_STATISTICS_ADD(tagsUnrecognized, 1);
+				isRecognized = false;
+				break;
+		}
+		
+		//Tags which cover no text can't change anything
+		attribute.startPosition = tag.startPosition;
+		attribute.endPosition = tag.endPosition < textLength ? tag.endPosition : textLength;
+		if (isRecognized && attribute.startPosition < attribute.endPosition) {
+			if (attribute.kind == ATTRIBUTE_LINK) {
+				if (!isLinkSlotsReady) {
+					prepareLinkSlots(scratch, links, numberOfInputTags - i);
+					isLinkSlotsReady = true;
+				}
+				attribute.linkID = internLink(scratch, links, tag.linkURL, scratch->allocator);
+			}
+			attributes[numberOfAttributes++] = attribute;
+		}
+		//Destroy inputTags data as warned
+		if (linkAllocator != NULL) {
+			freeTagLinkURL(linkAllocator, &tag);
+		}
+		inputTags[i].linkURL = NULL;
+	}
+	
+	//Every attribute has a start and an end boundary
+	struct t_boundary *boundaries = scratch->boundaries;
+	int numberOfBoundaries = 0;
+	for (int i = 0; i < numberOfAttributes; i++) {
+		struct t_boundary start = {attributes[i].startPosition, i, false};
+		struct t_boundary end = {attributes[i].endPosition, i, true};
+		boundaries[numberOfBoundaries++] = start;
+		boundaries[numberOfBoundaries++] = end;
+	}
+	boundaries = sortBoundaries(boundaries, scratch->sortBuffer, numberOfBoundaries);
+	
+	//Active state
+	int activeCounts[ATTRIBUTE_KIND_COUNT] = {0};
+	int *headerHeap = scratch->headerHeap;
+	int headerHeapSize = 0;
+	int *linkHeap = scratch->linkHeap;
+	int linkHeapSize = 0;
+	
+	//Now sweep through the boundaries, simplifying to a 1D
+	struct t_format activeStyle;
+	memset(&activeStyle, 0, sizeof(struct t_format));
+	unsigned int activeStyleStart = 0;
+	int b = 0;
+	while (b < numberOfBoundaries) {
+		unsigned int position = boundaries[b].position;
+		if (position >= textLength) {
+			//Everything from here on is an end boundary at the end of the text
+			break;
+		}
+		
+		for (; b < numberOfBoundaries && boundaries[b].position == position; b++) {
+			struct t_attribute *attribute = &attributes[boundaries[b].attributeIndex];
+			if (attribute->kind == ATTRIBUTE_HEADER) {
+				//Ended headers and links are dropped lazily by activeAttribute
+				if (!boundaries[b].isEnd) {
+					attributeHeapPush(headerHeap, &headerHeapSize, boundaries[b].attributeIndex);
+				}
+			}else if (attribute->kind == ATTRIBUTE_LINK) {
+				if (!boundaries[b].isEnd) {
+					attributeHeapPush(linkHeap, &linkHeapSize, boundaries[b].attributeIndex);
+				}
+			}else {
+				activeCounts[attribute->kind] += boundaries[b].isEnd ? -1 : 1;
+			}
+		}
+		
+		struct t_format style;
+		memset(&style, 0, sizeof(struct t_format));
+		if (activeCounts[ATTRIBUTE_BOLD] > 0) {
+			style.style |= T_FORMAT_BOLD;
+		}
+		if (activeCounts[ATTRIBUTE_ITALICS] > 0) {
+			style.style |= T_FORMAT_ITALICS;
+		}
+		if (activeCounts[ATTRIBUTE_STRUCK] > 0) {
+			style.style |= T_FORMAT_STRUCK;
+		}
+		if (activeCounts[ATTRIBUTE_CODE] > 0) {
+			style.style |= T_FORMAT_CODE;
+		}
+		style.style |= styleLevel(activeCounts[ATTRIBUTE_EXPONENT], T_FORMAT_EXPONENT_LEVEL_SHIFT);
+		style.style |= styleLevel(activeCounts[ATTRIBUTE_QUOTE], T_FORMAT_QUOTE_LEVEL_SHIFT);
+		style.style |= styleLevel(activeCounts[ATTRIBUTE_LIST], T_FORMAT_LIST_NEST_LEVEL_SHIFT);
+		int header = activeAttribute(headerHeap, &headerHeapSize, attributes, position);
+		if (header >= 0) {
+			style.style |= (uint64_t)attributes[header].hLevel << T_FORMAT_H_LEVEL_SHIFT;
+		}
+		int link = activeAttribute(linkHeap, &linkHeapSize, attributes, position);
+		if (link >= 0) {
+			style.style |= (uint64_t)attributes[link].linkID << T_FORMAT_LINK_ID_SHIFT;
+		}
+		
+		if (t_format_cmp(activeStyle, style) != 0) {
+			//We're different, so commit our previous style (with start and ends) and adopt the current one
+			if (position > activeStyleStart) {
+				commitRun(activeStyle, activeStyleStart, position, simplifiedTags, numberOfSimplifiedTags);
+			}
+			activeStyle = style;
+			activeStyleStart = position;
+		}
+	}
+	
+	//and commit the final style
+	//We need to make sure we have displayed text otherwise we over/underflow here
+	if (textLength > 0) {
+		commitRun(activeStyle, activeStyleStart, textLength, simplifiedTags, numberOfSimplifiedTags);
+	}
+	PARSE_STATISTICS_STOP(start, linearizeCycles);
+}
+
+/**
+ makeAttributesLinear, but with all scratch space and the link table allocated from allocator. inputTags must have come from the same allocator.
+ When allocator is an arena the whole result can be released by resetting the arena instead of calling freeLinkTable
+ 
+ Rather than painting every charachter, this sorts the start and end of every tag and sweeps over them keeping count of what's active.
+ This takes O(tags log tags + runs) time and memory proportional to the number of tags, no matter how long the text is or how deeply things nest
+ */
+void makeAttributesLinearWithAllocator(struct t_tag inputTags[], int numberOfInputTags, struct t_format simplifiedTags[], int* numberOfSimplifiedTags, int displayTextLength, struct t_link_table *links, const struct t_allocator *allocator) {
+	struct t_linear_scratch scratch;
+	memset(&scratch, 0, sizeof(struct t_linear_scratch));
+	scratch.allocator = allocator;
+	linearizeTags(&scratch, inputTags, numberOfInputTags, simplifiedTags, numberOfSimplifiedTags, displayTextLength, links, allocator);
+	freeLinearScratch(&scratch);
+}
+
+/**
+ Release a link table
+ 
+ @param links The table. Left empty and ready for reuse
+ @param allocator The allocator given to makeAttributesLinear. NULL for malloc
+ */
+void freeLinkTable(struct t_link_table *links, const struct t_allocator *allocator) {
+	if (allocator == NULL) {
+		allocator = &mallocAllocator;
+	}
+	allocatorDeallocate(allocator, links->linkText, links->linkTextCapacity);
+	allocatorDeallocate(allocator, links->linkOffsets, links->capacity * sizeof(size_t));
+	memset(links, 0, sizeof(struct t_link_table));
+}
+
+/**
+ An upper bound on the number of formats makeAttributesLinear can produce. Runs only change where a tag starts or ends so there are at most two per tag plus one, and there are never more runs than charachters
+ 
+ @param numberOfTags The number of tags going in
+ @param displayTextLength The visible length of the display text
+ @return The bound (at least one, so it's always safe to allocate)
+ */
+int maximumNumberOfLinearFormats(int numberOfTags, int displayTextLength) {
+	long long maximum = (long long)numberOfTags * 2 + 1;
+	if (displayTextLength < maximum) {
+		maximum = displayTextLength;
+	}
+	return maximum > 0 ? (int)maximum : 1;
+}
+
+/**
+ makeAttributesLinear, but writing into a vector sized by the number of tags rather than the length of the text
+ 
+ @param inputTags Overlapping tags (given by tokenizeHTMLToVector). Destroyed in the process!
+ @param numberOfInputTags The number of inputTags
+ @param simplifiedTags (returned) Replaced with the linear formats. Start from a zeroed vector; reusing a vector reuses its storage. Release with freeFormatVector
+ @param displayTextLength The visible length of the display text
+ @param links (returned) The links the formats refer to. Start from a zeroed table and release with freeLinkTable
+ @param allocator The allocator inputTags came from, also used for the vector, the link table and scratch space. NULL uses malloc
+ */
+void makeAttributesLinearToVector(struct t_tag inputTags[], int numberOfInputTags, struct t_format_vector *simplifiedTags, int displayTextLength, struct t_link_table *links, const struct t_allocator *allocator) {
+	if (allocator == NULL) {
+		allocator = &mallocAllocator;
+	}
+	ensureArrayCapacity(allocator, (void **)&simplifiedTags->formats, &simplifiedTags->capacity, maximumNumberOfLinearFormats(numberOfInputTags, displayTextLength), sizeof(struct t_format));
+	makeAttributesLinearWithAllocator(inputTags, numberOfInputTags, simplifiedTags->formats, &simplifiedTags->numberOfFormats, displayTextLength, links, allocator);
+}
+
+/**
+ Release a format vector
+ 
+ @param formats The vector. Left empty and ready for reuse
+ @param allocator The allocator given to makeAttributesLinearToVector
+ */
+void freeFormatVector(struct t_format_vector *formats, const struct t_allocator *allocator) {
+	if (allocator == NULL) {
+		allocator = &mallocAllocator;
+	}
+	allocatorDeallocate(allocator, formats->formats, formats->capacity * sizeof(struct t_format));
+	formats->formats = NULL;
+	formats->numberOfFormats = 0;
+	formats->capacity = 0;
+}
+
+
+//Block size for the arena holding a parser context's link URLs
+#define PARSER_CONTEXT_LINK_ARENA_SIZE (16 * 1024)
+//The least a preview with a visible budget hands the tokenizer at once, so markup heavy HTML isn't fed through a byte at a time as the budget runs out
+#define PREVIEW_MINIMUM_CHUNK 256
+
+/**
+ Everything needed to parse one document after another without going back to the heap. All storage only ever grows, so once the context has seen a document as large as the current one parsing allocates nothing
+ */
+struct t_parser_context {
+	struct t_tokenizer *tokenizer;
+	//Link URLs of the current document's tags until they're interned. Reset between documents, which keeps its blocks around
+	struct t_arena *linkArena;
+	
+	char *displayText;
+	size_t displayTextLength;
+	size_t displayTextCapacity;
+	
+	struct t_tag_vector tags;
+	struct t_format_vector formats;
+	struct t_block *blocks;
+	int numberOfBlocks;
+	size_t blocksCapacity;
+	//Grow-only, emptied between documents
+	struct t_link_table links;
+	
+	struct t_linear_scratch linearScratch;
+	
+	//Used by parseHTMLInPlaceWithContext. Only its carry space lasts between documents
+	struct t_in_place_output inPlace;
+	
+	//Only filled in when isBuildingUTF16Index is set
+	bool isBuildingUTF16Index;
+	uint32_t *utf16Checkpoints;
+	size_t utf16CheckpointsCapacity;
+	
+	//The document parsePreviewWithContext is part way through, NULL when there isn't one. Not copied, so it has to outlive the preview
+	const char *previewInput;
+	size_t previewInputLength;
+	size_t previewInputPosition;
+	enum t_preview_budget_unit previewUnit;
+	//The cut down copies a preview's results are made from
+	char *previewDisplayText;
+	size_t previewDisplayTextCapacity;
+	struct t_tag_vector previewTags;
+	struct t_block *previewBlocks;
+	size_t previewBlocksCapacity;
+	
+	//Set once finishParse has handed out results. The next chunk starts a new document
+	bool isFinished;
+};
+
+static void collectContextDisplayText(void *callbackContext, const char text[], size_t length) {
+	struct t_parser_context *context = callbackContext;
+	//+1 so there's always room for the null byte
+	ensureBufferCapacity(&mallocAllocator, &context->displayText, &context->displayTextCapacity, context->displayTextLength + length + 1);
+	memcpy(&context->displayText[context->displayTextLength], text, length);
+	context->displayTextLength += length;
+}
+
+static void collectContextDisplayTextInPlace(void *callbackContext, const char text[], size_t length) {
+	struct t_parser_context *context = callbackContext;
+	appendTextInPlace(&context->inPlace, text, length);
+}
+
+static void collectContextTag(void *callbackContext, struct t_tag tag) {
+	struct t_parser_context *context = callbackContext;
+	struct t_tag_vector *tags = &context->tags;
+	ensureArrayCapacity(&mallocAllocator, (void **)&tags->tags, &tags->capacity, tags->numberOfTags + 1, sizeof(struct t_tag));
+	tags->tags[tags->numberOfTags++] = tag;
+}
+
+static void collectContextBlock(void *callbackContext, struct t_block block) {
+	struct t_parser_context *context = callbackContext;
+	ensureArrayCapacity(&mallocAllocator, (void **)&context->blocks, &context->blocksCapacity, context->numberOfBlocks + 1, sizeof(struct t_block));
+	context->blocks[context->numberOfBlocks++] = block;
+}
+
+/**
+ Create a reusable parser context. A context is not thread safe, but any number of them can be used on different threads at once
+ 
+ @return The context. Release with freeParserContext
+ */
+struct t_parser_context* createParserContext(void) {
+	struct t_parser_context *context = calloc(1, sizeof(struct t_parser_context));
+	context->linkArena = createArena(PARSER_CONTEXT_LINK_ARENA_SIZE);
+	context->tokenizer = createTokenizer(&mallocAllocator, collectContextDisplayText, collectContextTag, context);
+	setTokenizerBlockCallback(context->tokenizer, collectContextBlock);
+	//Links only need to live as long as the document's results
+	context->tokenizer->linkAllocator = arenaAllocator(context->linkArena);
+	context->linearScratch.allocator = &mallocAllocator;
+	context->inPlace.allocator = &mallocAllocator;
+	
+	context->displayTextCapacity = TOKENIZER_TEXT_BUFFER_SIZE;
+	context->displayText = malloc(context->displayTextCapacity);
+	context->tags.capacity = 64;
+	context->tags.tags = malloc(context->tags.capacity * sizeof(struct t_tag));
+	context->formats.capacity = 64;
+	context->formats.formats = malloc(context->formats.capacity * sizeof(struct t_format));
+	return context;
+}
+
+/**
+ Throw away the previous document's results so we can start on a new one
+ */
+static void startNewDocument(struct t_parser_context *context) {
+	resetArena(context->linkArena);
+	context->displayTextLength = 0;
+	context->tags.numberOfTags = 0;
+	context->numberOfBlocks = 0;
+	context->links.linkTextLength = 0;
+	context->links.numberOfLinks = 0;
+	context->previewInput = NULL;
+	context->isFinished = false;
+}
+
+/**
+ Throw away a preview which was never parsed to the end, along with everything the tokenizer was keeping for it
+ */
+static void abandonPreview(struct t_parser_context *context) {
+	if (context->previewInput != NULL) {
+		resetTokenizer(context->tokenizer);
+		startNewDocument(context);
+	}
+}
+
+/**
+ Feed the next chunk of a document to the context. Starting a new document invalidates the results of the previous one
+ 
+ @param context The context
+ @param chunk The next bytes of the document. Chunks may split tags, entities and multibyte charachters anywhere
+ @param chunkLength The length of chunk
+ */
+void parseChunk(struct t_parser_context *context, const char chunk[], size_t chunkLength) {
+	abandonPreview(context);
+	if (context->isFinished) {
+		startNewDocument(context);
+	}
+	tokenizeChunk(context->tokenizer, chunk, chunkLength);
+}
+
+/**
+ Linearize a document's tags and fill in its results
+ 
+ @param tags The tags, which are used up
+ @param linkAllocator Where the tags' link URLs came from, or NULL if something else still needs them
+ @param blocks The document's blocks
+ @param displayText The document's null terminated display text, wherever it ended up
+ */
+static void describeDocument(struct t_parser_context *context, struct t_tag tags[], int numberOfTags, const struct t_allocator *linkAllocator, const struct t_block blocks[], int numberOfBlocks, const char *displayText, size_t displayTextLength, int numberOfHumanVisibleCharachters, bool isValidUTF8, struct t_parsed_document *result) {
+	struct t_format_vector *formats = &context->formats;
+	ensureArrayCapacity(&mallocAllocator, (void **)&formats->formats, &formats->capacity, maximumNumberOfLinearFormats(numberOfTags, numberOfHumanVisibleCharachters), sizeof(struct t_format));
+	linearizeTags(&context->linearScratch, tags, numberOfTags, formats->formats, &formats->numberOfFormats, numberOfHumanVisibleCharachters, &context->links, linkAllocator);
+	
+	result->displayText = displayText;
+	result->displayTextLength = displayTextLength;
+	result->numberOfHumanVisibleCharachters = numberOfHumanVisibleCharachters;
+	result->formats = formats->formats;
+	result->numberOfFormats = formats->numberOfFormats;
+	result->links = context->links;
+	result->isValidUTF8 = isValidUTF8;
+	result->blocks = blocks;
+	result->numberOfBlocks = numberOfBlocks;
+	result->utf16Checkpoints = NULL;
+	result->numberOfUTF16Checkpoints = 0;
+	if (context->isBuildingUTF16Index) {
+		size_t numberOfCheckpoints = numberOfUTF16Checkpoints(displayTextLength);
+		ensureArrayCapacity(&mallocAllocator, (void **)&context->utf16Checkpoints, &context->utf16CheckpointsCapacity, numberOfCheckpoints, sizeof(uint32_t));
+		buildUTF16Checkpoints(displayText, displayTextLength, context->utf16Checkpoints);
+		result->utf16Checkpoints = context->utf16Checkpoints;
+		result->numberOfUTF16Checkpoints = numberOfCheckpoints;
+	}
+}
+
+/**
+ Linearize the current document's tags and fill in its results
+ 
+ @param displayText The document's null terminated display text, wherever it ended up
+ */
+static void completeDocument(struct t_parser_context *context, const char *displayText, size_t displayTextLength, int numberOfHumanVisibleCharachters, bool isValidUTF8, struct t_parsed_document *result) {
+	struct t_allocator linkAllocator = arenaAllocator(context->linkArena);
+	describeDocument(context, context->tags.tags, context->tags.numberOfTags, &linkAllocator, context->blocks, context->numberOfBlocks, displayText, displayTextLength, numberOfHumanVisibleCharachters, isValidUTF8, result);
+	context->isFinished = true;
+}
+
+/**
+ Finish the current document and get its results
+ 
+ @param context The context
+ @param result (returned) The display text and linear formats. These belong to the context and are valid until the next document is started or the context is released
+ */
+void finishParse(struct t_parser_context *context, struct t_parsed_document *result) {
+	abandonPreview(context);
+	if (context->isFinished) {
+		//An empty document
+		startNewDocument(context);
+	}
+	int numberOfHumanVisibleCharachters = 0;
+	bool isValidUTF8 = false;
+	finishTokenizer(context->tokenizer, &numberOfHumanVisibleCharachters, &isValidUTF8);
+	ensureBufferCapacity(&mallocAllocator, &context->displayText, &context->displayTextCapacity, context->displayTextLength + 1);
+	context->displayText[context->displayTextLength] = 0x00;
+	completeDocument(context, context->displayText, context->displayTextLength, numberOfHumanVisibleCharachters, isValidUTF8, result);
+}
+
+/**
+ Parse a whole document with a reusable context
+ 
+ @param context The context
+ @param input The HTML
+ @param inputLength The length of input in bytes, excluding any null byte
+ @param result (returned) The display text and linear formats, see finishParse
+ */
+void parseHTMLWithContext(struct t_parser_context *context, const char input[], size_t inputLength, struct t_parsed_document *result) {
+	parseChunk(context, input, inputLength);
+	finishParse(context, result);
+}
+
+/**
+ parseHTMLWithContext, but the display text is compacted into the input buffer itself (see tokenizeHTMLInPlace) rather than copied into the context.
+ Can't be used part way through a document started with parseChunk
+ 
+ @param context The context
+ @param input The HTML, with room for inputLength + 1 bytes. Overwritten with the display text
+ @param inputLength The length of input in bytes, excluding any null byte
+ @param result (returned) The display text and linear formats, see finishParse. The display text is normally in input, but if it came out longer than the HTML it's in the context instead
+ */
+void parseHTMLInPlaceWithContext(struct t_parser_context *context, char input[], size_t inputLength, struct t_parsed_document *result) {
+	abandonPreview(context);
+	if (context->isFinished) {
+		startNewDocument(context);
+	}
+	struct t_in_place_output *output = &context->inPlace;
+	output->buffer = input;
+	context->tokenizer->textCallback = collectContextDisplayTextInPlace;
+	int numberOfHumanVisibleCharachters = 0;
+	bool isValidUTF8 = false;
+	tokenizeInPlace(context->tokenizer, output, inputLength, &numberOfHumanVisibleCharachters, &isValidUTF8);
+	context->tokenizer->textCallback = collectContextDisplayText;
+	
+	if (output->carryLength == 0) {
+		input[output->writePosition] = 0x00;
+		completeDocument(context, input, output->writePosition, numberOfHumanVisibleCharachters, isValidUTF8, result);
+	}else {
+		//Doesn't fit, so the whole thing moves into the context
+		size_t length = output->writePosition + output->carryLength;
+		ensureBufferCapacity(&mallocAllocator, &context->displayText, &context->displayTextCapacity, length + 1);
+		memcpy(context->displayText, input, output->writePosition);
+		memcpy(&context->displayText[output->writePosition], output->carry, output->carryLength);
+		context->displayText[length] = 0x00;
+		context->displayTextLength = length;
+		completeDocument(context, context->displayText, length, numberOfHumanVisibleCharachters, isValidUTF8, result);
+	}
+	output->buffer = NULL;
+}
+
+/**
+ Fill in a preview's results from everything tokenized so far, cut off at a visible position. Tags still open there end at the cut
+ 
+ @param context The context
+ @param cut Where to cut, at most the tokenizer's visible position. Moved back rather than split a charachter
+ @param result (returned) The results
+ */
+static void cutPreview(struct t_parser_context *context, unsigned int cut, struct t_parsed_document *result) {
+	struct t_tokenizer *tokenizer = context->tokenizer;
+	//The tokenizer may have gone past the cut by up to a chunk, walk back to it
+	size_t displayTextLength = context->displayTextLength;
+	unsigned int position = tokenizer->stringVisiblePosition;
+	while (position > cut && displayTextLength > 0) {
+		displayTextLength--;
+		position -= getVisibleByteEffectForCharachter(context->displayText[displayTextLength]);
+	}
+	if (displayTextLength == context->displayTextLength && tokenizer->utf8Validator.pendingContinuations > 0) {
+		//The input ran out part way through a charachter, leave all of it out
+		while (displayTextLength > 0 && ((unsigned char)context->displayText[displayTextLength - 1] & 0xC0) == 0x80) {
+			displayTextLength--;
+		}
+		if (displayTextLength > 0) {
+			displayTextLength--;
+			position -= getVisibleByteEffectForCharachter(context->displayText[displayTextLength]);
+		}
+	}
+	cut = position;
+	
+	ensureBufferCapacity(&mallocAllocator, &context->previewDisplayText, &context->previewDisplayTextCapacity, displayTextLength + 1);
+	memcpy(context->previewDisplayText, context->displayText, displayTextLength);
+	context->previewDisplayText[displayTextLength] = 0x00;
+	
+	//Everything which starts before the cut, ending there at the latest. The tags themselves are still needed once the preview is extended
+	int numberOfOpenTags = stackSize(&tokenizer->htmlTags);
+	struct t_tag_vector *tags = &context->previewTags;
+	ensureArrayCapacity(&mallocAllocator, (void **)&tags->tags, &tags->capacity, context->tags.numberOfTags + numberOfOpenTags, sizeof(struct t_tag));
+	ensureArrayCapacity(&mallocAllocator, (void **)&context->previewBlocks, &context->previewBlocksCapacity, context->numberOfBlocks + numberOfOpenTags, sizeof(struct t_block));
+	tags->numberOfTags = 0;
+	for (int i = 0; i < context->tags.numberOfTags; i++) {
+		struct t_tag tag = context->tags.tags[i];
+		if (tag.startPosition < cut) {
+			tag.endPosition = tag.endPosition < cut ? tag.endPosition : cut;
+			tags->tags[tags->numberOfTags++] = tag;
+		}
+	}
+	int numberOfBlocks = 0;
+	for (int i = 0; i < context->numberOfBlocks; i++) {
+		struct t_block block = context->blocks[i];
+		if (block.startPosition < cut) {
+			block.endPosition = block.endPosition < cut ? block.endPosition : cut;
+			context->previewBlocks[numberOfBlocks++] = block;
+		}
+	}
+	//Then the tags still open, innermost first as though they were all closed at the cut
+	unsigned int quoteDepth = tokenizer->quoteDepth;
+	unsigned int listDepth = tokenizer->listDepth;
+	for (int i = numberOfOpenTags - 1; i >= 0; i--) {
+		struct t_tag tag = *stackItem(&tokenizer->htmlTags, i);
+		if (tag.kind == TAG_OL || tag.kind == TAG_UL) {
+			listDepth--;
+		}
+		//Placeholders for tags we're part way through reading are left out
+		if (tag.kind != TAG_UNKNOWN && tag.startPosition < cut) {
+			tag.endPosition = cut;
+			tags->tags[tags->numberOfTags++] = tag;
+			if (isBlockTagKind(tag.kind)) {
+				context->previewBlocks[numberOfBlocks++] = blockForTag(&tag, quoteDepth, listDepth);
+			}
+		}
+		if (tag.kind == TAG_BLOCKQUOTE) {
+			quoteDepth--;
+		}
+	}
+	
+	//Links are interned again from scratch each time
+	context->links.linkTextLength = 0;
+	context->links.numberOfLinks = 0;
+	describeDocument(context, tags->tags, tags->numberOfTags, NULL, context->previewBlocks, numberOfBlocks, context->previewDisplayText, displayTextLength, cut, !tokenizer->utf8Validator.isInvalid, result);
+}
+
+/**
+ Start parsing a document for a preview (i.e. a collapsed comment), stopping once a budget is used up. Costs about as much as the budget rather than the document
+ 
+ @param context The context. It keeps its place in the document so the preview can be extended later, until it's used for something else
+ @param input The HTML. Not copied, so it has to stay around until the preview is extended to the end or the context moves on
+ @param inputLength The length of input in bytes, excluding any null byte
+ @param unit What the budget counts
+ @param budget How much of the document to parse
+ @param result (returned) The display text, linear formats and blocks up to the cut, with any tags still open there ending at it. See finishParse
+ @return If the document was cut short. If it wasn't, the result is the same as parseHTMLWithContext's and the context is done with the document
+ */
+bool parsePreviewWithContext(struct t_parser_context *context, const char input[], size_t inputLength, enum t_preview_budget_unit unit, size_t budget, struct t_parsed_document *result) {
+	abandonPreview(context);
+	if (context->isFinished) {
+		startNewDocument(context);
+	}
+	context->previewInput = input;
+	context->previewInputLength = inputLength;
+	context->previewInputPosition = 0;
+	context->previewUnit = unit;
+	return extendPreviewWithContext(context, budget, result);
+}
+
+/**
+ Parse more of a document started by parsePreviewWithContext, i.e. once a collapsed comment is expanded. Picks up where the last preview stopped
+ 
+ @param context The context, still on the previewed document
+ @param budget The new budget, in the preview's unit. SIZE_MAX parses the rest of the document
+ @param result (returned) See parsePreviewWithContext. The previous preview's results are no longer valid
+ @return If the document was cut short. Always false when the context has no preview in progress, in which case result is left alone
+ */
+bool extendPreviewWithContext(struct t_parser_context *context, size_t budget, struct t_parsed_document *result) {
+	if (context->previewInput == NULL) {
+		return false;
+	}
+	struct t_tokenizer *tokenizer = context->tokenizer;
+	bool isCountingBytes = context->previewUnit == PREVIEW_BUDGET_INPUT_BYTES;
+	while (context->previewInputPosition < context->previewInputLength) {
+		size_t used = isCountingBytes ? context->previewInputPosition : (size_t)tokenizer->stringVisiblePosition;
+		if (used >= budget) {
+			break;
+		}
+		//Every byte of HTML is at most one visible charachter (a list marker aside), so this rarely overshoots by much
+		size_t chunkLength = budget - used;
+		if (!isCountingBytes && chunkLength < PREVIEW_MINIMUM_CHUNK) {
+			chunkLength = PREVIEW_MINIMUM_CHUNK;
+		}
+		size_t remainingLength = context->previewInputLength - context->previewInputPosition;
+		if (chunkLength > remainingLength) {
+			chunkLength = remainingLength;
+		}
+		tokenizeChunk(tokenizer, &context->previewInput[context->previewInputPosition], chunkLength);
+		context->previewInputPosition += chunkLength;
+	}
+	
+	if (context->previewInputPosition == context->previewInputLength && (isCountingBytes || (size_t)tokenizer->stringVisiblePosition <= budget)) {
+		//It all fit, so this is a regular parse. Earlier previews may have interned links this one doesn't need any more
+		context->previewInput = NULL;
+		context->links.linkTextLength = 0;
+		context->links.numberOfLinks = 0;
+		finishParse(context, result);
+		return false;
+	}
+	cutPreview(context, isCountingBytes ? (unsigned int)tokenizer->stringVisiblePosition : (unsigned int)budget, result);
+	return true;
+}
+
+/**
+ Choose the dialect of HTML this context parses. Reddit's is the default. Only change it between documents
+ 
+ @param context The context
+ @param dialect The dialect
+ */
+void setParserContextDialect(struct t_parser_context *context, enum t_html_dialect dialect) {
+	setTokenizerDialect(context->tokenizer, dialect);
+}
+
+/**
+ Choose whether results from this context come with a UTF-16 offset index (see utf16OffsetForByteOffset). Off by default
+ 
+ @param context The context
+ @param isBuildingUTF16Index If the index should be built, which costs one extra pass over the display text
+ */
+void setParserContextBuildsUTF16Index(struct t_parser_context *context, bool isBuildingUTF16Index) {
+	context->isBuildingUTF16Index = isBuildingUTF16Index;
+}
+
+void freeParserContext(struct t_parser_context *context) {
+	freeTokenizer(context->tokenizer);
+	freeArena(context->linkArena);
+	freeLinearScratch(&context->linearScratch);
+	freeLinkTable(&context->links, NULL);
+	free(context->inPlace.carry);
+	free(context->utf16Checkpoints);
+	free(context->previewDisplayText);
+	free(context->previewTags.tags);
+	free(context->previewBlocks);
+	free(context->blocks);
+	free(context->formats.formats);
+	free(context->tags.tags);
+	free(context->displayText);
+	free(context);
+}
+
+/**
+ How many bytes packParsedDocument needs for a document. Always a multiple of the strictest alignment so documents can be packed back to back
+ */
+size_t packedDocumentSize(const struct t_parsed_document *document) {
+	size_t size = document->numberOfFormats * sizeof(struct t_format);
+	size += document->links.numberOfLinks * sizeof(size_t);
+	size += document->numberOfUTF16Checkpoints * sizeof(uint32_t);
+	size += document->numberOfBlocks * sizeof(struct t_block);
+	size += document->displayTextLength + 1 + document->links.linkTextLength;
+	return (size + sizeof(max_align_t) - 1) / sizeof(max_align_t) * sizeof(max_align_t);
+}
+
+/**
+ Copy a parsed document into storage the caller owns, i.e. to keep a parser context's results past its next document
+ 
+ @param source The document to copy
+ @param destination (returned) The copy, pointing into storage
+ @param storage Where to put everything source points at. Needs packedDocumentSize(source) bytes, aligned like malloc's
+ */
+void packParsedDocument(const struct t_parsed_document *source, struct t_parsed_document *destination, void *storage) {
+	*destination = *source;
+	//Largest alignment first so nothing needs padding: [formats][link offsets][checkpoints][blocks][display text][link text]
+	struct t_format *formats = storage;
+	size_t *linkOffsets = (size_t *)(formats + source->numberOfFormats);
+	uint32_t *checkpoints = (uint32_t *)(linkOffsets + source->links.numberOfLinks);
+	struct t_block *blocks = (struct t_block *)(checkpoints + source->numberOfUTF16Checkpoints);
+	char *text = (char *)(blocks + source->numberOfBlocks);
+	
+	//Formats refer to links by ID so they can be copied as they are
+	memcpy(formats, source->formats, source->numberOfFormats * sizeof(struct t_format));
+	destination->formats = formats;
+	
+	memcpy(text, source->displayText, source->displayTextLength + 1);
+	destination->displayText = text;
+	text += source->displayTextLength + 1;
+	
+	//Offsets are relative to the link text so the table moves in two copies
+	const struct t_link_table *links = &source->links;
+	if (links->numberOfLinks > 0) {
+		memcpy(text, links->linkText, links->linkTextLength);
+		memcpy(linkOffsets, links->linkOffsets, links->numberOfLinks * sizeof(size_t));
+	}
+	destination->links.linkText = text;
+	destination->links.linkTextCapacity = links->linkTextLength;
+	destination->links.linkOffsets = linkOffsets;
+	destination->links.capacity = links->numberOfLinks;
+	
+	if (source->utf16Checkpoints != NULL) {
+		memcpy(checkpoints, source->utf16Checkpoints, source->numberOfUTF16Checkpoints * sizeof(uint32_t));
+		destination->utf16Checkpoints = checkpoints;
+	}
+	
+	if (source->numberOfBlocks > 0) {
+		memcpy(blocks, source->blocks, source->numberOfBlocks * sizeof(struct t_block));
+	}
+	destination->blocks = blocks;
+}
+
+/**
+ Map a byte offset in a document's display text to the NSString (UTF-16) offset of the same spot. O(1) with the document's UTF-16 index, a scan of the text without
+ 
+ @param document The document
+ @param byteOffset The byte offset, at most displayTextLength
+ @return The UTF-16 offset
+ */
+unsigned int utf16OffsetForByteOffset(const struct t_parsed_document *document, size_t byteOffset) {
+	if (document->utf16Checkpoints == NULL) {
+		return (unsigned int)countUTF16Units(document->displayText, byteOffset);
+	}
+	size_t checkpoint = byteOffset / UTF16_CHECKPOINT_INTERVAL;
+	size_t checkpointOffset = checkpoint * UTF16_CHECKPOINT_INTERVAL;
+	return document->utf16Checkpoints[checkpoint] + (unsigned int)countUTF16Units(&document->displayText[checkpointOffset], byteOffset - checkpointOffset);
+}
+
+/**
+ Map an NSString (UTF-16) offset, i.e. a format's start or end, to the byte offset in a document's display text where that charachter starts.
+ O(log(length / UTF16_CHECKPOINT_INTERVAL)) with the document's UTF-16 index, a scan of the text without
+ 
+ @param document The document
+ @param utf16Offset The UTF-16 offset. One which falls between the two halves of a surrogate pair maps to the start of the pair
+ @return The byte offset, displayTextLength if utf16Offset is at or past the end
+ */
+size_t byteOffsetForUTF16Offset(const struct t_parsed_document *document, unsigned int utf16Offset) {
+	size_t position = 0;
+	unsigned int units = 0;
+	if (document->utf16Checkpoints != NULL) {
+		//Find the last checkpoint at or before the offset
+		size_t low = 0;
+		size_t high = document->numberOfUTF16Checkpoints;
+		while (high - low > 1) {
+			size_t middle = (low + high) / 2;
+			if (document->utf16Checkpoints[middle] <= utf16Offset) {
+				low = middle;
+			}else {
+				high = middle;
+			}
+		}
+		position = low * UTF16_CHECKPOINT_INTERVAL;
+		units = document->utf16Checkpoints[low];
+		//The checkpoint may land inside a charachter, whose units were counted at its lead byte
+		while (position < document->displayTextLength && (document->displayText[position] & 0xC0) == 0x80) {
+			position++;
+		}
+	}
+	
+	while (position < document->displayTextLength) {
+		int charachterUnits = getVisibleByteEffectForCharachter(document->displayText[position]);
+		if (units + charachterUnits > utf16Offset) {
+			break;
+		}
+		units += charachterUnits;
+		position++;
+		//Skip the rest of the charachter
+		while (position < document->displayTextLength && (document->displayText[position] & 0xC0) == 0x80) {
+			position++;
+		}
+	}
+	return position;
 }
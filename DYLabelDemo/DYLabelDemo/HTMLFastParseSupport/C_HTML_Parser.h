@@ -12,8 +12,160 @@
 #include <stdio.h>
 #include "t_tag.h"
 #include "t_format.h"
+#include "Allocator.h"
+#include "TextScan.h"
+
+/**
+ Called by the streaming tokenizer with display text as soon as it's final. Text is handed over in order and the pointer is only valid for the duration of the call
+ */
+typedef void (*t_tokenizer_text_callback)(void *context, const char text[], size_t length);
+/**
+ Called by the streaming tokenizer each time a tag is completed. Ownership of tag.tag passes to the callee
+ */
+typedef void (*t_tokenizer_tag_callback)(void *context, struct t_tag tag);
+
+/**
+ A block of the display text: a paragraph, quote, list item, heading or preformatted text
+ */
+struct t_block {
+	//The block's range, charachter (UTF-16) relative like tags
+	unsigned int startPosition;
+	unsigned int endPosition;
+	//TAG_P, TAG_BLOCKQUOTE, TAG_LI, TAG_H1-6 or TAG_PRE (a t_tag_kind)
+	unsigned char kind;
+	//How many quotes and lists the block is in, counting itself. Capped at UCHAR_MAX
+	unsigned char quoteDepth;
+	unsigned char listDepth;
+};
+
+/**
+ Called by the streaming tokenizer each time a block is closed, so blocks come after any blocks nested in them
+ */
+typedef void (*t_tokenizer_block_callback)(void *context, struct t_block block);
+
+/**
+ The flavours of HTML the parser understands. Each gets its own specialized tokenizer, and any tokenizer or context can switch between them per document
+ */
+enum t_html_dialect {
+	//Reddit's body_html. Runs of new lines are collapsed and <br/> is dropped since Reddit follows it with a new line anyway
+	HTML_DIALECT_REDDIT = 0,
+	//Generic sanitized HTML. New lines are kept, <br> becomes a new line and <b>, <i>, <s> and <strike> are styled like their semantic counterparts
+	HTML_DIALECT_GENERIC,
+	HTML_DIALECT_COUNT
+};
+
+struct t_tokenizer;
+struct t_tokenizer* createTokenizer(const struct t_allocator *allocator, t_tokenizer_text_callback textCallback, t_tokenizer_tag_callback tagCallback, void *callbackContext);
+void setTokenizerDialect(struct t_tokenizer *tokenizer, enum t_html_dialect dialect);
+void setTokenizerBlockCallback(struct t_tokenizer *tokenizer, t_tokenizer_block_callback blockCallback);
+void tokenizeChunk(struct t_tokenizer *tokenizer, const char chunk[], size_t chunkLength);
+void finishTokenizer(struct t_tokenizer *tokenizer, int* numberOfHumanVisibleCharachters, bool *isDisplayTextValidUTF8);
+void freeTokenizer(struct t_tokenizer *tokenizer);
+
+//The most open tags a tokenizer checkpoint can hold
+#define TOKENIZER_CHECKPOINT_MAX_OPEN_TAGS 8
+
+/**
+ Everything a tokenizer carries from one block of a document into the next, captured between blocks so tokenizing can be restarted from there
+ */
+struct t_tokenizer_checkpoint {
+	//Kinds of the tags still open, outermost first. Only tags without any style of their own which aren't blocks either (i.e. the <div> Reddit wraps everything in)
+	unsigned char openTagKinds[TOKENIZER_CHECKPOINT_MAX_OPEN_TAGS];
+	int numberOfOpenTags;
+	int stringVisiblePosition;
+	char previous;
+	unsigned short currentListValue;
+	struct t_utf8_validator utf8Validator;
+};
+
+bool saveTokenizerCheckpoint(struct t_tokenizer *tokenizer, struct t_tokenizer_checkpoint *checkpoint);
+void restoreTokenizerCheckpoint(struct t_tokenizer *tokenizer, const struct t_tokenizer_checkpoint *checkpoint);
+bool isSameTokenizerCheckpoint(const struct t_tokenizer_checkpoint *a, const struct t_tokenizer_checkpoint *b);
 
 void tokenizeHTML(char input[],size_t inputLength,char displayText[], struct t_tag completedTags[], int* numberOfTags, int* numberOfHumanVisibleCharachters);
-void makeAttributesLinear(struct t_tag inputTags[], int numberOfInputTags, struct t_format simplifiedTags[], int* numberOfSimplifiedTags, int displayTextLength);
+void tokenizeHTMLWithBlocks(char input[],size_t inputLength,char displayText[], struct t_tag completedTags[], int* numberOfTags, int* numberOfHumanVisibleCharachters, struct t_block blocks[], int* numberOfBlocks);
+void makeAttributesLinear(struct t_tag inputTags[], int numberOfInputTags, struct t_format simplifiedTags[], int* numberOfSimplifiedTags, int displayTextLength, struct t_link_table *links);
+
+bool tokenizeHTMLInPlace(char buffer[], size_t inputLength, size_t bufferCapacity, size_t *displayTextLength, struct t_tag completedTags[], int* numberOfTags, int* numberOfHumanVisibleCharachters);
+
+void tokenizeHTMLWithAllocator(char input[],size_t inputLength,char displayText[], struct t_tag completedTags[], int* numberOfTags, int* numberOfHumanVisibleCharachters, const struct t_allocator *allocator);
+void makeAttributesLinearWithAllocator(struct t_tag inputTags[], int numberOfInputTags, struct t_format simplifiedTags[], int* numberOfSimplifiedTags, int displayTextLength, struct t_link_table *links, const struct t_allocator *allocator);
+void freeLinkTable(struct t_link_table *links, const struct t_allocator *allocator);
+
+//The most inline styles (bold, links...) carried on past a single misnested closing tag, i.e. the <i> in <b><i></b></i>. Any more are just closed
+#define MAXIMUM_REOPENED_TAGS 3
+int maximumNumberOfTags(const char input[], size_t inputLength);
+int maximumNumberOfLinearFormats(int numberOfTags, int displayTextLength);
+
+/**
+ Growable outputs, sized by what the document actually contains rather than by its length. Zero one to start
+ */
+struct t_tag_vector {
+	struct t_tag *tags;
+	int numberOfTags;
+	size_t capacity;
+};
+
+struct t_format_vector {
+	struct t_format *formats;
+	int numberOfFormats;
+	size_t capacity;
+};
+
+void tokenizeHTMLToVector(const char input[], size_t inputLength, char displayText[], struct t_tag_vector *tags, int* numberOfHumanVisibleCharachters, const struct t_allocator *allocator);
+void makeAttributesLinearToVector(struct t_tag inputTags[], int numberOfInputTags, struct t_format_vector *simplifiedTags, int displayTextLength, struct t_link_table *links, const struct t_allocator *allocator);
+void freeTagVector(struct t_tag_vector *tags, const struct t_allocator *allocator);
+void freeFormatVector(struct t_format_vector *formats, const struct t_allocator *allocator);
+
+/**
+ The parse of a single document. The pointers belong to whatever produced the result
+ */
+struct t_parsed_document {
+	//Null terminated display text
+	const char *displayText;
+	size_t displayTextLength;
+	int numberOfHumanVisibleCharachters;
+	//Linear formats, as returned by makeAttributesLinear
+	struct t_format *formats;
+	int numberOfFormats;
+	//The unique links the formats refer to by ID
+	struct t_link_table links;
+	//If displayText is well formed UTF-8. When it isn't, NSString won't agree with numberOfHumanVisibleCharachters
+	bool isValidUTF8;
+	//Optional sparse index from byte offsets in displayText to UTF-16 offsets, one checkpoint per UTF16_CHECKPOINT_INTERVAL bytes. NULL when it wasn't built
+	const uint32_t *utf16Checkpoints;
+	size_t numberOfUTF16Checkpoints;
+	//The paragraphs, quotes, list items, headings and preformatted text, in the order they were closed
+	const struct t_block *blocks;
+	int numberOfBlocks;
+};
+
+/**
+ What the budget of a preview parse counts
+ */
+enum t_preview_budget_unit {
+	//Charachters of display text, as NSString counts them (UTF-16)
+	PREVIEW_BUDGET_VISIBLE = 0,
+	//Bytes of HTML
+	PREVIEW_BUDGET_INPUT_BYTES
+};
+
+struct t_parser_context;
+struct t_parser_context* createParserContext(void);
+void parseChunk(struct t_parser_context *context, const char chunk[], size_t chunkLength);
+void finishParse(struct t_parser_context *context, struct t_parsed_document *result);
+void parseHTMLWithContext(struct t_parser_context *context, const char input[], size_t inputLength, struct t_parsed_document *result);
+void parseHTMLInPlaceWithContext(struct t_parser_context *context, char input[], size_t inputLength, struct t_parsed_document *result);
+bool parsePreviewWithContext(struct t_parser_context *context, const char input[], size_t inputLength, enum t_preview_budget_unit unit, size_t budget, struct t_parsed_document *result);
+bool extendPreviewWithContext(struct t_parser_context *context, size_t budget, struct t_parsed_document *result);
+void setParserContextDialect(struct t_parser_context *context, enum t_html_dialect dialect);
+void setParserContextBuildsUTF16Index(struct t_parser_context *context, bool isBuildingUTF16Index);
+void freeParserContext(struct t_parser_context *context);
+
+size_t packedDocumentSize(const struct t_parsed_document *document);
+void packParsedDocument(const struct t_parsed_document *source, struct t_parsed_document *destination, void *storage);
+
+unsigned int utf16OffsetForByteOffset(const struct t_parsed_document *document, size_t byteOffset);
+size_t byteOffsetForUTF16Offset(const struct t_parsed_document *document, unsigned int utf16Offset);
 
 #endif /* C_HTML_Parser_h */
@@ -8,8 +8,19 @@
 
 #import <Foundation/Foundation.h>
 #import <UIKit/UIKit.h>
+#import "C_HTML_Parser.h"
+#import "LayoutEstimate.h"
+
+/**
+ Set over every block of a document to the block's index in t_parsed_document.blocks, the innermost block where they nest. It's the same key as
+ DYLabel.Key.Paragraph, so DYLabel splits its accessibility elements along the document's paragraphs
+ */
+extern NSAttributedStringKey const HTMLParagraphBlockAttributeName;
 
 @interface FormatToAttributedString : NSObject
 -(NSAttributedString *)attributedStringForHTML:(NSString *)htmlInput;
 -(void)setDefaultFontColor:(UIColor *)defaultColor;
+-(void)setParseCacheByteBudget:(size_t)byteBudget;
+-(void)setDialect:(enum t_html_dialect)htmlDialect;
+-(void)getLayoutMetrics:(struct t_layout_metrics *)metrics;
 @end
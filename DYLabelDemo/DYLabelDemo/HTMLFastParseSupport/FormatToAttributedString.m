@@ -8,9 +8,19 @@
 
 #import "FormatToAttributedString.h"
 #import "C_HTML_Parser.h"
+#import "ParseCache.h"
 #import <UIKit/UIKit.h>
 
-@implementation FormatToAttributedString
+NSAttributedStringKey const HTMLParagraphBlockAttributeName = @"DYLabel.ParagraphKey";
+
+@implementation FormatToAttributedString {
+    //Reused for every attributedStringForHTML: call so that parsing doesn't have to go back to the heap
+    struct t_parser_context *parserContext;
+    //Optional, see setParseCacheByteBudget:
+    struct t_parse_cache *parseCache;
+    //See setDialect:
+    enum t_html_dialect dialect;
+}
 NSString *standardFontName;
 NSString *boldFontName;
 NSString *italicFontName;
@@ -60,9 +70,18 @@ float quotePadding = 20.0;
     //Prepare our common fonts once
     codeFontName = @"CourierNewPSMT";
     [self prepareFonts];
+    
+    parserContext = createParserContext();
     return self;
 }
 
+-(void)dealloc {
+    freeParserContext(parserContext);
+    if (parseCache != NULL) {
+        freeParseCache(parseCache);
+    }
+}
+
 
 /**
  Initilize and cache high frquency fonts, colors, and other styles
@@ -102,6 +121,74 @@ float quotePadding = 20.0;
 }
 
 
+/**
+ Cache parse results so that HTML we've seen before (i.e. a comment scrolled back into view) skips the parser. Off by default
+ 
+ @param byteBudget How much memory the cached results may use. Zero turns the cache off. Changing it throws away everything cached so far
+ */
+-(void)setParseCacheByteBudget:(size_t)byteBudget {
+    if (parseCache != NULL) {
+        freeParseCache(parseCache);
+        parseCache = NULL;
+    }
+    if (byteBudget > 0) {
+        parseCache = createParseCache(byteBudget);
+    }
+}
+
+
+/**
+ Choose the flavour of HTML given to attributedStringForHTML:. Reddit's body_html by default
+ 
+ @param htmlDialect The dialect
+ */
+-(void)setDialect:(enum t_html_dialect)htmlDialect {
+    dialect = htmlDialect;
+    setParserContextDialect(parserContext, htmlDialect);
+}
+
+
+/**
+ Measure the fonts and paragraph styles attributedStringForHTML: uses, so estimateLayout can work out how tall a document will be without building
+ its attributed string. Measuring isn't free so hold on to the result (until the user's preferred font size changes)
+ 
+ @param metrics (returned) The metrics
+ */
+-(void)getLayoutMetrics:(struct t_layout_metrics *)metrics {
+    UIFont *fonts[LAYOUT_FACE_COUNT] = {plainFont, boldFont, italicsFont, italicsBoldFont, codeFont};
+    for (int face = 0; face < LAYOUT_FACE_COUNT; face++) {
+        [self getFontMetrics:&metrics->faces[face] forFont:fonts[face]];
+    }
+    metrics->baseFontSize = baseFontSize;
+    metrics->quotePadding = quotePadding;
+    metrics->paragraphSpacing = plainFont.lineHeight/4;
+}
+
+
+/**
+ Measure a font for estimateLayout, scaled down to 1pt
+ 
+ @param metrics (returned) The font's metrics
+ @param font The font
+ */
+-(void)getFontMetrics:(struct t_font_metrics *)metrics forFont:(UIFont *)font {
+    CGFloat pointSize = font.pointSize;
+    NSDictionary *attributes = @{NSFontAttributeName : font};
+    for (unichar charachter = 0; charachter < 128; charachter++) {
+        NSString *string = [NSString stringWithCharacters:&charachter length:1];
+        //Control charachters don't draw anything
+        metrics->asciiAdvances[charachter] = charachter < 0x20 ? 0 : [string sizeWithAttributes:attributes].width / pointSize;
+    }
+    metrics->asciiAdvances['\t'] = metrics->asciiAdvances[' '];
+    //Stand ins for every other narrow and wide charachter
+    metrics->otherAdvance = [@"\u00E9" sizeWithAttributes:attributes].width / pointSize;
+    metrics->wideAdvance = [@"\u4E2D" sizeWithAttributes:attributes].width / pointSize;
+    metrics->ascent = font.ascender / pointSize;
+    metrics->descent = -font.descender / pointSize;
+    metrics->leading = font.leading / pointSize;
+}
+
+
 /**
  Generate an indented "style"
  This is used for quote formatting
@@ -133,6 +220,37 @@ float quotePadding = 20.0;
 }
 
 
+/**
+ Pick the paragraph style for a block
+ 
+ @param quoteLevel The number of quotes the block is in
+ @param listNestLevel The number of lists the block is in
+ @return The style, with the first four indent levels coming from the cache
+ */
+-(NSParagraphStyle *)paragraphStyleForQuoteLevel:(int)quoteLevel listNestLevel:(int)listNestLevel {
+    //The cached styles only go up to four, past which the quote level is used even inside lists (estimateLayout indents the same way)
+    int indentLevel = 0;
+    if (quoteLevel > 0 || listNestLevel - 1 > 0) {
+        int level = quoteLevel + listNestLevel - 1 > 0 ? listNestLevel - 1 : 0;
+        indentLevel = level >= 1 && level <= 4 ? level : quoteLevel;
+    }
+    switch (indentLevel) {
+        case 0:
+            return defaultParagraphStyle;
+        case 1:
+            return quoteParagraphStyle1;
+        case 2:
+            return quoteParagraphStyle2;
+        case 3:
+            return quoteParagraphStyle3;
+        case 4:
+            return quoteParagraphStyle4;
+        default:
+            return [self generateParagraphStyleAtLevel:indentLevel];
+    }
+}
+
+
 /**
  Attribute a string of HTML using HTMLFastParse
  
@@ -140,26 +258,62 @@ float quotePadding = 20.0;
  @return The attributed string
  */
 -(NSAttributedString *)attributedStringForHTML:(NSString *)htmlInput {
-    char* input = (char*)[htmlInput UTF8String];
-    if (input == nil) {
-        //Input can be null if htmlInput is also null or if it is not representable in UTF8. We are not going to bother parsing data which requires > 8bits per field because it can't fit in a char
-        return [[NSAttributedString alloc]initWithString:@"[HTMLFastParse Internal Error]: Either no data was sent to the parser or the data could not be decoded by the system. Please verify the API is being used correctly or report this at https://github.com/shusain93/HTMLFastParse/issues"];
+    NSAttributedString *inputErrorString = [[NSAttributedString alloc]initWithString:@"[HTMLFastParse Internal Error]: Either no data was sent to the parser or the data could not be decoded by the system. Please verify the API is being used correctly or report this at https://github.com/shusain93/HTMLFastParse/issues"];
+    if (htmlInput == nil) {
+        return inputErrorString;
     }
-    unsigned long inputLength = strlen(input);
     
-    char* displayText = malloc(inputLength * sizeof(char) + 1); //+1 for a null byte
-    struct t_tag* tokens = malloc(inputLength * sizeof(struct t_tag));
+    if (parseCache != NULL) {
+        //The cache has to hash the whole input so get it out in one go
+        const char *html = htmlInput.UTF8String;
+        if (html == NULL) {
+            return inputErrorString;
+        }
+        const struct t_parsed_document *parsed = acquireParsedHTMLInDialect(parseCache, html, [htmlInput lengthOfBytesUsingEncoding:NSUTF8StringEncoding], dialect);
+        NSAttributedString *answer = [self attributedStringForParsedDocument:parsed];
+        releaseParsedHTML(parsed);
+        return answer;
+    }
     
-    int numberOfTags = -1;
-    int numberOfHumanVisibleCharachters = -1;
-    tokenizeHTML(input, inputLength, displayText,tokens,&numberOfTags,&numberOfHumanVisibleCharachters);
+    //Stream the string through the tokenizer in small UTF8 chunks instead of copying it all out with UTF8String
+    char chunk[4096];
+    NSRange remainingRange = NSMakeRange(0, htmlInput.length);
+    while (remainingRange.length > 0) {
+        NSUInteger usedLength = 0;
+        [htmlInput getBytes:chunk maxLength:sizeof(chunk) usedLength:&usedLength encoding:NSUTF8StringEncoding options:0 range:remainingRange remainingRange:&remainingRange];
+        if (usedLength == 0) {
+            //The remaining data is not representable in UTF8. We are not going to bother parsing data which requires > 8bits per field because it can't fit in a char
+            break;
+        }
+        parseChunk(parserContext, chunk, usedLength);
+    }
     
-    struct t_format* finalTokens =  malloc(inputLength * sizeof(struct t_format));//&finalTokenBuffer[0];
-    int numberOfSimplifiedTags = -1;
-    makeAttributesLinear(tokens, (int)numberOfTags, finalTokens,&numberOfSimplifiedTags,numberOfHumanVisibleCharachters);
+    //The results (display text, runs and their link URLs) belong to the context and stay valid until the next parse
+    struct t_parsed_document parsed;
+    finishParse(parserContext, &parsed);
+    
+    if (remainingRange.length > 0) {
+        return inputErrorString;
+    }
+    return [self attributedStringForParsedDocument:&parsed];
+}
+
+
+/**
+ Build the attributed string for a parsed document
+ 
+ @param parsed The display text, linear formats and links
+ @return The attributed string
+ */
+-(NSAttributedString *)attributedStringForParsedDocument:(const struct t_parsed_document *)parsed {
+    if (!parsed->isValidUTF8) {
+        //NSString would refuse the display text outright (i.e. an entity naming a lone surrogate)
+        return [[NSAttributedString alloc]initWithString:@"[HTMLFastParse Internal Error]: HFP produced display text which is not valid UTF8. Please report this at https://github.com/shusain93/HTMLFastParse/issues"];
+    }
+    int numberOfHumanVisibleCharachters = parsed->numberOfHumanVisibleCharachters;
     
     //Now apply our linear attributes to our attributed string
-    NSMutableAttributedString *answer = [[NSMutableAttributedString alloc]initWithString:[NSString stringWithUTF8String:displayText]];
+    NSMutableAttributedString *answer = [[NSMutableAttributedString alloc]initWithString:[NSString stringWithUTF8String:parsed->displayText]];
     
     //Add our default attributes
     [answer addAttributes:@{
@@ -169,19 +323,37 @@ float quotePadding = 20.0;
                             } range:NSMakeRange(0, answer.length)];
     //Only format the string if we are sure that everything will line up (if our calculated visible is not the same as attributed sees, everything will be broken and likely will cause a crash
     if ([answer length] == numberOfHumanVisibleCharachters) {
-        for (int i = 0; i < numberOfSimplifiedTags; i++) {
-            [self addAttributeToString:answer forFormat:finalTokens[i]];
-            free(finalTokens[i].linkURL);
+        //One NSURL per unique link no matter how many runs share it. Links which aren't valid URLs are NSNull
+        NSMutableArray *links = [[NSMutableArray alloc]initWithCapacity:parsed->links.numberOfLinks];
+        for (int linkID = 1; linkID <= parsed->links.numberOfLinks; linkID++) {
+            NSURL *linkURL = [NSURL URLWithString:[NSString stringWithUTF8String:linkTableURL(&parsed->links, linkID)]];
+            [links addObject:linkURL != nil ? linkURL : [NSNull null]];
+        }
+        
+        for (int i = 0; i < parsed->numberOfFormats; i++) {
+            [self addAttributeToString:answer forFormat:parsed->formats[i] links:links];
+        }
+        
+        //Paragraph styles and block indices go on once per block rather than once per run. Blocks close before the blocks around them, so
+        //going backwards marks the outer blocks first and lets the blocks nested in them override that
+        for (int i = parsed->numberOfBlocks - 1; i >= 0; i--) {
+            struct t_block block = parsed->blocks[i];
+            if (block.endPosition <= block.startPosition) {
+                continue;
+            }
+            NSRange blockRange = NSMakeRange(block.startPosition, block.endPosition - block.startPosition);
+            [answer addAttribute:HTMLParagraphBlockAttributeName value:@(i) range:blockRange];
+            //Blocks outside of any quote or list already have the default style, and can't be nested in anything which doesn't
+            if (block.quoteDepth != 0 || block.listDepth != 0) {
+                NSParagraphStyle *paragraphStyle = [self paragraphStyleForQuoteLevel:block.quoteDepth listNestLevel:block.listDepth];
+                [answer addAttribute:NSParagraphStyleAttributeName value:paragraphStyle range:blockRange];
+            }
         }
     }else {
         NSAttributedString *failureText = [[NSAttributedString alloc]initWithString:@"\n\n\n[HTMLFastParse Internal Error]: HFP detected an issue where NSAttributedString length and the calculated visible length are not equal. Please report this at https://github.com/shusain93/HTMLFastParse/issues"];
         [answer appendAttributedString: failureText];
     }
     
-    //Free and get ready to return
-    free(displayText);
-    free(tokens);
-    free(finalTokens);
     return answer;
 }
 
@@ -191,48 +363,33 @@ float quotePadding = 20.0;
  
  @param string The mutable attributed string to work on
  @param format The styles to apply (with range data stuffed!)
+ @param links The document's links (NSURL or NSNull), which the format's link ID refers to
  */
--(void)addAttributeToString:(NSMutableAttributedString *)string forFormat:(struct t_format)format {
+-(void)addAttributeToString:(NSMutableAttributedString *)string forFormat:(struct t_format)format links:(NSArray *)links {
     //This is the range of the style
     NSRange currentRange = NSMakeRange(format.startPosition, format.endPosition-format.startPosition);
     
-    if (format.isStruck) {
-        [string addAttribute:NSStrikethroughStyleAttributeName value:[NSNumber numberWithInteger:NSUnderlineStyleSingle] range:currentRange];
-    }
+    //Unpack the style word once
+    BOOL isBold = formatIsBold(format);
+    BOOL isItalics = formatIsItalics(format);
+    BOOL isCode = formatIsCode(format);
+    unsigned char quoteLevel = formatQuoteLevel(format);
+    unsigned char hLevel = formatHLevel(format);
+    unsigned char exponentLevel = formatExponentLevel(format);
+    unsigned int linkID = formatLinkID(format);
     
-    if (format.quoteLevel > 0 || format.listNestLevel - 1 > 0) {
-        NSMutableParagraphStyle *quoteParagraphStyle;
-        //We have the first four cached and after that we'll dynamically generate
-        unsigned char level = format.quoteLevel + format.listNestLevel - 1 > 0 ? format.listNestLevel - 1 : 0;
-        switch (level) {
-            case 1:
-                quoteParagraphStyle = quoteParagraphStyle1;
-                break;
-            case 2:
-                quoteParagraphStyle = quoteParagraphStyle2;
-                break;
-            case 3:
-                quoteParagraphStyle = quoteParagraphStyle3;
-                break;
-            case 4:
-                quoteParagraphStyle = quoteParagraphStyle4;
-                break;
-                
-            default:
-                quoteParagraphStyle = [self generateParagraphStyleAtLevel:format.quoteLevel];
-                break;
-        }
-        [string addAttribute:NSParagraphStyleAttributeName value:quoteParagraphStyle range:currentRange];
+    if (formatIsStruck(format)) {
+        [string addAttribute:NSStrikethroughStyleAttributeName value:[NSNumber numberWithInteger:NSUnderlineStyleSingle] range:currentRange];
     }
     
-    if (format.quoteLevel > 0) {
+    if (quoteLevel > 0) {
         [string addAttribute:NSForegroundColorAttributeName value:quoteFontColor range:currentRange];
     }
     
-    if (format.linkURL) {
-        NSString *nsLinkURL = [NSString stringWithUTF8String:format.linkURL];
-        if ([NSURL URLWithString:nsLinkURL] != nil) {
-            [string addAttribute:NSLinkAttributeName value: nsLinkURL range:currentRange];
+    if (linkID != 0) {
+        id linkURL = links[linkID - 1];
+        if (linkURL != [NSNull null]) {
+            [string addAttribute:NSLinkAttributeName value:linkURL range:currentRange];
             [string addAttribute:NSForegroundColorAttributeName value:linkColor range:currentRange];
         }
     }
@@ -241,23 +398,23 @@ float quotePadding = 20.0;
     
     /* Styling that uses fonts. This includes exponents, h#, bold, italics, and any combination thereof. Code formatting skips all of these */
     
-    if (format.isCode == 1) {
+    if (isCode) {
         [string addAttribute:NSFontAttributeName value:codeFont range:currentRange];
         [string addAttribute:NSBackgroundColorAttributeName value:containerBackgroundColor range:currentRange];
         [string addAttribute:NSForegroundColorAttributeName value:codeFontColor range:currentRange];
     }
     //Check if we can take a shortcut. We don't need dynamic font in this case
-    else if (format.hLevel == 0 && format.exponentLevel == 0) {
-        if (format.isBold == 0 && format.isItalics == 0) {
+    else if (hLevel == 0 && exponentLevel == 0) {
+        if (!isBold && !isItalics) {
             //Plain text
             //Do nothing since it's the default as set above
-        }else if (format.isBold == 1 && format.isItalics == 1) {
+        }else if (isBold && isItalics) {
             //Bold italics
             [string addAttribute:NSFontAttributeName value:italicsBoldFont range:currentRange];
-        }else if (format.isBold == 1) {
+        }else if (isBold) {
             //Bold
             [string addAttribute:NSFontAttributeName value:boldFont range:currentRange];
-        }else if (format.isItalics == 1) {
+        }else if (isItalics) {
             //Italics
             [string addAttribute:NSFontAttributeName value:italicsFont range:currentRange];
         }
@@ -265,9 +422,9 @@ float quotePadding = 20.0;
         //We need to generate a dynamic font since at least one of the attributes changes the font size.
         CGFloat fontSize = baseFontSize;
         //Handle H#
-        if (format.hLevel > 0) {
+        if (hLevel > 0) {
             //Reddit only supports 1-6, so that's all that's been implmented
-            switch (format.hLevel) {
+            switch (hLevel) {
                 case 0:
                     break;
                 case 1:
@@ -295,11 +452,11 @@ float quotePadding = 20.0;
             }
         }
         //Handle exponent
-        if (format.exponentLevel > 0) {
+        if (exponentLevel > 0) {
             fontSize *= 0.75;
             float baselineOffset;
-            if (format.exponentLevel < 3) {
-                baselineOffset = format.exponentLevel*10;
+            if (exponentLevel < 3) {
+                baselineOffset = exponentLevel*10;
             }else {
                 baselineOffset = 40;
             }
@@ -310,16 +467,16 @@ float quotePadding = 20.0;
         
         UIFont *customFont;
         /* NOTE: USE fontWithSize: and NOT font descriptors because https://stackoverflow.com/q/34954956/1166266 */
-        if (format.isBold == 0 && format.isItalics == 0) {
+        if (!isBold && !isItalics) {
             //Plain text
             customFont = [plainFont fontWithSize:fontSize];
-        }else if (format.isBold == 1 && format.isItalics == 1) {
+        }else if (isBold && isItalics) {
             //Bold italics
             customFont = [italicsBoldFont fontWithSize:fontSize];
-        }else if (format.isBold == 1) {
+        }else if (isBold) {
             //Bold
             customFont = [boldFont fontWithSize:fontSize];
-        }else if (format.isItalics == 1) {
+        }else if (isItalics) {
             //Italics
             customFont = [italicsFont fontWithSize:fontSize];
         }
@@ -328,7 +485,7 @@ float quotePadding = 20.0;
         [string addAttribute:NSFontAttributeName value:customFont range:currentRange];
     }
     
-    if (format.isCode == 0 && format.quoteLevel == 0 && format.linkURL == nil) {
+    if (!isCode && quoteLevel == 0 && linkID == 0) {
         [string addAttribute:NSForegroundColorAttributeName value:defaultFontColor range:currentRange];
     }
 }
@@ -0,0 +1,430 @@
+//
+//  IncrementalParse.c
+//  HTMLFastParse
+//
+//  Reparsing for documents which change a little at a time, i.e. the live preview of a comment as it's being written. The document is kept as a
+//  list of blocks, split after closing tags wherever the tokenizer could be restarted (between top level paragraphs, quotes, lists...). An edit
+//  only retokenizes from the block it lands in until the tokenizer is back in step with a block from before the edit, and everything past that
+//  is reused, shifted into place.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "IncrementalParse.h"
+#include "C_HTML_Parser.h"
+
+/**
+ A piece of the document which can be tokenized on its own, given the tokenizer state it starts in
+ */
+struct t_incremental_block {
+	//Where the block is in the HTML, in the display text and in the visible (NSString) text
+	size_t inputStart;
+	size_t inputEnd;
+	size_t displayStart;
+	size_t displayEnd;
+	unsigned int visibleStart;
+	unsigned int visibleEnd;
+	//The block's formats. A format never runs across blocks, even if the next block starts with the same style
+	int formatStart;
+	int formatEnd;
+	//The paragraphs closed in the block. The tokenizer never stops part way through one so they always fit
+	int paragraphStart;
+	int paragraphEnd;
+	//The tokenizer state at inputStart
+	struct t_tokenizer_checkpoint entry;
+};
+
+struct t_incremental_document {
+	char *html;
+	size_t htmlLength;
+	size_t htmlCapacity;
+	
+	char *displayText;
+	size_t displayTextLength;
+	size_t displayTextCapacity;
+	struct t_format *formats;
+	int numberOfFormats;
+	size_t formatsCapacity;
+	//The t_blocks of the whole document. Paragraphs here, so they aren't mixed up with our own blocks
+	struct t_block *paragraphs;
+	int numberOfParagraphs;
+	size_t paragraphsCapacity;
+	//Links of blocks which have since been replaced stay in here unused, so IDs never change
+	struct t_link_table links;
+	bool isValidUTF8;
+	
+	struct t_incremental_block *blocks;
+	int numberOfBlocks;
+	size_t blocksCapacity;
+	
+	struct t_tokenizer *tokenizer;
+	//Tags of the block being tokenized
+	struct t_tag_vector tags;
+	//What has been tokenized since the first changed block, until it's spliced in. Positions are already where they'll end up
+	char *newDisplayText;
+	size_t newDisplayTextLength;
+	size_t newDisplayTextCapacity;
+	size_t newDisplayTextStart;
+	struct t_format *newFormats;
+	int numberOfNewFormats;
+	size_t newFormatsCapacity;
+	int newFormatsStart;
+	struct t_block *newParagraphs;
+	int numberOfNewParagraphs;
+	size_t newParagraphsCapacity;
+	int newParagraphsStart;
+	struct t_incremental_block *newBlocks;
+	int numberOfNewBlocks;
+	size_t newBlocksCapacity;
+};
+
+static void* growArray(void *array, size_t *capacity, size_t required, size_t elementSize) {
+	if (required <= *capacity && array != NULL) {
+		return array;
+	}
+	size_t newCapacity = *capacity > 0 ? *capacity * 2 : 16;
+	if (newCapacity < required) {
+		newCapacity = required;
+	}
+	*capacity = newCapacity;
+	return realloc(array, newCapacity * elementSize);
+}
+
+static void collectBlockText(void *context, const char text[], size_t length) {
+	struct t_incremental_document *document = context;
+	document->newDisplayText = growArray(document->newDisplayText, &document->newDisplayTextCapacity, document->newDisplayTextLength + length, 1);
+	memcpy(&document->newDisplayText[document->newDisplayTextLength], text, length);
+	document->newDisplayTextLength += length;
+}
+
+static void collectBlockTag(void *context, struct t_tag tag) {
+	struct t_incremental_document *document = context;
+	struct t_tag_vector *tags = &document->tags;
+	tags->tags = growArray(tags->tags, &tags->capacity, tags->numberOfTags + 1, sizeof(struct t_tag));
+	tags->tags[tags->numberOfTags++] = tag;
+}
+
+static void collectBlockParagraph(void *context, struct t_block paragraph) {
+	struct t_incremental_document *document = context;
+	document->newParagraphs = growArray(document->newParagraphs, &document->newParagraphsCapacity, document->numberOfNewParagraphs + 1, sizeof(struct t_block));
+	document->newParagraphs[document->numberOfNewParagraphs++] = paragraph;
+}
+
+/**
+ Start a new block where the new output currently ends
+ */
+static void openBlock(struct t_incremental_document *document, size_t inputStart, const struct t_tokenizer_checkpoint *entry) {
+	document->newBlocks = growArray(document->newBlocks, &document->newBlocksCapacity, document->numberOfNewBlocks + 1, sizeof(struct t_incremental_block));
+	struct t_incremental_block *block = &document->newBlocks[document->numberOfNewBlocks++];
+	block->inputStart = inputStart;
+	block->displayStart = document->newDisplayTextStart + document->newDisplayTextLength;
+	block->visibleStart = entry->stringVisiblePosition;
+	block->paragraphStart = document->newParagraphsStart + document->numberOfNewParagraphs;
+	block->entry = *entry;
+}
+
+/**
+ Finish the block being tokenized, linearizing its tags on their own
+ */
+static void closeBlock(struct t_incremental_document *document, size_t inputEnd, unsigned int visibleEnd) {
+	struct t_incremental_block *block = &document->newBlocks[document->numberOfNewBlocks - 1];
+	block->inputEnd = inputEnd;
+	block->displayEnd = document->newDisplayTextStart + document->newDisplayTextLength;
+	block->visibleEnd = visibleEnd;
+	
+	//Linearize relative to the start of the block. Only unstyled tags (which are ignored) can have started before it
+	unsigned int base = block->visibleStart;
+	struct t_tag *tags = document->tags.tags;
+	int numberOfTags = document->tags.numberOfTags;
+	for (int i = 0; i < numberOfTags; i++) {
+		tags[i].startPosition = tags[i].startPosition > base ? tags[i].startPosition - base : 0;
+		tags[i].endPosition = tags[i].endPosition > base ? tags[i].endPosition - base : 0;
+	}
+	int visibleLength = (int)(visibleEnd - base);
+	document->newFormats = growArray(document->newFormats, &document->newFormatsCapacity, document->numberOfNewFormats + maximumNumberOfLinearFormats(numberOfTags, visibleLength), sizeof(struct t_format));
+	struct t_format *formats = &document->newFormats[document->numberOfNewFormats];
+	int numberOfFormats = 0;
+	makeAttributesLinear(tags, numberOfTags, formats, &numberOfFormats, visibleLength, &document->links);
+	for (int i = 0; i < numberOfFormats; i++) {
+		formats[i].startPosition += base;
+		formats[i].endPosition += base;
+	}
+	
+	block->formatStart = document->newFormatsStart + document->numberOfNewFormats;
+	document->numberOfNewFormats += numberOfFormats;
+	block->formatEnd = document->newFormatsStart + document->numberOfNewFormats;
+	block->paragraphEnd = document->newParagraphsStart + document->numberOfNewParagraphs;
+	document->tags.numberOfTags = 0;
+}
+
+/**
+ Find where the next chunk handed to the tokenizer should end: just past the next closing tag, since that's the only place a block can end
+ */
+static size_t nextChunkEnd(const char html[], size_t position, size_t length) {
+	const char *end = html + length;
+	const char *cursor = html + position;
+	while (cursor < end && (cursor = memchr(cursor, '<', end - cursor)) != NULL) {
+		if (cursor + 1 < end && cursor[1] == '/') {
+			const char *close = memchr(cursor, '>', end - cursor);
+			return close != NULL ? (size_t)(close - html) + 1 : length;
+		}
+		cursor++;
+	}
+	return length;
+}
+
+/**
+ Tokenize the document from one of its blocks onwards, collecting new blocks until we either reach the end or line up with an old block again
+ 
+ @param document The document, with its HTML already edited
+ @param first The first block to tokenize again. Its start and entry state are still right
+ @param editStart Where the edit starts
+ @param editLength How many bytes of the old HTML the edit replaced
+ @param replacementLength How many bytes it replaced them with
+ @param isValidUTF8 (returned) If the display text is well formed UTF-8. Only set when we tokenized to the end
+ @return The index of the old block we lined up with, numberOfBlocks if we tokenized to the end
+ */
+static int tokenizeBlocks(struct t_incremental_document *document, int first, size_t editStart, size_t editLength, size_t replacementLength, bool *isValidUTF8) {
+	const struct t_incremental_block *firstBlock = &document->blocks[first];
+	document->newDisplayTextLength = 0;
+	document->newDisplayTextStart = firstBlock->displayStart;
+	document->numberOfNewFormats = 0;
+	document->newFormatsStart = firstBlock->formatStart;
+	document->numberOfNewParagraphs = 0;
+	document->newParagraphsStart = firstBlock->paragraphStart;
+	document->numberOfNewBlocks = 0;
+	document->tags.numberOfTags = 0;
+	restoreTokenizerCheckpoint(document->tokenizer, &firstBlock->entry);
+	openBlock(document, firstBlock->inputStart, &firstBlock->entry);
+	
+	size_t position = firstBlock->inputStart;
+	int candidate = first + 1;
+	while (position < document->htmlLength) {
+		size_t chunkEnd = nextChunkEnd(document->html, position, document->htmlLength);
+		tokenizeChunk(document->tokenizer, &document->html[position], chunkEnd - position);
+		position = chunkEnd;
+		struct t_tokenizer_checkpoint checkpoint;
+		if (position == document->htmlLength || !saveTokenizerCheckpoint(document->tokenizer, &checkpoint)) {
+			continue;
+		}
+		closeBlock(document, position, checkpoint.stringVisiblePosition);
+		
+		//Past the edit the HTML is the same as before, so once we're in the same state at the start of an old block the rest would come out the same too
+		if (position >= editStart + replacementLength) {
+			size_t oldPosition = position - replacementLength + editLength;
+			while (candidate < document->numberOfBlocks && document->blocks[candidate].inputStart < oldPosition) {
+				candidate++;
+			}
+			if (candidate < document->numberOfBlocks && document->blocks[candidate].inputStart == oldPosition && isSameTokenizerCheckpoint(&checkpoint, &document->blocks[candidate].entry)) {
+				return candidate;
+			}
+		}
+		openBlock(document, position, &checkpoint);
+	}
+	
+	int numberOfHumanVisibleCharachters = 0;
+	finishTokenizer(document->tokenizer, &numberOfHumanVisibleCharachters, isValidUTF8);
+	closeBlock(document, position, numberOfHumanVisibleCharachters);
+	return document->numberOfBlocks;
+}
+
+/**
+ Replace the old blocks [first, resume) with the newly tokenized ones, moving everything after them into place
+ */
+static void spliceBlocks(struct t_incremental_document *document, int first, int resume) {
+	const struct t_incremental_block *firstBlock = &document->blocks[first];
+	const struct t_incremental_block *lastNewBlock = &document->newBlocks[document->numberOfNewBlocks - 1];
+	bool hasTail = resume < document->numberOfBlocks;
+	const struct t_incremental_block *resumeBlock = hasTail ? &document->blocks[resume] : NULL;
+	
+	//Where the replaced blocks ended, and how far what comes after them moves. Unsigned wrap around takes care of moving backwards
+	size_t displayEnd = hasTail ? resumeBlock->displayStart : document->displayTextLength;
+	int formatEnd = hasTail ? resumeBlock->formatStart : document->numberOfFormats;
+	int paragraphEnd = hasTail ? resumeBlock->paragraphStart : document->numberOfParagraphs;
+	size_t inputShift = hasTail ? lastNewBlock->inputEnd - resumeBlock->inputStart : 0;
+	size_t displayShift = lastNewBlock->displayEnd - displayEnd;
+	unsigned int visibleShift = hasTail ? lastNewBlock->visibleEnd - resumeBlock->visibleStart : 0;
+	int formatShift = lastNewBlock->formatEnd - formatEnd;
+	int paragraphShift = lastNewBlock->paragraphEnd - paragraphEnd;
+	size_t displayStart = firstBlock->displayStart;
+	int formatStart = firstBlock->formatStart;
+	int paragraphStart = firstBlock->paragraphStart;
+	
+	//Display text
+	size_t tailDisplayLength = document->displayTextLength - displayEnd;
+	size_t displayTextLength = lastNewBlock->displayEnd + tailDisplayLength;
+	document->displayText = growArray(document->displayText, &document->displayTextCapacity, displayTextLength + 1, 1);
+	memmove(&document->displayText[lastNewBlock->displayEnd], &document->displayText[displayEnd], tailDisplayLength);
+	if (document->newDisplayTextLength > 0) {
+		memcpy(&document->displayText[displayStart], document->newDisplayText, document->newDisplayTextLength);
+	}
+	document->displayText[displayTextLength] = 0x00;
+	document->displayTextLength = displayTextLength;
+	
+	//Formats
+	int numberOfTailFormats = document->numberOfFormats - formatEnd;
+	document->formats = growArray(document->formats, &document->formatsCapacity, lastNewBlock->formatEnd + numberOfTailFormats, sizeof(struct t_format));
+	struct t_format *tailFormats = &document->formats[lastNewBlock->formatEnd];
+	memmove(tailFormats, &document->formats[formatEnd], numberOfTailFormats * sizeof(struct t_format));
+	for (int i = 0; i < numberOfTailFormats; i++) {
+		tailFormats[i].startPosition += visibleShift;
+		tailFormats[i].endPosition += visibleShift;
+	}
+	memcpy(&document->formats[formatStart], document->newFormats, document->numberOfNewFormats * sizeof(struct t_format));
+	document->numberOfFormats = lastNewBlock->formatEnd + numberOfTailFormats;
+	
+	//Paragraphs
+	int numberOfTailParagraphs = document->numberOfParagraphs - paragraphEnd;
+	document->paragraphs = growArray(document->paragraphs, &document->paragraphsCapacity, lastNewBlock->paragraphEnd + numberOfTailParagraphs, sizeof(struct t_block));
+	struct t_block *tailParagraphs = &document->paragraphs[lastNewBlock->paragraphEnd];
+	memmove(tailParagraphs, &document->paragraphs[paragraphEnd], numberOfTailParagraphs * sizeof(struct t_block));
+	for (int i = 0; i < numberOfTailParagraphs; i++) {
+		tailParagraphs[i].startPosition += visibleShift;
+		tailParagraphs[i].endPosition += visibleShift;
+	}
+	if (document->numberOfNewParagraphs > 0) {
+		memcpy(&document->paragraphs[paragraphStart], document->newParagraphs, document->numberOfNewParagraphs * sizeof(struct t_block));
+	}
+	document->numberOfParagraphs = lastNewBlock->paragraphEnd + numberOfTailParagraphs;
+	
+	//And the blocks themselves
+	int numberOfTailBlocks = document->numberOfBlocks - resume;
+	int tailStart = first + document->numberOfNewBlocks;
+	document->blocks = growArray(document->blocks, &document->blocksCapacity, tailStart + numberOfTailBlocks, sizeof(struct t_incremental_block));
+	memmove(&document->blocks[tailStart], &document->blocks[resume], numberOfTailBlocks * sizeof(struct t_incremental_block));
+	for (int i = tailStart; i < tailStart + numberOfTailBlocks; i++) {
+		struct t_incremental_block *block = &document->blocks[i];
+		block->inputStart += inputShift;
+		block->inputEnd += inputShift;
+		block->displayStart += displayShift;
+		block->displayEnd += displayShift;
+		block->visibleStart += visibleShift;
+		block->visibleEnd += visibleShift;
+		block->formatStart += formatShift;
+		block->formatEnd += formatShift;
+		block->paragraphStart += paragraphShift;
+		block->paragraphEnd += paragraphShift;
+		block->entry.stringVisiblePosition += visibleShift;
+	}
+	memcpy(&document->blocks[first], document->newBlocks, document->numberOfNewBlocks * sizeof(struct t_incremental_block));
+	document->numberOfBlocks = tailStart + numberOfTailBlocks;
+}
+
+/**
+ Tokenize from a block onwards, splice the results in and hand them out
+ */
+static void reparseFromBlock(struct t_incremental_document *document, int first, size_t editStart, size_t editLength, size_t replacementLength, struct t_parsed_document *result) {
+	int resume = tokenizeBlocks(document, first, editStart, editLength, replacementLength, &document->isValidUTF8);
+	spliceBlocks(document, first, resume);
+	
+	result->displayText = document->displayText;
+	result->displayTextLength = document->displayTextLength;
+	result->numberOfHumanVisibleCharachters = document->blocks[document->numberOfBlocks - 1].visibleEnd;
+	result->formats = document->formats;
+	result->numberOfFormats = document->numberOfFormats;
+	result->links = document->links;
+	result->isValidUTF8 = document->isValidUTF8;
+	result->blocks = document->paragraphs;
+	result->numberOfBlocks = document->numberOfParagraphs;
+	result->utf16Checkpoints = NULL;
+	result->numberOfUTF16Checkpoints = 0;
+}
+
+/**
+ Parse a document which is going to be edited, i.e. the text of a comment being written
+ 
+ @param html The HTML, which is copied
+ @param length The length of html in bytes, excluding any null byte
+ @param dialect The dialect of HTML
+ @param result (returned) The parse. It belongs to the document and is valid until the next edit. Formats are split at block boundaries, but otherwise the same as parseHTMLWithContext's
+ @return The document. Release with freeIncrementalDocument
+ */
+struct t_incremental_document* createIncrementalDocument(const char html[], size_t length, enum t_html_dialect dialect, struct t_parsed_document *result) {
+	struct t_incremental_document *document = calloc(1, sizeof(struct t_incremental_document));
+	document->tokenizer = createTokenizer(NULL, collectBlockText, collectBlockTag, document);
+	setTokenizerDialect(document->tokenizer, dialect);
+	setTokenizerBlockCallback(document->tokenizer, collectBlockParagraph);
+	
+	document->html = growArray(NULL, &document->htmlCapacity, length, 1);
+	memcpy(document->html, html, length);
+	document->htmlLength = length;
+	
+	//An empty block at the start of an empty document, which the whole document is tokenized from
+	document->blocks = growArray(NULL, &document->blocksCapacity, 1, sizeof(struct t_incremental_block));
+	memset(&document->blocks[0], 0, sizeof(struct t_incremental_block));
+	document->numberOfBlocks = 1;
+	reparseFromBlock(document, 0, SIZE_MAX, 0, 0, result);
+	return document;
+}
+
+/**
+ Replace part of a document's HTML and update its parse. Only the blocks the edit touches (and any whose meaning it changes) are tokenized again,
+ so this costs about as much as the edit is big rather than the document
+ 
+ @param document The document
+ @param editStart Where the replaced bytes start in the HTML
+ @param editLength How many bytes are replaced. Zero inserts
+ @param replacement What replaces them. May be NULL when replacementLength is zero
+ @param replacementLength The length of replacement. Zero deletes
+ @param result (returned) The new parse, see createIncrementalDocument. The previous one is no longer valid
+ */
+void editIncrementalDocument(struct t_incremental_document *document, size_t editStart, size_t editLength, const char replacement[], size_t replacementLength, struct t_parsed_document *result) {
+	if (editStart > document->htmlLength) {
+		editStart = document->htmlLength;
+	}
+	if (editLength > document->htmlLength - editStart) {
+		editLength = document->htmlLength - editStart;
+	}
+	size_t tailLength = document->htmlLength - editStart - editLength;
+	size_t htmlLength = document->htmlLength - editLength + replacementLength;
+	document->html = growArray(document->html, &document->htmlCapacity, htmlLength, 1);
+	memmove(&document->html[editStart + replacementLength], &document->html[editStart + editLength], tailLength);
+	if (replacementLength > 0) {
+		memcpy(&document->html[editStart], replacement, replacementLength);
+	}
+	document->htmlLength = htmlLength;
+	
+	//Start from the last block which starts at or before the edit. Nothing before it has changed, and neither has the state it starts in
+	int low = 0;
+	int high = document->numberOfBlocks - 1;
+	while (low < high) {
+		int middle = (low + high + 1) / 2;
+		if (document->blocks[middle].inputStart <= editStart) {
+			low = middle;
+		}else {
+			high = middle - 1;
+		}
+	}
+	reparseFromBlock(document, low, editStart, editLength, replacementLength, result);
+}
+
+/**
+ The document's HTML as it is after all the edits so far
+ 
+ @param document The document
+ @param length (returned) The length of the HTML. It is not null terminated
+ @return The HTML, valid until the next edit
+ */
+const char* incrementalDocumentHTML(const struct t_incremental_document *document, size_t *length) {
+	*length = document->htmlLength;
+	return document->html;
+}
+
+void freeIncrementalDocument(struct t_incremental_document *document) {
+	freeTokenizer(document->tokenizer);
+	freeLinkTable(&document->links, NULL);
+	free(document->tags.tags);
+	free(document->newBlocks);
+	free(document->newParagraphs);
+	free(document->newFormats);
+	free(document->newDisplayText);
+	free(document->blocks);
+	free(document->paragraphs);
+	free(document->formats);
+	free(document->displayText);
+	free(document->html);
+	free(document);
+}
@@ -0,0 +1,18 @@
+//
+//  IncrementalParse.h
+//  HTMLFastParse
+//
+
+#ifndef IncrementalParse_h
+#define IncrementalParse_h
+
+#include <stddef.h>
+#include "C_HTML_Parser.h"
+
+struct t_incremental_document;
+struct t_incremental_document* createIncrementalDocument(const char html[], size_t length, enum t_html_dialect dialect, struct t_parsed_document *result);
+void editIncrementalDocument(struct t_incremental_document *document, size_t editStart, size_t editLength, const char replacement[], size_t replacementLength, struct t_parsed_document *result);
+const char* incrementalDocumentHTML(const struct t_incremental_document *document, size_t *length);
+void freeIncrementalDocument(struct t_incremental_document *document);
+
+#endif /* IncrementalParse_h */
@@ -0,0 +1,320 @@
+//
+//  LayoutEstimate.c
+//  HTMLFastParse
+//
+//  Estimates how tall display text will be once laid out without going through CoreText, so row heights can be worked out in bulk on a
+//  background thread or on a server. Text is styled the way FormatToAttributedString styles it (fonts, heading and superscript sizes, quote and
+//  list indents) and broken into lines greedily at UAX #14 style break opportunities, measured with a table of font metrics rather than real
+//  glyphs. Kerning, ligatures and complex scripts are ignored, so the height is an estimate; with metrics taken from the same fonts it should be
+//  within a line of DYLabel.size(of:width:).
+//
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "LayoutEstimate.h"
+
+/**
+ How a charachter can be broken around. A small subset of UAX #14's classes
+ */
+enum t_break_class {
+	//Letters, digits and most punctuation, which are never broken around
+	BREAK_CLASS_ALPHABETIC,
+	//Lines can break after spaces, and spaces at the end of a line hang past it
+	BREAK_CLASS_SPACE,
+	//Lines can break after hyphens and dashes
+	BREAK_CLASS_BREAK_AFTER,
+	//Ideographs and emoji can be broken before and after
+	BREAK_CLASS_IDEOGRAPHIC,
+	//Combining marks, joiners and variation selectors have no width and are never broken before
+	BREAK_CLASS_COMBINING,
+	BREAK_CLASS_NEW_LINE
+};
+
+/**
+ The vertical extent of (part of) a line
+ */
+struct t_line_extent {
+	float ascent;
+	float descent;
+	float leading;
+	float baselineOffset;
+};
+
+/**
+ What the text at the current position is drawn with
+ */
+struct t_layout_style {
+	const struct t_font_metrics *face;
+	float fontSize;
+	struct t_line_extent extent;
+	int indentLevel;
+};
+
+/**
+ Where laying out a paragraph is up to. Width is committed up to the last break opportunity; the word since then moves to the next line whole
+ if it doesn't fit
+ */
+struct t_line_state {
+	float availableWidth;
+	float lineWidth;
+	float trailingSpaceWidth;
+	float wordWidth;
+	struct t_line_extent lineExtent;
+	struct t_line_extent wordExtent;
+	float pendingParagraphSpacing;
+};
+
+static bool isWideCodePoint(uint32_t codePoint) {
+	return (codePoint >= 0x1100 && codePoint <= 0x115F) || (codePoint >= 0x2E80 && codePoint <= 0xA4CF) || (codePoint >= 0xAC00 && codePoint <= 0xD7A3) || (codePoint >= 0xF900 && codePoint <= 0xFAFF) || (codePoint >= 0xFE30 && codePoint <= 0xFE4F) || (codePoint >= 0xFF00 && codePoint <= 0xFF60) || (codePoint >= 0xFFE0 && codePoint <= 0xFFE6) || (codePoint >= 0x1F300 && codePoint <= 0x1FAFF) || (codePoint >= 0x20000 && codePoint <= 0x3FFFD);
+}
+
+static enum t_break_class classifyCodePoint(uint32_t codePoint) {
+	switch (codePoint) {
+		case '\n':
+		case 0x2028:
+		case 0x2029:
+			return BREAK_CLASS_NEW_LINE;
+		case ' ':
+		case '\t':
+		case 0x1680:
+		case 0x205F:
+		case 0x3000:
+			return BREAK_CLASS_SPACE;
+		case '-':
+		case 0x2010:
+		case 0x2012:
+		case 0x2013:
+		case 0x2014:
+			return BREAK_CLASS_BREAK_AFTER;
+		case 0x200D:
+			return BREAK_CLASS_COMBINING;
+	}
+	//En quad through hair space, but not the (non breaking) figure space
+	if (codePoint >= 0x2000 && codePoint <= 0x200A && codePoint != 0x2007) {
+		return BREAK_CLASS_SPACE;
+	}
+	if ((codePoint >= 0x0300 && codePoint <= 0x036F) || (codePoint >= 0xFE00 && codePoint <= 0xFE0F) || (codePoint >= 0x1F3FB && codePoint <= 0x1F3FF) || (codePoint >= 0xE0020 && codePoint <= 0xE01EF)) {
+		return BREAK_CLASS_COMBINING;
+	}
+	return isWideCodePoint(codePoint) ? BREAK_CLASS_IDEOGRAPHIC : BREAK_CLASS_ALPHABETIC;
+}
+
+static float advanceForCodePoint(const struct t_layout_style *style, uint32_t codePoint, enum t_break_class breakClass) {
+	const struct t_font_metrics *face = style->face;
+	float advance;
+	if (breakClass == BREAK_CLASS_COMBINING || breakClass == BREAK_CLASS_NEW_LINE) {
+		advance = 0;
+	}else if (codePoint < 0x80) {
+		advance = face->asciiAdvances[codePoint];
+	}else {
+		advance = isWideCodePoint(codePoint) ? face->wideAdvance : face->otherAdvance;
+	}
+	return advance * style->fontSize;
+}
+
+/**
+ Work out the style of a run the same way addAttributeToString:forFormat:links: does
+ 
+ @param format The run's format, NULL for unstyled text
+ @param metrics The metrics
+ @param style (returned) The style
+ */
+static void resolveStyle(const struct t_format *format, const struct t_layout_metrics *metrics, struct t_layout_style *style) {
+	enum t_layout_face face = LAYOUT_FACE_PLAIN;
+	float fontSize = metrics->baseFontSize;
+	float baselineOffset = 0;
+	int indentLevel = 0;
+	if (format != NULL) {
+		int quoteLevel = formatQuoteLevel(*format);
+		int listNestLevel = formatListNestLevel(*format);
+		//The cached paragraph styles only go up to four, past which the quote level is used even inside lists
+		if (quoteLevel > 0 || listNestLevel - 1 > 0) {
+			int level = quoteLevel + listNestLevel - 1 > 0 ? listNestLevel - 1 : 0;
+			indentLevel = level >= 1 && level <= 4 ? level : quoteLevel;
+		}
+		
+		bool isBold = formatIsBold(*format);
+		bool isItalics = formatIsItalics(*format);
+		if (formatIsCode(*format)) {
+			//Code ignores every other font style
+			face = LAYOUT_FACE_CODE;
+		}else {
+			face = isBold && isItalics ? LAYOUT_FACE_BOLD_ITALICS : isBold ? LAYOUT_FACE_BOLD : isItalics ? LAYOUT_FACE_ITALICS : LAYOUT_FACE_PLAIN;
+			static const float headingScales[] = {1, 2, 1.5, 1.17, 1.12, 0.83, 0.75};
+			unsigned char hLevel = formatHLevel(*format);
+			if (hLevel < sizeof(headingScales) / sizeof(headingScales[0])) {
+				fontSize *= headingScales[hLevel];
+			}
+			unsigned char exponentLevel = formatExponentLevel(*format);
+			if (exponentLevel > 0) {
+				fontSize *= 0.75;
+				baselineOffset = exponentLevel < 3 ? exponentLevel * 10 : 40;
+			}
+		}
+	}
+	
+	style->face = &metrics->faces[face];
+	style->fontSize = fontSize;
+	style->extent.ascent = style->face->ascent * fontSize;
+	style->extent.descent = style->face->descent * fontSize;
+	style->extent.leading = style->face->leading * fontSize;
+	style->extent.baselineOffset = baselineOffset;
+	style->indentLevel = indentLevel;
+}
+
+static void mergeExtent(struct t_line_extent *extent, const struct t_line_extent *other) {
+	extent->ascent = other->ascent > extent->ascent ? other->ascent : extent->ascent;
+	extent->descent = other->descent > extent->descent ? other->descent : extent->descent;
+	extent->leading = other->leading > extent->leading ? other->leading : extent->leading;
+	extent->baselineOffset = other->baselineOffset > extent->baselineOffset ? other->baselineOffset : extent->baselineOffset;
+}
+
+static void emitLine(struct t_line_state *line, const struct t_line_extent *extent, struct t_layout_estimate *estimate) {
+	//Like DYLabel, a superscript makes its whole line taller by its offset
+	estimate->height += line->pendingParagraphSpacing + extent->ascent + extent->descent + extent->leading + extent->baselineOffset;
+	estimate->numberOfLines++;
+	line->pendingParagraphSpacing = 0;
+}
+
+/**
+ Reached a break opportunity, so the word so far stays on this line
+ */
+static void commitWord(struct t_line_state *line) {
+	line->lineWidth += line->trailingSpaceWidth + line->wordWidth;
+	line->trailingSpaceWidth = 0;
+	line->wordWidth = 0;
+	mergeExtent(&line->lineExtent, &line->wordExtent);
+	line->wordExtent = (struct t_line_extent){0, 0, 0, 0};
+}
+
+static void startLine(struct t_line_state *line) {
+	line->lineWidth = 0;
+	line->trailingSpaceWidth = 0;
+	line->lineExtent = (struct t_line_extent){0, 0, 0, 0};
+}
+
+/**
+ Decode the UTF-8 charachter at the start of text. Malformed bytes come out one at a time as themselves
+ 
+ @return Its length in bytes
+ */
+static size_t decodeCodePoint(const unsigned char text[], size_t length, uint32_t *codePoint) {
+	unsigned char lead = text[0];
+	size_t charachterLength = lead < 0x80 ? 1 : lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 0;
+	if (charachterLength <= 1 || charachterLength > length) {
+		*codePoint = lead;
+		return 1;
+	}
+	uint32_t value = lead & (0x7F >> charachterLength);
+	for (size_t i = 1; i < charachterLength; i++) {
+		if ((text[i] & 0xC0) != 0x80) {
+			*codePoint = lead;
+			return 1;
+		}
+		value = value << 6 | (text[i] & 0x3F);
+	}
+	*codePoint = value;
+	return charachterLength;
+}
+
+/**
+ Estimate the height of display text laid out at a width, styled the way FormatToAttributedString would style it
+ 
+ @param displayText The display text
+ @param displayTextLength The length of displayText in bytes
+ @param formats The linear formats, as returned by makeAttributesLinear
+ @param numberOfFormats The number of formats
+ @param metrics The fonts and paragraph styles
+ @param width The width of the label
+ @param estimate (returned) The estimated height and number of lines
+ */
+void estimateLayout(const char displayText[], size_t displayTextLength, const struct t_format formats[], int numberOfFormats, const struct t_layout_metrics *metrics, float width, struct t_layout_estimate *estimate) {
+	estimate->height = 0;
+	estimate->numberOfLines = 0;
+	
+	struct t_line_state line = {0};
+	bool isParagraphStart = true;
+	const unsigned char *text = (const unsigned char *)displayText;
+	unsigned int utf16Position = 0;
+	int formatIndex = 0;
+	const struct t_format *activeFormat = NULL;
+	struct t_layout_style style;
+	resolveStyle(NULL, metrics, &style);
+	
+	size_t i = 0;
+	while (i < displayTextLength) {
+		uint32_t codePoint;
+		i += decodeCodePoint(&text[i], displayTextLength - i, &codePoint);
+		
+		//Formats are in order, so the one covering this charachter (if any) is at or after the last
+		while (formatIndex < numberOfFormats && formats[formatIndex].endPosition <= utf16Position) {
+			formatIndex++;
+		}
+		const struct t_format *format = formatIndex < numberOfFormats && formats[formatIndex].startPosition <= utf16Position ? &formats[formatIndex] : NULL;
+		if (format != activeFormat) {
+			activeFormat = format;
+			resolveStyle(format, metrics, &style);
+		}
+		utf16Position += codePoint >= 0x10000 ? 2 : 1;
+		
+		//The first charachter's paragraph style applies to the whole paragraph
+		if (isParagraphStart) {
+			float indent = style.indentLevel * metrics->quotePadding;
+			line.availableWidth = width - 2 * indent;
+			if (line.availableWidth < 1) {
+				line.availableWidth = 1;
+			}
+			isParagraphStart = false;
+		}
+		
+		enum t_break_class breakClass = classifyCodePoint(codePoint);
+		float advance = advanceForCodePoint(&style, codePoint, breakClass);
+		switch (breakClass) {
+			case BREAK_CLASS_NEW_LINE:
+				commitWord(&line);
+				mergeExtent(&line.lineExtent, &style.extent);
+				emitLine(&line, &line.lineExtent, estimate);
+				line.pendingParagraphSpacing = metrics->paragraphSpacing;
+				startLine(&line);
+				isParagraphStart = true;
+				break;
+			case BREAK_CLASS_SPACE:
+				commitWord(&line);
+				line.trailingSpaceWidth += advance;
+				mergeExtent(&line.lineExtent, &style.extent);
+				break;
+			case BREAK_CLASS_COMBINING:
+				mergeExtent(&line.wordExtent, &style.extent);
+				break;
+			default:
+				if (breakClass == BREAK_CLASS_IDEOGRAPHIC) {
+					commitWord(&line);
+				}
+				if (line.lineWidth + line.trailingSpaceWidth + line.wordWidth + advance > line.availableWidth) {
+					//Wrap at the last break opportunity, then if the word alone is still too wide break it wherever it overflows
+					if (line.lineWidth > 0) {
+						emitLine(&line, &line.lineExtent, estimate);
+						startLine(&line);
+					}
+					if (line.wordWidth > 0 && line.wordWidth + advance > line.availableWidth) {
+						emitLine(&line, &line.wordExtent, estimate);
+						line.wordWidth = 0;
+						line.wordExtent = (struct t_line_extent){0, 0, 0, 0};
+					}
+				}
+				line.wordWidth += advance;
+				mergeExtent(&line.wordExtent, &style.extent);
+				if (breakClass != BREAK_CLASS_ALPHABETIC) {
+					commitWord(&line);
+				}
+				break;
+		}
+	}
+	
+	//Text ending in a new line doesn't get an empty line after it
+	if (!isParagraphStart) {
+		commitWord(&line);
+		emitLine(&line, &line.lineExtent, estimate);
+	}
+}
@@ -0,0 +1,62 @@
+//
+//  LayoutEstimate.h
+//  HTMLFastParse
+//
+
+#ifndef LayoutEstimate_h
+#define LayoutEstimate_h
+
+#include <stddef.h>
+#include "t_format.h"
+
+/**
+ The fonts FormatToAttributedString picks between, which index the metrics table
+ */
+enum t_layout_face {
+	LAYOUT_FACE_PLAIN = 0,
+	LAYOUT_FACE_BOLD,
+	LAYOUT_FACE_ITALICS,
+	LAYOUT_FACE_BOLD_ITALICS,
+	LAYOUT_FACE_CODE,
+	LAYOUT_FACE_COUNT
+};
+
+/**
+ One font's metrics, all for a 1pt font so they scale with the point size
+ */
+struct t_font_metrics {
+	//Advance of each ASCII charachter
+	float asciiAdvances[128];
+	//Advance of anything else narrow (Latin, Greek, Cyrillic...) and of wide charachters (CJK, emoji...)
+	float otherAdvance;
+	float wideAdvance;
+	float ascent;
+	//Positive, below the baseline
+	float descent;
+	float leading;
+};
+
+/**
+ Everything the estimator needs to know about how FormatToAttributedString styles text
+ */
+struct t_layout_metrics {
+	struct t_font_metrics faces[LAYOUT_FACE_COUNT];
+	//The body font size everything else is scaled from
+	float baseFontSize;
+	//Indent on each side per quote or list level
+	float quotePadding;
+	//Space after every paragraph
+	float paragraphSpacing;
+};
+
+/**
+ The estimated size of laid out text
+ */
+struct t_layout_estimate {
+	float height;
+	int numberOfLines;
+};
+
+void estimateLayout(const char displayText[], size_t displayTextLength, const struct t_format formats[], int numberOfFormats, const struct t_layout_metrics *metrics, float width, struct t_layout_estimate *estimate);
+
+#endif /* LayoutEstimate_h */
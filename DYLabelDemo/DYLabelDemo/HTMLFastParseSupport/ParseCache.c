@@ -0,0 +1,362 @@
+//
+//  ParseCache.c
+//  HTMLFastParse
+//
+//  A bounded cache of parse results keyed by a hash of the input, so that re-rendering the same comment (scrolling back, refreshing,
+//  collapsing and expanding) doesn't pay for the whole pipeline again. Results are immutable and reference counted so any number of
+//  threads can share them, and entries are evicted with CLOCK once the cache goes over its byte budget.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+#include "ParseCache.h"
+#include "C_HTML_Parser.h"
+
+#define PARSE_CACHE_INITIAL_BUCKETS 64
+
+/**
+ A cached parse. The entry, its document and everything the document points at live in one allocation
+ */
+struct t_cache_entry {
+	//First so that a document we hand out can be turned back into its entry
+	struct t_parsed_document document;
+	//One held by the cache while the entry is cached plus one per acquireParsedHTML
+	_Atomic int referenceCount;
+	//Set by every hit and cleared as the clock hand sweeps past
+	_Atomic bool isReferenced;
+	uint64_t hash;
+	//The same input parses differently in each dialect
+	enum t_html_dialect dialect;
+	//The input is kept so a hash collision can never hand back somebody else's document
+	const char *html;
+	size_t htmlLength;
+	//Everything this entry costs, counted against the budget
+	size_t entrySize;
+	struct t_cache_entry *nextInBucket;
+	struct t_cache_entry *previousInClock;
+	struct t_cache_entry *nextInClock;
+};
+
+struct t_parse_cache {
+	//Lookups only read, so hits on different threads never wait on each other. Inserting and evicting write
+	pthread_rwlock_t lock;
+	struct t_cache_entry **buckets;
+	size_t numberOfBuckets;
+	//The next entry CLOCK will consider evicting. NULL when the cache is empty
+	struct t_cache_entry *clockHand;
+	size_t byteBudget;
+	size_t bytesUsed;
+	size_t numberOfEntries;
+	
+	_Atomic uint64_t hits;
+	_Atomic uint64_t misses;
+	_Atomic uint64_t evictions;
+	
+	//Parser contexts for misses, kept around between them
+	pthread_mutex_t contextLock;
+	struct t_parser_context **idleContexts;
+	int numberOfIdleContexts;
+	int idleContextsCapacity;
+};
+
+static uint64_t multiplyMix(uint64_t a, uint64_t b) {
+	__uint128_t product = (__uint128_t)a * b;
+	return (uint64_t)product ^ (uint64_t)(product >> 64);
+}
+
+static uint64_t read64(const char bytes[]) {
+	uint64_t value;
+	memcpy(&value, bytes, sizeof(uint64_t));
+	return value;
+}
+
+/**
+ Hash the input and its dialect, 16 bytes at a time with a multiply and fold in the style of wyhash
+ */
+static uint64_t hashHTML(const char html[], size_t length, enum t_html_dialect dialect) {
+	uint64_t hash = multiplyMix(length ^ 0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL ^ dialect);
+	size_t i = 0;
+	for (; i + 16 <= length; i += 16) {
+		hash = multiplyMix(read64(&html[i]) ^ 0x8ebc6af09c88c6e3ULL, read64(&html[i + 8]) ^ hash);
+	}
+	//Whatever is left, zero padded
+	char tail[16] = {0};
+	memcpy(tail, &html[i], length - i);
+	return multiplyMix(read64(&tail[0]) ^ 0x589965cc75374cc3ULL ^ hash, read64(&tail[8]) ^ 0x1d8e4e27c47d124fULL);
+}
+
+static size_t alignUp(size_t size, size_t alignment) {
+	return (size + alignment - 1) / alignment * alignment;
+}
+
+static void releaseEntry(struct t_cache_entry *entry) {
+	if (atomic_fetch_sub(&entry->referenceCount, 1) == 1) {
+		free(entry);
+	}
+}
+
+/**
+ Create a parse cache
+ 
+ @param byteBudget How many bytes of results to keep before evicting. A result larger than this is never cached
+ @return The cache. Release with freeParseCache
+ */
+struct t_parse_cache* createParseCache(size_t byteBudget) {
+	struct t_parse_cache *cache = calloc(1, sizeof(struct t_parse_cache));
+	pthread_rwlock_init(&cache->lock, NULL);
+	pthread_mutex_init(&cache->contextLock, NULL);
+	cache->numberOfBuckets = PARSE_CACHE_INITIAL_BUCKETS;
+	cache->buckets = calloc(cache->numberOfBuckets, sizeof(struct t_cache_entry *));
+	cache->byteBudget = byteBudget;
+	atomic_init(&cache->hits, 0);
+	atomic_init(&cache->misses, 0);
+	atomic_init(&cache->evictions, 0);
+	return cache;
+}
+
+/**
+ Find a cached entry. The caller must hold the lock
+ */
+static struct t_cache_entry* findEntry(struct t_parse_cache *cache, uint64_t hash, const char html[], size_t length, enum t_html_dialect dialect) {
+	for (struct t_cache_entry *entry = cache->buckets[hash & (cache->numberOfBuckets - 1)]; entry != NULL; entry = entry->nextInBucket) {
+		if (entry->hash == hash && entry->dialect == dialect && entry->htmlLength == length && memcmp(entry->html, html, length) == 0) {
+			return entry;
+		}
+	}
+	return NULL;
+}
+
+static void growBuckets(struct t_parse_cache *cache) {
+	size_t numberOfBuckets = cache->numberOfBuckets * 2;
+	struct t_cache_entry **buckets = calloc(numberOfBuckets, sizeof(struct t_cache_entry *));
+	for (size_t b = 0; b < cache->numberOfBuckets; b++) {
+		struct t_cache_entry *entry = cache->buckets[b];
+		while (entry != NULL) {
+			struct t_cache_entry *next = entry->nextInBucket;
+			struct t_cache_entry **bucket = &buckets[entry->hash & (numberOfBuckets - 1)];
+			entry->nextInBucket = *bucket;
+			*bucket = entry;
+			entry = next;
+		}
+	}
+	free(cache->buckets);
+	cache->buckets = buckets;
+	cache->numberOfBuckets = numberOfBuckets;
+}
+
+/**
+ Add an entry to the cache, which takes a reference to it. The caller must hold the lock for writing
+ */
+static void insertEntry(struct t_parse_cache *cache, struct t_cache_entry *entry) {
+	if (cache->numberOfEntries >= cache->numberOfBuckets) {
+		growBuckets(cache);
+	}
+	struct t_cache_entry **bucket = &cache->buckets[entry->hash & (cache->numberOfBuckets - 1)];
+	entry->nextInBucket = *bucket;
+	*bucket = entry;
+	
+	//Go in just behind the hand so we're the last to be considered
+	if (cache->clockHand == NULL) {
+		entry->previousInClock = entry;
+		entry->nextInClock = entry;
+		cache->clockHand = entry;
+	}else {
+		entry->nextInClock = cache->clockHand;
+		entry->previousInClock = cache->clockHand->previousInClock;
+		entry->previousInClock->nextInClock = entry;
+		cache->clockHand->previousInClock = entry;
+	}
+	
+	atomic_fetch_add(&entry->referenceCount, 1);
+	cache->bytesUsed += entry->entrySize;
+	cache->numberOfEntries++;
+}
+
+/**
+ Remove an entry from the cache, dropping the cache's reference. The caller must hold the lock for writing
+ */
+static void removeEntry(struct t_parse_cache *cache, struct t_cache_entry *entry) {
+	struct t_cache_entry **link = &cache->buckets[entry->hash & (cache->numberOfBuckets - 1)];
+	while (*link != entry) {
+		link = &(*link)->nextInBucket;
+	}
+	*link = entry->nextInBucket;
+	
+	if (entry->nextInClock == entry) {
+		cache->clockHand = NULL;
+	}else {
+		entry->previousInClock->nextInClock = entry->nextInClock;
+		entry->nextInClock->previousInClock = entry->previousInClock;
+		if (cache->clockHand == entry) {
+			cache->clockHand = entry->nextInClock;
+		}
+	}
+	
+	cache->bytesUsed -= entry->entrySize;
+	cache->numberOfEntries--;
+	releaseEntry(entry);
+}
+
+/**
+ Evict entries with CLOCK until size more bytes fit in the budget. Entries hit since the hand last passed get another lap. The caller must hold the lock for writing
+ */
+static void evictUntilFits(struct t_parse_cache *cache, size_t size) {
+	while (cache->clockHand != NULL && cache->bytesUsed + size > cache->byteBudget) {
+		struct t_cache_entry *entry = cache->clockHand;
+		if (atomic_exchange(&entry->isReferenced, false)) {
+			cache->clockHand = entry->nextInClock;
+		}else {
+			removeEntry(cache, entry);
+			atomic_fetch_add_explicit(&cache->evictions, 1, memory_order_relaxed);
+		}
+	}
+}
+
+static struct t_parser_context* takeParserContext(struct t_parse_cache *cache) {
+	struct t_parser_context *context = NULL;
+	pthread_mutex_lock(&cache->contextLock);
+	if (cache->numberOfIdleContexts > 0) {
+		context = cache->idleContexts[--cache->numberOfIdleContexts];
+	}
+	pthread_mutex_unlock(&cache->contextLock);
+	return context != NULL ? context : createParserContext();
+}
+
+static void returnParserContext(struct t_parse_cache *cache, struct t_parser_context *context) {
+	pthread_mutex_lock(&cache->contextLock);
+	if (cache->numberOfIdleContexts == cache->idleContextsCapacity) {
+		cache->idleContextsCapacity = cache->idleContextsCapacity > 0 ? cache->idleContextsCapacity * 2 : 4;
+		cache->idleContexts = realloc(cache->idleContexts, cache->idleContextsCapacity * sizeof(struct t_parser_context *));
+	}
+	cache->idleContexts[cache->numberOfIdleContexts++] = context;
+	pthread_mutex_unlock(&cache->contextLock);
+}
+
+/**
+ Parse a document into a new entry holding one reference for the caller
+ */
+static struct t_cache_entry* parseEntry(struct t_parse_cache *cache, const char html[], size_t length, enum t_html_dialect dialect, uint64_t hash) {
+	struct t_parser_context *context = takeParserContext(cache);
+	setParserContextDialect(context, dialect);
+	struct t_parsed_document parsed;
+	parseHTMLWithContext(context, html, length, &parsed);
+	
+	//Lay the entry out as [entry][packed document][input]
+	size_t packedOffset = alignUp(sizeof(struct t_cache_entry), sizeof(max_align_t));
+	size_t htmlOffset = packedOffset + packedDocumentSize(&parsed);
+	size_t entrySize = htmlOffset + length;
+	
+	char *block = malloc(entrySize);
+	struct t_cache_entry *entry = (struct t_cache_entry *)block;
+	packParsedDocument(&parsed, &entry->document, block + packedOffset);
+	returnParserContext(cache, context);
+	
+	memcpy(block + htmlOffset, html, length);
+	entry->html = block + htmlOffset;
+	entry->htmlLength = length;
+	entry->hash = hash;
+	entry->dialect = dialect;
+	entry->entrySize = entrySize;
+	atomic_init(&entry->referenceCount, 1);
+	atomic_init(&entry->isReferenced, false);
+	return entry;
+}
+
+/**
+ Get the parse of a Reddit document, from the cache if we've seen it before. Safe to call from any number of threads at once
+ 
+ @param cache The cache
+ @param html The HTML
+ @param length The length of html in bytes, excluding any null byte
+ @return The parse. It is immutable, may be shared with other callers and stays valid (even if evicted) until it is given to releaseParsedHTML
+ */
+const struct t_parsed_document* acquireParsedHTML(struct t_parse_cache *cache, const char html[], size_t length) {
+	return acquireParsedHTMLInDialect(cache, html, length, HTML_DIALECT_REDDIT);
+}
+
+/**
+ acquireParsedHTML for a document in any dialect. Documents in different dialects are cached separately, even when their HTML is the same
+ */
+const struct t_parsed_document* acquireParsedHTMLInDialect(struct t_parse_cache *cache, const char html[], size_t length, enum t_html_dialect dialect) {
+	uint64_t hash = hashHTML(html, length, dialect);
+	
+	pthread_rwlock_rdlock(&cache->lock);
+	struct t_cache_entry *entry = findEntry(cache, hash, html, length, dialect);
+	if (entry != NULL) {
+		atomic_fetch_add(&entry->referenceCount, 1);
+		atomic_store_explicit(&entry->isReferenced, true, memory_order_relaxed);
+	}
+	pthread_rwlock_unlock(&cache->lock);
+	if (entry != NULL) {
+		atomic_fetch_add_explicit(&cache->hits, 1, memory_order_relaxed);
+		return &entry->document;
+	}
+	atomic_fetch_add_explicit(&cache->misses, 1, memory_order_relaxed);
+	
+	//Parse without holding the lock so everyone else's hits carry on meanwhile
+	entry = parseEntry(cache, html, length, dialect, hash);
+	
+	pthread_rwlock_wrlock(&cache->lock);
+	struct t_cache_entry *existing = findEntry(cache, hash, html, length, dialect);
+	if (existing != NULL) {
+		//Someone else parsed it at the same time, share theirs
+		atomic_fetch_add(&existing->referenceCount, 1);
+		pthread_rwlock_unlock(&cache->lock);
+		releaseEntry(entry);
+		return &existing->document;
+	}
+	if (entry->entrySize <= cache->byteBudget) {
+		evictUntilFits(cache, entry->entrySize);
+		insertEntry(cache, entry);
+	}
+	pthread_rwlock_unlock(&cache->lock);
+	return &entry->document;
+}
+
+/**
+ Give back a document from acquireParsedHTML
+ */
+void releaseParsedHTML(const struct t_parsed_document *document) {
+	releaseEntry((struct t_cache_entry *)document);
+}
+
+void getParseCacheStatistics(struct t_parse_cache *cache, struct t_parse_cache_statistics *statistics) {
+	statistics->hits = atomic_load_explicit(&cache->hits, memory_order_relaxed);
+	statistics->misses = atomic_load_explicit(&cache->misses, memory_order_relaxed);
+	statistics->evictions = atomic_load_explicit(&cache->evictions, memory_order_relaxed);
+	pthread_rwlock_rdlock(&cache->lock);
+	statistics->bytesUsed = cache->bytesUsed;
+	statistics->numberOfEntries = cache->numberOfEntries;
+	pthread_rwlock_unlock(&cache->lock);
+}
+
+/**
+ Drop every cached result. Documents which are still acquired stay valid until they are released
+ */
+void clearParseCache(struct t_parse_cache *cache) {
+	pthread_rwlock_wrlock(&cache->lock);
+	while (cache->clockHand != NULL) {
+		removeEntry(cache, cache->clockHand);
+	}
+	pthread_rwlock_unlock(&cache->lock);
+}
+
+/**
+ Release a cache. Documents which are still acquired stay valid until they are released
+ */
+void freeParseCache(struct t_parse_cache *cache) {
+	clearParseCache(cache);
+	for (int i = 0; i < cache->numberOfIdleContexts; i++) {
+		freeParserContext(cache->idleContexts[i]);
+	}
+	free(cache->idleContexts);
+	free(cache->buckets);
+	pthread_mutex_destroy(&cache->contextLock);
+	pthread_rwlock_destroy(&cache->lock);
+	free(cache);
+}
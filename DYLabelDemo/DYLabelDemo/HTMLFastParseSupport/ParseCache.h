@@ -0,0 +1,34 @@
+//
+//  ParseCache.h
+//  HTMLFastParse
+//
+
+#ifndef ParseCache_h
+#define ParseCache_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include "C_HTML_Parser.h"
+
+/**
+ How a parse cache has been doing since it was created
+ */
+struct t_parse_cache_statistics {
+	uint64_t hits;
+	uint64_t misses;
+	uint64_t evictions;
+	//Bytes held by cached results, counted against the byte budget
+	size_t bytesUsed;
+	size_t numberOfEntries;
+};
+
+struct t_parse_cache;
+struct t_parse_cache* createParseCache(size_t byteBudget);
+const struct t_parsed_document* acquireParsedHTML(struct t_parse_cache *cache, const char html[], size_t length);
+const struct t_parsed_document* acquireParsedHTMLInDialect(struct t_parse_cache *cache, const char html[], size_t length, enum t_html_dialect dialect);
+void releaseParsedHTML(const struct t_parsed_document *document);
+void getParseCacheStatistics(struct t_parse_cache *cache, struct t_parse_cache_statistics *statistics);
+void clearParseCache(struct t_parse_cache *cache);
+void freeParseCache(struct t_parse_cache *cache);
+
+#endif /* ParseCache_h */
@@ -0,0 +1,44 @@
+//
+//  ParseStatistics.c
+//  HTMLFastParse
+//
+
+#include "ParseStatistics.h"
+
+#ifdef HTMLFASTPARSE_STATISTICS
+
+#include <stddef.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+_Thread_local struct t_parse_statistics *currentParseStatistics = NULL;
+
+/**
+ Start (or stop) collecting statistics for everything parsed on the calling thread
+ 
+ @param statistics Where the counts are added to, or NULL to stop collecting
+ */
+void collectParseStatistics(struct t_parse_statistics *statistics) {
+	currentParseStatistics = statistics;
+}
+
+/**
+ A cheap, monotonic clock for timing phases. The cycle counter where we can read it, nanoseconds otherwise
+ */
+uint64_t readParseStatisticsClock(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#elif defined(__aarch64__)
+	uint64_t ticks;
+	__asm__ volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+	return ticks;
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+#endif
+}
+
+#endif
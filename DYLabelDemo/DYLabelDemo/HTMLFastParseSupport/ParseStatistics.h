@@ -0,0 +1,82 @@
+//
+//  ParseStatistics.h
+//  HTMLFastParse
+//
+//  Optional counters for what the parser runs into: malformed markup it recovers from, how much it allocates and where its time goes.
+//  Only compiled in when HTMLFASTPARSE_STATISTICS is defined; otherwise every counter below expands to nothing.
+//
+
+#ifndef ParseStatistics_h
+#define ParseStatistics_h
+
+#ifdef HTMLFASTPARSE_STATISTICS
+
+#include <stdint.h>
+
+/**
+ Totals for everything parsed on a thread while it was collecting. Zero one to start
+ */
+struct t_parse_statistics {
+	//Input handed to the tokenizer
+	uint64_t bytesScanned;
+	uint64_t tagsOpened;
+	uint64_t tagsClosed;
+	//<br/>, <hr/> and friends
+	uint64_t tagsSelfClosed;
+	//Still open when their document ended, and dropped
+	uint64_t tagsUnclosed;
+	//Closing tags with nothing of their kind open, and stray '>'. Both are ignored
+	uint64_t emptyStackPops;
+	//Tags closed early because a tag they were opened inside closed first
+	uint64_t tagsMisnested;
+	//Opening tags dropped because the stack was already STACK_MAXIMUM_DEPTH deep
+	uint64_t tagsTooDeep;
+	//Tags makeAttributesLinear had no style for
+	uint64_t tagsUnrecognized;
+	uint64_t entitiesDecoded;
+	//Entities which were copied over as text, either because we don't know them or because their document ended part way through
+	uint64_t entitiesFailed;
+	//Linear formats emitted by makeAttributesLinear
+	uint64_t runsEmitted;
+	//Calls to the parser's allocators (growing counts too) and the bytes asked for
+	uint64_t allocations;
+	uint64_t allocatedBytes;
+	//The deepest the tag stack got
+	uint64_t maximumNestingDepth;
+	//Cycle (or, without a cycle counter, nanosecond) counts for each phase
+	uint64_t tokenizeCycles;
+	uint64_t linearizeCycles;
+};
+
+void collectParseStatistics(struct t_parse_statistics *statistics);
+uint64_t readParseStatisticsClock(void);
+
+//Where the current thread's counts go. NULL when it isn't collecting
+extern _Thread_local struct t_parse_statistics *currentParseStatistics;
+
+#define PARSE_STATISTICS_ADD(field, amount) do { \
+	if (currentParseStatistics != NULL) { \
+		currentParseStatistics->field += (amount); \
+	} \
+} while (0)
+
+#define PARSE_STATISTICS_MAX(field, value) do { \
+	if (currentParseStatistics != NULL && currentParseStatistics->field < (uint64_t)(value)) { \
+		currentParseStatistics->field = (value); \
+	} \
+} while (0)
+
+//Time a phase: PARSE_STATISTICS_START(start) ... PARSE_STATISTICS_STOP(start, tokenizeCycles)
+#define PARSE_STATISTICS_START(name) uint64_t name = currentParseStatistics != NULL ? readParseStatisticsClock() : 0
+#define PARSE_STATISTICS_STOP(name, field) PARSE_STATISTICS_ADD(field, readParseStatisticsClock() - name)
+
+#else
+
+#define PARSE_STATISTICS_ADD(field, amount) ((void)0)
+#define PARSE_STATISTICS_MAX(field, value) ((void)0)
+#define PARSE_STATISTICS_START(name)
+#define PARSE_STATISTICS_STOP(name, field) ((void)0)
+
+#endif
+
+#endif /* ParseStatistics_h */
@@ -5,43 +5,48 @@
 // C program for array implementation of stack
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <limits.h>
 #include "t_tag.h"
 #include "Stack.h"
+#include "Allocator.h"
 
-// A structure to represent a stack
-struct Stack
+// function to set up an empty stack. Items live inside the stack until
+// there are more than STACK_INLINE_CAPACITY, then in memory from allocator
+void initializeStack(struct Stack* stack, const struct t_allocator* allocator)
 {
-	int top;
-	unsigned capacity;
-	struct t_tag* array;
-};
-
-// function to create a stack of given capacity. It initializes size of
-// stack as 0
-struct Stack* createStack(unsigned capacity)
-{
-	struct Stack* stack = (struct Stack*) malloc(sizeof(struct Stack));
-	stack->capacity = capacity;
+	stack->capacity = STACK_INLINE_CAPACITY;
 	stack->top = -1;
-	stack->array = malloc(stack->capacity * sizeof(struct t_tag));
-	return stack;
+	stack->allocator = allocator;
+	stack->array = stack->inlineArray;
 }
 
-// Stack is full when top is equal to the last index
-int isFull(struct Stack* stack)
-{   return stack->top == stack->capacity - 1; }
-
 // Stack is empty when top is equal to -1
 int isEmpty(struct Stack* stack)
 {   return stack->top == -1;  }
 
-// Function to add an item to stack.  It increases top by 1
-void push(struct Stack* stack, struct t_tag item)
+// Function to add an item to stack.  It increases top by 1 and doubles
+// the capacity when the stack is full. Returns false (and leaves the stack
+// alone) if it's already STACK_MAXIMUM_DEPTH deep
+bool push(struct Stack* stack, struct t_tag item)
 {
-	if (isFull(stack))
-		return;
+	if (stack->top + 1 >= STACK_MAXIMUM_DEPTH) {
+		return false;
+	}
+	if (stack->top + 1 == (int)stack->capacity) {
+		unsigned newCapacity = stack->capacity * 2;
+		if (stack->array == stack->inlineArray) {
+			//Spill onto the heap
+			stack->array = allocatorAllocate(stack->allocator, newCapacity * sizeof(struct t_tag));
+			memcpy(stack->array, stack->inlineArray, stack->capacity * sizeof(struct t_tag));
+		}else {
+			stack->array = allocatorReallocate(stack->allocator, stack->array, stack->capacity * sizeof(struct t_tag), newCapacity * sizeof(struct t_tag));
+		}
+		stack->capacity = newCapacity;
+	}
 	stack->array[++stack->top] = item;
+	PARSE_STATISTICS_MAX(maximumNestingDepth, stack->top + 1);
+	return true;
 }
 
 // Function to remove an item from stack.  It decreases top by 1
@@ -52,6 +57,37 @@ struct t_tag* pop(struct Stack* stack)
 	return &stack->array[stack->top--];
 }
 
-void prepareForFree(struct Stack* stack) {
-	free(stack->array);
+// Function to get the number of items on the stack
+int stackSize(struct Stack* stack)
+{   return stack->top + 1;  }
+
+// Function to look at an item without removing it. Index zero is the bottom of the stack
+struct t_tag* stackItem(struct Stack* stack, int index)
+{   return &stack->array[index];  }
+
+// Function to find the item of a kind nearest the top, -1 if there isn't one
+int findInStack(struct Stack* stack, unsigned char kind)
+{
+	for (int i = stack->top; i >= 0; i--) {
+		if (stack->array[i].kind == kind) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+// Function to drop everything above the first size items
+void truncateStack(struct Stack* stack, int size)
+{
+	if (size < stack->top + 1) {
+		stack->top = size - 1;
+	}
+}
+
+// Function to give back any heap memory. The stack can be initialized again afterwards
+void releaseStack(struct Stack* stack) {
+	if (stack->array != stack->inlineArray) {
+		allocatorDeallocate(stack->allocator, stack->array, stack->capacity * sizeof(struct t_tag));
+	}
+	initializeStack(stack, stack->allocator);
 }
@@ -1,16 +1,34 @@
 //
 // Created by Allison Husain on 4/27/18.
 //
+#include <stdbool.h>
 #include "t_tag.h"
+#include "Allocator.h"
 #ifndef HTMLTOATTR_STACK_H
 #define HTMLTOATTR_STACK_H
 
+//Tags kept inside the stack itself. Comments rarely nest deeper than this, so most documents never put the stack on the heap
+#define STACK_INLINE_CAPACITY 16
+//The most tags a stack will hold, so memory stays bounded however deep the input nests
+#define STACK_MAXIMUM_DEPTH 1024
 
-struct Stack;
-struct Stack* createStack(unsigned capacity);
-int isFull(struct Stack* stack);
+// A stack of open tags, embedded in whatever owns it. It may point into itself so it must not be copied
+struct Stack
+{
+	int top;
+	unsigned capacity;
+	struct t_tag* array;
+	const struct t_allocator* allocator;
+	struct t_tag inlineArray[STACK_INLINE_CAPACITY];
+};
+
+void initializeStack(struct Stack* stack, const struct t_allocator* allocator);
 int isEmpty(struct Stack* stack);
-void push(struct Stack* stack, struct t_tag);
+bool push(struct Stack* stack, struct t_tag);
 struct t_tag* pop(struct Stack* stack);
-void prepareForFree(struct Stack* stack);
+int stackSize(struct Stack* stack);
+struct t_tag* stackItem(struct Stack* stack, int index);
+int findInStack(struct Stack* stack, unsigned char kind);
+void truncateStack(struct Stack* stack, int size);
+void releaseStack(struct Stack* stack);
 #endif //HTMLTOATTR_STACK_H
@@ -0,0 +1,236 @@
+//
+//  TextScan.c
+//  HTMLFastParse
+//
+//  Block-at-a-time scanning of plain display text. The tokenizer spends most of its time in runs of text which contain nothing
+//  special, so instead of looking at them one byte at a time we look at 16 or 32 bytes at once with whatever vector unit we have.
+//  The same pass counts UTF-16 units and validates the UTF-8, which for the usual all ASCII block is just one more mask.
+//
+
+#include <stdint.h>
+
+#include "TextScan.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+//How many bytes we look at at once
+#define SCAN_BLOCK_SIZE 32
+//How many mask bits each byte gets
+#define SCAN_BITS_PER_BYTE 1
+
+static inline void scanBlock(const char *block, uint64_t *special, uint64_t *visible, uint64_t *wide, uint64_t *nonASCII) {
+	__m256i bytes = _mm256_loadu_si256((const __m256i *)block);
+	__m256i isSpecial = _mm256_or_si256(
+		_mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('<')), _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('>'))),
+		_mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('&')), _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n'))));
+	*special = (uint32_t)_mm256_movemask_epi8(isSpecial);
+	//Signed compare: anything above 0xBF (as a signed char) is either ASCII or a lead byte, i.e. not a 10xxxxxx continuation byte
+	*visible = (uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8((char)0xBF)));
+	//Unsigned >= 0xF0 (via max) is a four byte lead
+	__m256i wideLead = _mm256_set1_epi8((char)0xF0);
+	*wide = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(bytes, wideLead), bytes));
+	*nonASCII = (uint32_t)_mm256_movemask_epi8(bytes);
+}
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define SCAN_BLOCK_SIZE 16
+#define SCAN_BITS_PER_BYTE 1
+
+static inline void scanBlock(const char *block, uint64_t *special, uint64_t *visible, uint64_t *wide, uint64_t *nonASCII) {
+	__m128i bytes = _mm_loadu_si128((const __m128i *)block);
+	__m128i isSpecial = _mm_or_si128(
+		_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('<')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('>'))),
+		_mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('&')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n'))));
+	*special = (uint16_t)_mm_movemask_epi8(isSpecial);
+	*visible = (uint16_t)_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, _mm_set1_epi8((char)0xBF)));
+	*wide = (uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(bytes, _mm_set1_epi8((char)0xF0)), bytes));
+	*nonASCII = (uint16_t)_mm_movemask_epi8(bytes);
+}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define SCAN_BLOCK_SIZE 16
+//NEON has no movemask, so we narrow each byte's compare result to a nibble instead
+#define SCAN_BITS_PER_BYTE 4
+
+static inline uint64_t neonMask(uint8x16_t compare) {
+	return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(compare), 4)), 0);
+}
+
+static inline void scanBlock(const char *block, uint64_t *special, uint64_t *visible, uint64_t *wide, uint64_t *nonASCII) {
+	uint8x16_t bytes = vld1q_u8((const uint8_t *)block);
+	uint8x16_t isSpecial = vorrq_u8(
+		vorrq_u8(vceqq_u8(bytes, vdupq_n_u8('<')), vceqq_u8(bytes, vdupq_n_u8('>'))),
+		vorrq_u8(vceqq_u8(bytes, vdupq_n_u8('&')), vceqq_u8(bytes, vdupq_n_u8('\n'))));
+	*special = neonMask(isSpecial);
+	*visible = neonMask(vcgtq_s8(vreinterpretq_s8_u8(bytes), vdupq_n_s8((int8_t)0xBF)));
+	*wide = neonMask(vcgeq_u8(bytes, vdupq_n_u8(0xF0)));
+	*nonASCII = neonMask(vcgeq_u8(bytes, vdupq_n_u8(0x80)));
+}
+#endif
+
+/**
+ Validate the next piece of a UTF-8 string
+ 
+ @param validator Where the previous piece left off. isInvalid is set (and stays set) at the first ill formed sequence
+ @param text The next piece
+ @param length The number of bytes in text
+ */
+void validateUTF8(struct t_utf8_validator *validator, const char text[], size_t length) {
+	if (validator->isInvalid) {
+		//We only report whether the whole string is valid so there's nothing more to find out
+		return;
+	}
+	for (size_t i = 0; i < length; i++) {
+		unsigned char byte = text[i];
+		if (validator->pendingContinuations > 0) {
+			if (byte < validator->nextMinimum || byte > validator->nextMaximum) {
+				validator->isInvalid = true;
+				return;
+			}
+			validator->pendingContinuations--;
+			validator->nextMinimum = 0x80;
+			validator->nextMaximum = 0xBF;
+			continue;
+		}
+		if (byte < 0x80) {
+			continue;
+		}
+		
+		//A lead byte. The ranges for the first continuation byte come from the well formed sequences table in the Unicode standard
+		validator->nextMinimum = 0x80;
+		validator->nextMaximum = 0xBF;
+		if (byte >= 0xC2 && byte <= 0xDF) {
+			validator->pendingContinuations = 1;
+		}else if (byte >= 0xE0 && byte <= 0xEF) {
+			validator->pendingContinuations = 2;
+			if (byte == 0xE0) {
+				validator->nextMinimum = 0xA0;
+			}else if (byte == 0xED) {
+				validator->nextMaximum = 0x9F;
+			}
+		}else if (byte >= 0xF0 && byte <= 0xF4) {
+			validator->pendingContinuations = 3;
+			if (byte == 0xF0) {
+				validator->nextMinimum = 0x90;
+			}else if (byte == 0xF4) {
+				validator->nextMaximum = 0x8F;
+			}
+		}else {
+			//A stray continuation byte, or a lead byte which could only start an overlong or out of range charachter
+			validator->isInvalid = true;
+			return;
+		}
+	}
+}
+
+/**
+ Finish validating a UTF-8 string. The validator is reset for the next string afterwards
+ 
+ @param validator The validator
+ @return If the whole string was well formed
+ */
+bool finishUTF8Validation(struct t_utf8_validator *validator) {
+	//A string can't end part way through a charachter
+	bool isValid = !validator->isInvalid && validator->pendingContinuations == 0;
+	validator->pendingContinuations = 0;
+	validator->isInvalid = false;
+	return isValid;
+}
+
+/**
+ Find how much of text is plain display text, i.e. everything up to the next '<', '>', '&' or new line (which the tokenizer needs to handle itself)
+ 
+ @param text The text to scan
+ @param length The number of bytes in text
+ @param visibleLength (returned) The number of NSString (UTF-16) charachters in the plain run. Matches getVisibleByteEffectForCharachter summed over each byte
+ @param validator The UTF-8 validation of the display text so far, continued over the plain run
+ @return The number of plain bytes at the start of text
+ */
+size_t scanPlainText(const char text[], size_t length, int* visibleLength, struct t_utf8_validator *validator) {
+	size_t position = 0;
+	int visible = 0;
+	
+#ifdef SCAN_BLOCK_SIZE
+	while (position + SCAN_BLOCK_SIZE <= length) {
+		uint64_t special, visibleMask, wideMask, nonASCIIMask;
+		scanBlock(&text[position], &special, &visibleMask, &wideMask, &nonASCIIMask);
+		//Only what comes before the first special byte is part of the run
+		uint64_t before = special != 0 ? (special & (~special + 1)) - 1 : ~(uint64_t)0;
+		size_t runLength = special != 0 ? __builtin_ctzll(special) / SCAN_BITS_PER_BYTE : SCAN_BLOCK_SIZE;
+		if ((nonASCIIMask & before) != 0 || validator->pendingContinuations != 0) {
+			//ASCII is always valid, anything else needs a closer look
+			validateUTF8(validator, &text[position], runLength);
+		}
+		visible += (__builtin_popcountll(visibleMask & before) + __builtin_popcountll(wideMask & before)) / SCAN_BITS_PER_BYTE;
+		if (special != 0) {
+			*visibleLength = visible;
+			return position + runLength;
+		}
+		position += SCAN_BLOCK_SIZE;
+	}
+#endif
+	
+	//Portable path, also used for whatever is left over after the last full block
+	size_t portableStart = position;
+	for (; position < length; position++) {
+		unsigned char charachter = text[position];
+		if (charachter == '<' || charachter == '>' || charachter == '&' || charachter == '\n') {
+			break;
+		}
+		//Everything but 10xxxxxx continuation bytes counts, four byte charachters count twice (they're surrogate pairs in UTF-16)
+		visible += (charachter & 0xC0) != 0x80;
+		visible += charachter >= 0xF0;
+	}
+	validateUTF8(validator, &text[portableStart], position - portableStart);
+	*visibleLength = visible;
+	return position;
+}
+
+/**
+ Count the NSString (UTF-16) charachters in some UTF-8 text, the same way scanPlainText does
+ 
+ @param text The text
+ @param length The number of bytes in text
+ @return The number of UTF-16 units
+ */
+size_t countUTF16Units(const char text[], size_t length) {
+	size_t position = 0;
+	size_t units = 0;
+	
+#ifdef SCAN_BLOCK_SIZE
+	for (; position + SCAN_BLOCK_SIZE <= length; position += SCAN_BLOCK_SIZE) {
+		uint64_t special, visibleMask, wideMask, nonASCIIMask;
+		scanBlock(&text[position], &special, &visibleMask, &wideMask, &nonASCIIMask);
+		units += (__builtin_popcountll(visibleMask) + __builtin_popcountll(wideMask)) / SCAN_BITS_PER_BYTE;
+	}
+#endif
+	
+	for (; position < length; position++) {
+		unsigned char charachter = text[position];
+		units += (charachter & 0xC0) != 0x80;
+		units += charachter >= 0xF0;
+	}
+	return units;
+}
+
+/**
+ The number of checkpoints buildUTF16Checkpoints writes for text of a given length
+ */
+size_t numberOfUTF16Checkpoints(size_t length) {
+	return length / UTF16_CHECKPOINT_INTERVAL + 1;
+}
+
+/**
+ Build a sparse index from byte offsets in some UTF-8 text to NSString (UTF-16) offsets
+ 
+ @param text The text
+ @param length The number of bytes in text
+ @param checkpoints (returned) checkpoints[k] is the number of UTF-16 units in the first k * UTF16_CHECKPOINT_INTERVAL bytes. Needs room for numberOfUTF16Checkpoints(length)
+ */
+void buildUTF16Checkpoints(const char text[], size_t length, uint32_t checkpoints[]) {
+	size_t numberOfCheckpoints = numberOfUTF16Checkpoints(length);
+	checkpoints[0] = 0;
+	for (size_t k = 1; k < numberOfCheckpoints; k++) {
+		checkpoints[k] = checkpoints[k - 1] + (uint32_t)countUTF16Units(&text[(k - 1) * UTF16_CHECKPOINT_INTERVAL], UTF16_CHECKPOINT_INTERVAL);
+	}
+}
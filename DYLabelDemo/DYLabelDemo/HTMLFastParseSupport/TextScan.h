@@ -0,0 +1,35 @@
+//
+//  TextScan.h
+//  HTMLFastParse
+//
+
+#ifndef TextScan_h
+#define TextScan_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+//How many bytes of text each UTF-16 checkpoint covers
+#define UTF16_CHECKPOINT_INTERVAL 64
+
+/**
+ Where a UTF-8 validation left off, so text can be validated a piece at a time (i.e. across chunks and plain text runs). Start from a zeroed validator
+ */
+struct t_utf8_validator {
+	//Continuation bytes the current charachter still needs
+	unsigned char pendingContinuations;
+	//The range the next continuation byte has to be in. Narrower than 0x80-0xBF right after some lead bytes, which rules out overlong forms, surrogates and anything past U+10FFFF
+	unsigned char nextMinimum;
+	unsigned char nextMaximum;
+	bool isInvalid;
+};
+
+size_t scanPlainText(const char text[], size_t length, int* visibleLength, struct t_utf8_validator *validator);
+void validateUTF8(struct t_utf8_validator *validator, const char text[], size_t length);
+bool finishUTF8Validation(struct t_utf8_validator *validator);
+size_t countUTF16Units(const char text[], size_t length);
+size_t numberOfUTF16Checkpoints(size_t length);
+void buildUTF16Checkpoints(const char text[], size_t length, uint32_t checkpoints[]);
+
+#endif /* TextScan_h */
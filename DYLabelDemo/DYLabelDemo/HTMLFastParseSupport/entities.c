@@ -5,283 +5,53 @@
 */
 
 #include "entities.h"
+#include "entities_table.h"
 
-#include <errno.h>
 #include <stdbool.h>
-#include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 
 #define UNICODE_MAX 0x10FFFFul
 
-static const char *const NAMED_ENTITIES[][2] = {
-	{ "AElig;", "Æ" },
-	{ "Aacute;", "Á" },
-	{ "Acirc;", "Â" },
-	{ "Agrave;", "À" },
-	{ "Alpha;", "Α" },
-	{ "Aring;", "Å" },
-	{ "Atilde;", "Ã" },
-	{ "Auml;", "Ä" },
-	{ "Beta;", "Β" },
-	{ "Ccedil;", "Ç" },
-	{ "Chi;", "Χ" },
-	{ "Dagger;", "‡" },
-	{ "Delta;", "Δ" },
-	{ "ETH;", "Ð" },
-	{ "Eacute;", "É" },
-	{ "Ecirc;", "Ê" },
-	{ "Egrave;", "È" },
-	{ "Epsilon;", "Ε" },
-	{ "Eta;", "Η" },
-	{ "Euml;", "Ë" },
-	{ "Gamma;", "Γ" },
-	{ "Iacute;", "Í" },
-	{ "Icirc;", "Î" },
-	{ "Igrave;", "Ì" },
-	{ "Iota;", "Ι" },
-	{ "Iuml;", "Ï" },
-	{ "Kappa;", "Κ" },
-	{ "Lambda;", "Λ" },
-	{ "Mu;", "Μ" },
-	{ "Ntilde;", "Ñ" },
-	{ "Nu;", "Ν" },
-	{ "OElig;", "Œ" },
-	{ "Oacute;", "Ó" },
-	{ "Ocirc;", "Ô" },
-	{ "Ograve;", "Ò" },
-	{ "Omega;", "Ω" },
-	{ "Omicron;", "Ο" },
-	{ "Oslash;", "Ø" },
-	{ "Otilde;", "Õ" },
-	{ "Ouml;", "Ö" },
-	{ "Phi;", "Φ" },
-	{ "Pi;", "Π" },
-	{ "Prime;", "″" },
-	{ "Psi;", "Ψ" },
-	{ "Rho;", "Ρ" },
-	{ "Scaron;", "Š" },
-	{ "Sigma;", "Σ" },
-	{ "THORN;", "Þ" },
-	{ "Tau;", "Τ" },
-	{ "Theta;", "Θ" },
-	{ "Uacute;", "Ú" },
-	{ "Ucirc;", "Û" },
-	{ "Ugrave;", "Ù" },
-	{ "Upsilon;", "Υ" },
-	{ "Uuml;", "Ü" },
-	{ "Xi;", "Ξ" },
-	{ "Yacute;", "Ý" },
-	{ "Yuml;", "Ÿ" },
-	{ "Zeta;", "Ζ" },
-	{ "aacute;", "á" },
-	{ "acirc;", "â" },
-	{ "acute;", "´" },
-	{ "aelig;", "æ" },
-	{ "agrave;", "à" },
-	{ "alefsym;", "ℵ" },
-	{ "alpha;", "α" },
-	{ "amp;", "&" },
-	{ "and;", "∧" },
-	{ "ang;", "∠" },
-	{ "apos;", "'" },
-	{ "aring;", "å" },
-	{ "asymp;", "≈" },
-	{ "atilde;", "ã" },
-	{ "auml;", "ä" },
-	{ "bdquo;", "„" },
-	{ "beta;", "β" },
-	{ "brvbar;", "¦" },
-	{ "bull;", "•" },
-	{ "cap;", "∩" },
-	{ "ccedil;", "ç" },
-	{ "cedil;", "¸" },
-	{ "cent;", "¢" },
-	{ "chi;", "χ" },
-	{ "circ;", "ˆ" },
-	{ "clubs;", "♣" },
-	{ "cong;", "≅" },
-	{ "copy;", "©" },
-	{ "crarr;", "↵" },
-	{ "cup;", "∪" },
-	{ "curren;", "¤" },
-	{ "dArr;", "⇓" },
-	{ "dagger;", "†" },
-	{ "darr;", "↓" },
-	{ "deg;", "°" },
-	{ "delta;", "δ" },
-	{ "diams;", "♦" },
-	{ "divide;", "÷" },
-	{ "eacute;", "é" },
-	{ "ecirc;", "ê" },
-	{ "egrave;", "è" },
-	{ "empty;", "∅" },
-	{ "emsp;", "\xE2\x80\x83" },
-	{ "ensp;", "\xE2\x80\x82" },
-	{ "epsilon;", "ε" },
-	{ "equiv;", "≡" },
-	{ "eta;", "η" },
-	{ "eth;", "ð" },
-	{ "euml;", "ë" },
-	{ "euro;", "€" },
-	{ "exist;", "∃" },
-	{ "fnof;", "ƒ" },
-	{ "forall;", "∀" },
-	{ "frac12;", "½" },
-	{ "frac14;", "¼" },
-	{ "frac34;", "¾" },
-	{ "frasl;", "⁄" },
-	{ "gamma;", "γ" },
-	{ "ge;", "≥" },
-	{ "gt;", ">" },
-	{ "hArr;", "⇔" },
-	{ "harr;", "↔" },
-	{ "hearts;", "♥" },
-	{ "hellip;", "…" },
-	{ "iacute;", "í" },
-	{ "icirc;", "î" },
-	{ "iexcl;", "¡" },
-	{ "igrave;", "ì" },
-	{ "image;", "ℑ" },
-	{ "infin;", "∞" },
-	{ "int;", "∫" },
-	{ "iota;", "ι" },
-	{ "iquest;", "¿" },
-	{ "isin;", "∈" },
-	{ "iuml;", "ï" },
-	{ "kappa;", "κ" },
-	{ "lArr;", "⇐" },
-	{ "lambda;", "λ" },
-	{ "lang;", "〈" },
-	{ "laquo;", "«" },
-	{ "larr;", "←" },
-	{ "lceil;", "⌈" },
-	{ "ldquo;", "“" },
-	{ "le;", "≤" },
-	{ "lfloor;", "⌊" },
-	{ "lowast;", "∗" },
-	{ "loz;", "◊" },
-	{ "lrm;", "\xE2\x80\x8E" },
-	{ "lsaquo;", "‹" },
-	{ "lsquo;", "‘" },
-	{ "lt;", "<" },
-	{ "macr;", "¯" },
-	{ "mdash;", "—" },
-	{ "micro;", "µ" },
-	{ "middot;", "·" },
-	{ "minus;", "−" },
-	{ "mu;", "μ" },
-	{ "nabla;", "∇" },
-	{ "nbsp;", "\xC2\xA0" },
-	{ "ndash;", "–" },
-	{ "ne;", "≠" },
-	{ "ni;", "∋" },
-	{ "not;", "¬" },
-	{ "notin;", "∉" },
-	{ "nsub;", "⊄" },
-	{ "ntilde;", "ñ" },
-	{ "nu;", "ν" },
-	{ "oacute;", "ó" },
-	{ "ocirc;", "ô" },
-	{ "oelig;", "œ" },
-	{ "ograve;", "ò" },
-	{ "oline;", "‾" },
-	{ "omega;", "ω" },
-	{ "omicron;", "ο" },
-	{ "oplus;", "⊕" },
-	{ "or;", "∨" },
-	{ "ordf;", "ª" },
-	{ "ordm;", "º" },
-	{ "oslash;", "ø" },
-	{ "otilde;", "õ" },
-	{ "otimes;", "⊗" },
-	{ "ouml;", "ö" },
-	{ "para;", "¶" },
-	{ "part;", "∂" },
-	{ "permil;", "‰" },
-	{ "perp;", "⊥" },
-	{ "phi;", "φ" },
-	{ "pi;", "π" },
-	{ "piv;", "ϖ" },
-	{ "plusmn;", "±" },
-	{ "pound;", "£" },
-	{ "prime;", "′" },
-	{ "prod;", "∏" },
-	{ "prop;", "∝" },
-	{ "psi;", "ψ" },
-	{ "quot;", "\"" },
-	{ "rArr;", "⇒" },
-	{ "radic;", "√" },
-	{ "rang;", "〉" },
-	{ "raquo;", "»" },
-	{ "rarr;", "→" },
-	{ "rceil;", "⌉" },
-	{ "rdquo;", "”" },
-	{ "real;", "ℜ" },
-	{ "reg;", "®" },
-	{ "rfloor;", "⌋" },
-	{ "rho;", "ρ" },
-	{ "rlm;", "\xE2\x80\x8F" },
-	{ "rsaquo;", "›" },
-	{ "rsquo;", "’" },
-	{ "sbquo;", "‚" },
-	{ "scaron;", "š" },
-	{ "sdot;", "⋅" },
-	{ "sect;", "§" },
-	{ "shy;", "\xC2\xAD" },
-	{ "sigma;", "σ" },
-	{ "sigmaf;", "ς" },
-	{ "sim;", "∼" },
-	{ "spades;", "♠" },
-	{ "sub;", "⊂" },
-	{ "sube;", "⊆" },
-	{ "sum;", "∑" },
-	{ "sup1;", "¹" },
-	{ "sup2;", "²" },
-	{ "sup3;", "³" },
-	{ "sup;", "⊃" },
-	{ "supe;", "⊇" },
-	{ "szlig;", "ß" },
-	{ "tau;", "τ" },
-	{ "there4;", "∴" },
-	{ "theta;", "θ" },
-	{ "thetasym;", "ϑ" },
-	{ "thinsp;", "\xE2\x80\x89" },
-	{ "thorn;", "þ" },
-	{ "tilde;", "˜" },
-	{ "times;", "×" },
-	{ "trade;", "™" },
-	{ "uArr;", "⇑" },
-	{ "uacute;", "ú" },
-	{ "uarr;", "↑" },
-	{ "ucirc;", "û" },
-	{ "ugrave;", "ù" },
-	{ "uml;", "¨" },
-	{ "upsih;", "ϒ" },
-	{ "upsilon;", "υ" },
-	{ "uuml;", "ü" },
-	{ "weierp;", "℘" },
-	{ "xi;", "ξ" },
-	{ "yacute;", "ý" },
-	{ "yen;", "¥" },
-	{ "yuml;", "ÿ" },
-	{ "zeta;", "ζ" },
-	{ "zwj;", "\xE2\x80\x8D" },
-	{ "zwnj;", "\xE2\x80\x8C" }
-};
-
-static int cmp(const void *key, const void *value)
+/*	Numeric references longer than this many digits are rejected rather than
+	risk overflowing.
+*/
+#define NUMERIC_MAX_DIGITS 8
+
+static bool is_entity_char(unsigned char c)
+{
+	return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+static uint32_t entity_hash(const char *name, size_t length, uint32_t seed)
 {
-	return strncmp((const char *)key, *(const char *const *)value,
-		strlen(*(const char *const *)value));
+	/* 32 bit FNV-1a, must match entity_hash in generate_entities.py */
+	uint32_t hash = 2166136261u ^ seed;
+	for(size_t i = 0; i < length; i++)
+	{
+		hash ^= (unsigned char)name[i];
+		hash *= 16777619u;
+	}
+	return hash;
 }
 
-static const char *get_named_entity(const char *name)
+static const struct t_entity_entry *get_named_entity(const char *name, size_t length)
 {
-	const char *const *entity = (const char *const *)bsearch(name,
-		NAMED_ENTITIES, sizeof NAMED_ENTITIES / sizeof *NAMED_ENTITIES,
-		sizeof *NAMED_ENTITIES, cmp);
+	if(length == 0 || length > ENTITY_NAME_MAX_LENGTH) return NULL;
+
+	/* Two level perfect hash: the first hash picks a bucket, the bucket's
+	   displacement seeds the second hash which picks the only slot the name
+	   can be in */
+	uint16_t displacement = ENTITY_DISPLACEMENTS[
+		entity_hash(name, length, 0) % ENTITY_BUCKET_COUNT];
+	const struct t_entity_entry *entity = &ENTITY_TABLE[
+		entity_hash(name, length, displacement) % ENTITY_TABLE_SIZE];
+
+	if(entity->nameLength != length ||
+		memcmp(&ENTITY_NAMES[entity->nameOffset], name, length) != 0)
+		return NULL;
 
-	return entity ? entity[1] : NULL;
+	return entity;
 }
 
 static size_t putc_utf8(unsigned long cp, char *buffer)
@@ -321,45 +91,65 @@ static size_t putc_utf8(unsigned long cp, char *buffer)
 	return 0;
 }
 
-static bool parse_entity(
-	const char *current, char **to, const char **from)
+static int digit_value(unsigned char c, bool hex)
 {
-	const char *end = strchr(current, ';');
-	if(!end) return 0;
+	if(c >= '0' && c <= '9') return c - '0';
+	if(hex && c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if(hex && c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
 
-	if(current[1] == '#')
-	{
-		char *tail = NULL;
-		int errno_save = errno;
-		bool hex = current[2] == 'x' || current[2] == 'X';
+long scan_html_entity(const char *src, size_t available)
+{
+	/* &[#]name; where name is alphanumeric */
+	size_t position = 1;
+	if(position < available && src[position] == '#') position++;
 
-		errno = 0;
-		unsigned long cp = strtoul(
-			current + (hex ? 3 : 2), &tail, hex ? 16 : 10);
+	size_t name_start = position;
+	for(; position < available; position++)
+	{
+		unsigned char c = (unsigned char)src[position];
+		if(c == ';')
+			return position > name_start ? (long)position + 1 : 0;
+		if(!is_entity_char(c) || position + 1 >= HTML_ENTITY_MAX_LENGTH)
+			return 0;
+	}
 
-        //                                                      do not allow nullbytes to be inserted via HTML entities 
-		bool fail = errno || tail != end || cp > UNICODE_MAX || cp == 0x0;
-		errno = errno_save;
-		if(fail) return 0;
+	return -1;
+}
 
-		*to += putc_utf8(cp, *to);
-		*from = end + 1;
+size_t decode_html_entity_utf8(char *dest, const char *src, size_t length)
+{
+	/* Strip the '&' and ';' */
+	const char *name = src + 1;
+	size_t name_length = length - 2;
 
-		return 1;
-	}
-	else
+	if(name[0] == '#')
 	{
-		const char *entity = get_named_entity(&current[1]);
-		if(!entity) return 0;
-
-		size_t len = strlen(entity);
-		memcpy(*to, entity, len);
+		bool hex = name_length > 1 && (name[1] == 'x' || name[1] == 'X');
+		size_t start = hex ? 2 : 1;
+		size_t digits = name_length - start;
+		if(digits == 0 || digits > NUMERIC_MAX_DIGITS) return 0;
+
+		unsigned long cp = 0;
+		for(size_t i = start; i < name_length; i++)
+		{
+			int digit = digit_value((unsigned char)name[i], hex);
+			if(digit < 0) return 0;
+			cp = cp * (hex ? 16 : 10) + (unsigned long)digit;
+		}
+
+		//                      do not allow nullbytes to be inserted via HTML entities
+		if(cp > UNICODE_MAX || cp == 0x0) return 0;
+
+		return putc_utf8(cp, dest);
+	}
 
-		*to += len;
-		*from = end + 1;
+	const struct t_entity_entry *entity = get_named_entity(name, name_length);
+	if(!entity) return 0;
 
-		return 1;
-	}
+	memcpy(dest, &ENTITY_VALUES[entity->valueOffset], entity->valueLength);
+	return entity->valueLength;
 }
 
 size_t decode_html_entities_utf8(char *dest, const char *src)
@@ -368,23 +158,33 @@ size_t decode_html_entities_utf8(char *dest, const char *src)
 
 	char *to = dest;
 	const char *from = src;
+	size_t remaining = strlen(src);
 
-	for(const char *current; (current = strchr(from, '&'));)
+	while(remaining > 0)
 	{
-		memmove(to, from, (size_t)(current - from));
-		to += current - from;
-
-		if(parse_entity(current, &to, &from))
-			continue;
+		if(*from == '&')
+		{
+			long length = scan_html_entity(from, remaining);
+			char decoded_bytes[HTML_ENTITY_MAX_DECODED_LENGTH];
+			size_t decoded = length > 0 ?
+				decode_html_entity_utf8(decoded_bytes, from, (size_t)length) : 0;
+			/* a handful of HTML5 entities decode to more bytes than their
+			   reference, those are left alone so we never outgrow <dest> or
+			   overtake <from> when decoding in-place */
+			if(decoded > 0 && decoded <= (size_t)length)
+			{
+				memcpy(to, decoded_bytes, decoded);
+				to += decoded;
+				from += length;
+				remaining -= (size_t)length;
+				continue;
+			}
+		}
 
-		from = current;
 		*to++ = *from++;
+		remaining--;
 	}
 
-	size_t remaining = strlen(from);
-
-	memmove(to, from, remaining);
-	to += remaining;
 	*to = 0;
 
 	return (size_t)(to - dest);
@@ -9,6 +9,34 @@
 
 #include <stddef.h>
 
+/*	The longest entity reference we will decode, including the '&' and ';'.
+	This is the longest HTML5 entity name plus two, numeric references are
+	always shorter.
+*/
+#define HTML_ENTITY_MAX_LENGTH 33
+
+/*	The most bytes a single entity reference can decode to.
+*/
+#define HTML_ENTITY_MAX_DECODED_LENGTH 8
+
+extern long scan_html_entity(const char *src, size_t available);
+/*	Takes <available> bytes of input from <src>, which must start with '&',
+	and finds the extent of the entity reference there.
+
+	The function returns the length of the reference (including the '&' and
+	';'), 0 if <src> does not start a well formed reference, or -1 if
+	<available> ran out before that could be decided.
+*/
+
+extern size_t decode_html_entity_utf8(char *dest, const char *src, size_t length);
+/*	Decodes the single entity reference of <length> bytes at <src> (as found
+	by scan_html_entity) into <dest>, which must have room for
+	HTML_ENTITY_MAX_DECODED_LENGTH bytes. Nothing is null terminated.
+
+	The function returns the number of bytes written, or 0 if the reference
+	is not a known entity.
+*/
+
 extern size_t decode_html_entities_utf8(char *dest, const char *src);
 /*	Takes input from <src> and decodes into <dest>, which should be a buffer
 	large enough to hold <strlen(src) + 1> characters.
@@ -0,0 +1,2690 @@
+//
+//  entities_table.h
+//  HTMLFastParse
+//
+//  GENERATED BY generate_entities.py, DO NOT EDIT
+//  2125 HTML5 named character references
+//
+
+#ifndef entities_table_h
+#define entities_table_h
+
+#include <stdint.h>
+
+//Longest entity name (without the '&' and ';')
+#define ENTITY_NAME_MAX_LENGTH 31
+#define ENTITY_TABLE_SIZE 2125
+#define ENTITY_BUCKET_COUNT 532
+
+struct t_entity_entry {
+	uint16_t nameOffset;
+	uint16_t valueOffset;
+	uint8_t nameLength;
+	uint8_t valueLength;
+};
+
+static const uint16_t ENTITY_DISPLACEMENTS[ENTITY_BUCKET_COUNT] = {
+	37, 8, 3, 444, 14, 423, 86, 8, 36, 32, 6, 16, 14, 53, 16, 214,
+	85, 150, 31, 19, 65, 16, 6, 1, 1, 112, 6, 126, 302, 11, 117, 6,
+	116, 33, 1, 181, 81, 214, 1, 89, 11, 12, 1, 26, 69, 150, 0, 42,
+	1, 142, 133, 17, 1, 12, 4, 124, 3, 9, 65, 1, 54, 22, 64, 106,
+	2, 97, 163, 27, 10, 12, 81, 1, 0, 89, 2, 68, 6, 12, 190, 255,
+	1, 37, 1, 1, 3, 16, 3, 33, 30, 1, 94, 3, 28, 6, 17, 193,
+	24, 0, 1, 6, 3, 4, 24, 86, 2, 380, 205, 1, 26, 4, 11, 1,
+	7, 12, 4, 55, 24, 15, 48, 11, 338, 7, 14, 8, 14, 35, 1, 0,
+	19, 223, 62, 9, 1, 392, 182, 148, 34, 16, 583, 1, 165, 3, 535, 20,
+	128, 160, 26, 200, 14, 49, 143, 1, 64, 208, 34, 3, 1, 239, 8, 322,
+	191, 120, 3, 111, 163, 150, 22, 1, 36, 369, 5, 2, 21, 22, 38, 44,
+	11, 1, 12, 8, 15, 424, 7, 142, 60, 2, 8, 136, 1, 306, 1, 44,
+	49, 161, 35, 1, 1, 439, 111, 73, 275, 9, 114, 6, 4, 21, 9, 38,
+	67, 218, 9, 878, 141, 9, 1, 177, 142, 60, 109, 905, 32, 19, 3, 11,
+	119, 1, 1018, 148, 520, 97, 8, 2, 55, 10, 37, 1, 18, 89, 4, 36,
+	71, 20, 52, 481, 2, 3, 128, 6, 52, 21, 2, 252, 34, 232, 91, 90,
+	21, 213, 2, 1, 142, 66, 4, 64, 41, 470, 23, 45, 2, 78, 185, 153,
+	122, 2, 329, 20, 179, 12, 1, 125, 60, 1, 1, 8, 83, 20, 208, 9,
+	28, 143, 409, 58, 3, 273, 72, 46, 2, 1, 144, 180, 164, 113, 135, 3,
+	1360, 0, 105, 242, 7, 366, 14, 5, 88, 189, 372, 1, 652, 9, 67, 107,
+	150, 2, 43, 518, 52, 512, 91, 213, 491, 83, 174, 803, 559, 14, 7, 754,
+	144, 14, 388, 5, 300, 374, 319, 203, 479, 50, 185, 497, 213, 4, 7, 1603,
+	268, 678, 64, 67, 267, 32, 110, 579, 398, 35, 91, 20, 12, 4, 228, 116,
+	565, 38, 4, 437, 157, 0, 214, 769, 610, 202, 48, 61, 110, 188, 15, 338,
+	14, 535, 252, 1, 9, 876, 59, 207, 1, 33, 1951, 9, 268, 6, 1, 133,
+	1080, 576, 730, 3, 179, 6, 498, 66, 345, 1220, 8, 190, 2, 236, 2, 10,
+	208, 47, 10, 134, 87, 1, 3, 21, 171, 173, 15, 99, 2, 8, 235, 20,
+	4, 73, 754, 6, 185, 66, 767, 164, 425, 39, 1, 1886, 1981, 519, 441, 242,
+	56, 9, 1, 224, 11, 1191, 1036, 1, 701, 31, 1288, 7, 2548, 902, 95, 609,
+	129, 556, 837, 87, 2404, 3, 3, 579, 26, 164, 1, 113, 2825, 5, 73, 76,
+	479, 430, 109, 24, 53, 7, 1, 130, 25, 17, 3, 25, 6279, 0, 37, 76,
+	1166, 200, 942, 956, 426, 20, 38, 2333, 669, 1399, 9, 278, 19, 15, 278, 5,
+	18, 52, 126, 564, 421, 3, 186, 101, 1, 23, 0, 46, 3490, 9, 665, 4,
+	51, 119, 14, 354,
+};
+
+static const struct t_entity_entry ENTITY_TABLE[ENTITY_TABLE_SIZE] = {
+	{ 0, 0, 14, 3 }, /* downdownarrows */
+	{ 14, 3, 4, 3 }, /* gscr */
+	{ 18, 6, 8, 3 }, /* bigsqcup */
+	{ 26, 9, 5, 3 }, /* duarr */
+	{ 31, 12, 2, 3 }, /* oS */
+	{ 33, 15, 3, 3 }, /* olt */
+	{ 36, 18, 5, 2 }, /* laquo */
+	{ 41, 20, 6, 2 }, /* gammad */
+	{ 47, 22, 6, 2 }, /* Zacute */
+	{ 53, 24, 6, 2 }, /* SOFTcy */
+	{ 59, 26, 13, 3 }, /* LessFullEqual */
+	{ 72, 29, 3, 2 }, /* acy */
+	{ 75, 31, 6, 3 }, /* ForAll */
+	{ 81, 34, 3, 4 }, /* ifr */
+	{ 84, 38, 3, 3 }, /* apE */
+	{ 87, 41, 6, 3 }, /* iinfin */
+	{ 93, 44, 5, 2 }, /* aelig */
+	{ 98, 46, 2, 3 }, /* mp */
+	{ 100, 49, 4, 1 }, /* quot */
+	{ 104, 50, 6, 2 }, /* Eacute */
+	{ 110, 52, 5, 3 }, /* notin */
+	{ 115, 55, 7, 3 }, /* Implies */
+	{ 122, 58, 3, 3 }, /* sub */
+	{ 125, 61, 3, 2 }, /* Psi */
+	{ 128, 63, 3, 4 }, /* tfr */
+	{ 131, 67, 6, 3 }, /* propto */
+	{ 137, 70, 4, 2 }, /* DScy */
+	{ 141, 72, 14, 3 }, /* ZeroWidthSpace */
+	{ 155, 75, 15, 3 }, /* trianglerighteq */
+	{ 170, 78, 6, 3 }, /* searhk */
+	{ 176, 81, 6, 3 }, /* smashp */
+	{ 182, 84, 12, 3 }, /* UnderBracket */
+	{ 194, 87, 9, 3 }, /* CircleDot */
+	{ 203, 90, 7, 3 }, /* Element */
+	{ 210, 93, 3, 2 }, /* Kcy */
+	{ 213, 95, 10, 2 }, /* varepsilon */
+	{ 223, 97, 6, 3 }, /* timesd */
+	{ 229, 100, 12, 3 }, /* LeftTeeArrow */
+	{ 241, 103, 8, 3 }, /* bigoplus */
+	{ 249, 106, 13, 3 }, /* Longleftarrow */
+	{ 262, 109, 3, 4 }, /* mfr */
+	{ 265, 113, 17, 3 }, /* FilledSmallSquare */
+	{ 282, 116, 4, 3 }, /* subE */
+	{ 286, 119, 5, 2 }, /* szlig */
+	{ 291, 121, 4, 3 }, /* Rscr */
+	{ 295, 124, 4, 3 }, /* beth */
+	{ 299, 127, 6, 2 }, /* hstrok */
+	{ 305, 129, 6, 3 }, /* gtlPar */
+	{ 311, 132, 13, 3 }, /* measuredangle */
+	{ 324, 135, 5, 3 }, /* cuesc */
+	{ 329, 138, 5, 3 }, /* mDDot */
+	{ 334, 141, 3, 3 }, /* sup */
+	{ 337, 144, 14, 3 }, /* GreaterGreater */
+	{ 351, 147, 4, 3 }, /* rtri */
+	{ 355, 150, 5, 3 }, /* sdote */
+	{ 360, 153, 4, 3 }, /* oast */
+	{ 364, 156, 3, 3 }, /* glE */
+	{ 367, 159, 5, 2 }, /* IJlig */
+	{ 372, 161, 4, 3 }, /* oint */
+	{ 376, 164, 5, 3 }, /* boxvL */
+	{ 381, 167, 5, 2 }, /* icirc */
+	{ 386, 169, 6, 3 }, /* rpargt */
+	{ 392, 172, 6, 3 }, /* lfloor */
+	{ 398, 175, 4, 3 }, /* Hscr */
+	{ 402, 178, 3, 3 }, /* acd */
+	{ 405, 181, 17, 3 }, /* blacktriangleleft */
+	{ 422, 184, 3, 2 }, /* Fcy */
+	{ 425, 186, 8, 3 }, /* PartialD */
+	{ 433, 189, 6, 2 }, /* Lcaron */
+	{ 439, 191, 5, 3 }, /* fflig */
+	{ 444, 194, 19, 5 }, /* NotGreaterFullEqual */
+	{ 463, 199, 5, 2 }, /* Amacr */
+	{ 468, 201, 3, 4 }, /* sfr */
+	{ 471, 205, 4, 2 }, /* iuml */
+	{ 475, 207, 7, 3 }, /* plustwo */
+	{ 482, 210, 4, 3 }, /* apid */
+	{ 486, 213, 6, 3 }, /* ffllig */
+	{ 492, 216, 6, 3 }, /* homtht */
+	{ 498, 67, 5, 3 }, /* vprop */
+	{ 503, 219, 4, 6 }, /* gvnE */
+	{ 507, 225, 9, 5 }, /* ngeqslant */
+	{ 516, 230, 3, 4 }, /* afr */
+	{ 519, 234, 6, 3 }, /* cylcty */
+	{ 525, 237, 5, 3 }, /* boxUR */
+	{ 530, 240, 6, 3 }, /* thksim */
+	{ 536, 243, 16, 3 }, /* circlearrowright */
+	{ 552, 246, 7, 3 }, /* nsqsube */
+	{ 559, 249, 5, 3 }, /* sharp */
+	{ 564, 252, 14, 3 }, /* doublebarwedge */
+	{ 578, 255, 18, 3 }, /* LongLeftRightArrow */
+	{ 596, 258, 4, 3 }, /* ecir */
+	{ 600, 261, 4, 4 }, /* vscr */
+	{ 604, 265, 6, 2 }, /* tcaron */
+	{ 610, 267, 5, 3 }, /* subnE */
+	{ 615, 270, 4, 3 }, /* cong */
+	{ 619, 273, 9, 3 }, /* NotCupCap */
+	{ 628, 276, 5, 3 }, /* bumpe */
+	{ 633, 279, 4, 6 }, /* nvge */
+	{ 637, 285, 4, 3 }, /* nsub */
+	{ 641, 288, 3, 2 }, /* shy */
+	{ 644, 290, 14, 2 }, /* DiacriticalDot */
+	{ 658, 292, 14, 3 }, /* LowerLeftArrow */
+	{ 672, 295, 8, 3 }, /* succneqq */
+	{ 680, 298, 6, 2 }, /* itilde */
+	{ 686, 300, 5, 5 }, /* nleqq */
+	{ 691, 305, 5, 3 }, /* boxhd */
+	{ 696, 308, 6, 3 }, /* easter */
+	{ 702, 311, 2, 3 }, /* lg */
+	{ 704, 314, 6, 1 }, /* rbrace */
+	{ 710, 315, 4, 2 }, /* sup2 */
+	{ 714, 317, 4, 2 }, /* DZcy */
+	{ 718, 319, 18, 3 }, /* RightDownTeeVector */
+	{ 736, 322, 6, 3 }, /* nVdash */
+	{ 742, 325, 8, 3 }, /* bbrktbrk */
+	{ 750, 328, 8, 3 }, /* profsurf */
+	{ 758, 331, 4, 3 }, /* uarr */
+	{ 762, 334, 10, 3 }, /* CirclePlus */
+	{ 772, 337, 16, 1 }, /* DiacriticalGrave */
+	{ 788, 338, 6, 3 }, /* lparlt */
+	{ 794, 341, 5, 5 }, /* nsubE */
+	{ 799, 346, 15, 3 }, /* nleftrightarrow */
+	{ 814, 349, 6, 2 }, /* iquest */
+	{ 820, 351, 5, 2 }, /* times */
+	{ 825, 353, 4, 3 }, /* scap */
+	{ 829, 356, 5, 3 }, /* ldquo */
+	{ 834, 359, 3, 4 }, /* ofr */
+	{ 837, 363, 3, 4 }, /* Yfr */
+	{ 840, 367, 5, 3 }, /* lsquo */
+	{ 845, 370, 18, 3 }, /* DownRightTeeVector */
+	{ 863, 373, 6, 3 }, /* hearts */
+	{ 869, 376, 4, 2 }, /* cdot */
+	{ 873, 378, 11, 3 }, /* SubsetEqual */
+	{ 884, 381, 6, 3 }, /* puncsp */
+	{ 890, 384, 4, 2 }, /* ordm */
+	{ 894, 386, 6, 3 }, /* bottom */
+	{ 900, 389, 4, 3 }, /* Lscr */
+	{ 904, 392, 9, 3 }, /* OverBrace */
+	{ 913, 395, 10, 3 }, /* Bernoullis */
+	{ 923, 398, 8, 2 }, /* varsigma */
+	{ 931, 400, 7, 3 }, /* succsim */
+	{ 938, 67, 12, 3 }, /* Proportional */
+	{ 950, 403, 5, 3 }, /* parsl */
+	{ 955, 406, 5, 2 }, /* kappa */
+	{ 960, 408, 6, 3 }, /* rtimes */
+	{ 966, 411, 4, 3 }, /* Darr */
+	{ 970, 414, 5, 3 }, /* blk12 */
+	{ 975, 417, 4, 2 }, /* Upsi */
+	{ 979, 419, 2, 3 }, /* pr */
+	{ 981, 422, 6, 3 }, /* gesdot */
+	{ 987, 425, 14, 3 }, /* InvisibleTimes */
+	{ 1001, 428, 7, 3 }, /* Cayleys */
+	{ 1008, 431, 5, 2 }, /* wcirc */
+	{ 1013, 433, 5, 3 }, /* lrarr */
+	{ 1018, 436, 4, 3 }, /* lang */
+	{ 1022, 439, 21, 3 }, /* NotRightTriangleEqual */
+	{ 1043, 442, 7, 3 }, /* lozenge */
+	{ 1050, 181, 5, 3 }, /* ltrif */
+	{ 1055, 445, 7, 3 }, /* harrcir */
+	{ 1062, 448, 4, 3 }, /* imof */
+	{ 1066, 451, 6, 3 }, /* ldquor */
+	{ 1072, 454, 6, 3 }, /* ecolon */
+	{ 1078, 457, 6, 3 }, /* supdot */
+	{ 1084, 90, 5, 3 }, /* isinv */
+	{ 1089, 460, 4, 4 }, /* Kopf */
+	{ 1093, 464, 12, 3 }, /* GreaterTilde */
+	{ 1105, 467, 4, 4 }, /* dopf */
+	{ 1109, 471, 4, 3 }, /* ldca */
+	{ 1113, 474, 5, 3 }, /* eDDot */
+	{ 1118, 477, 11, 3 }, /* MediumSpace */
+	{ 1129, 480, 4, 2 }, /* phiv */
+	{ 1133, 482, 8, 3 }, /* urcorner */
+	{ 1141, 485, 6, 3 }, /* copysr */
+	{ 1147, 488, 6, 2 }, /* Lacute */
+	{ 1153, 490, 5, 3 }, /* boxUl */
+	{ 1158, 493, 3, 3 }, /* Rfr */
+	{ 1161, 46, 9, 3 }, /* MinusPlus */
+	{ 1170, 496, 6, 3 }, /* bkarow */
+	{ 1176, 499, 8, 3 }, /* smeparsl */
+	{ 1184, 502, 6, 2 }, /* Oacute */
+	{ 1190, 504, 6, 3 }, /* cupcap */
+	{ 1196, 507, 5, 3 }, /* boxhU */
+	{ 1201, 510, 5, 3 }, /* rAarr */
+	{ 1206, 513, 5, 3 }, /* boxVr */
+	{ 1211, 516, 10, 3 }, /* TildeTilde */
+	{ 1221, 519, 7, 3 }, /* Uparrow */
+	{ 1228, 522, 6, 3 }, /* tridot */
+	{ 1234, 525, 15, 3 }, /* vartriangleleft */
+	{ 1249, 528, 6, 2 }, /* HARDcy */
+	{ 1255, 530, 3, 3 }, /* scE */
+	{ 1258, 533, 6, 3 }, /* rarrfs */
+	{ 1264, 132, 6, 3 }, /* angmsd */
+	{ 1270, 536, 5, 3 }, /* check */
+	{ 1275, 539, 4, 4 }, /* Oopf */
+	{ 1279, 543, 6, 2 }, /* Uacute */
+	{ 1285, 545, 5, 3 }, /* xcirc */
+	{ 1290, 548, 2, 1 }, /* gt */
+	{ 1292, 549, 5, 3 }, /* nlarr */
+	{ 1297, 552, 6, 3 }, /* hellip */
+	{ 1303, 555, 5, 3 }, /* odash */
+	{ 1308, 558, 5, 3 }, /* duhar */
+	{ 1313, 561, 4, 3 }, /* squf */
+	{ 1317, 564, 6, 3 }, /* capcup */
+	{ 1323, 567, 7, 3 }, /* rbrkslu */
+	{ 1330, 570, 14, 3 }, /* trianglelefteq */
+	{ 1344, 573, 11, 3 }, /* CircleMinus */
+	{ 1355, 576, 9, 3 }, /* Therefore */
+	{ 1364, 579, 5, 2 }, /* Ocirc */
+	{ 1369, 581, 6, 2 }, /* otilde */
+	{ 1375, 583, 5, 2 }, /* fjlig */
+	{ 1380, 585, 15, 3 }, /* NotGreaterEqual */
+	{ 1395, 588, 7, 3 }, /* uwangle */
+	{ 1402, 591, 7, 3 }, /* tritime */
+	{ 1409, 276, 9, 3 }, /* HumpEqual */
+	{ 1418, 594, 6, 3 }, /* drcrop */
+	{ 1424, 49, 4, 1 }, /* QUOT */
+	{ 1428, 597, 5, 3 }, /* boxDL */
+	{ 1433, 600, 15, 3 }, /* RightDownVector */
+	{ 1448, 603, 6, 6 }, /* vsupne */
+	{ 1454, 609, 13, 3 }, /* Poincareplane */
+	{ 1467, 612, 6, 3 }, /* mcomma */
+	{ 1473, 615, 2, 3 }, /* wr */
+	{ 1475, 618, 6, 2 }, /* Egrave */
+	{ 1481, 620, 6, 3 }, /* xotime */
+	{ 1487, 623, 12, 3 }, /* RightCeiling */
+	{ 1499, 626, 4, 3 }, /* nmid */
+	{ 1503, 629, 5, 3 }, /* ltdot */
+	{ 1508, 632, 3, 2 }, /* Acy */
+	{ 1511, 634, 6, 3 }, /* rarrap */
+	{ 1517, 637, 7, 3 }, /* zigrarr */
+	{ 1524, 640, 4, 3 }, /* ltri */
+	{ 1528, 643, 7, 3 }, /* backsim */
+	{ 1535, 646, 4, 5 }, /* nles */
+	{ 1539, 651, 3, 4 }, /* zfr */
+	{ 1542, 655, 5, 2 }, /* Iukcy */
+	{ 1547, 657, 5, 3 }, /* lbbrk */
+	{ 1552, 660, 7, 3 }, /* notinvb */
+	{ 1559, 663, 3, 3 }, /* int */
+	{ 1562, 666, 5, 3 }, /* simgE */
+	{ 1567, 669, 5, 3 }, /* rlarr */
+	{ 1572, 672, 15, 3 }, /* LeftRightVector */
+	{ 1587, 675, 6, 3 }, /* otimes */
+	{ 1593, 678, 6, 3 }, /* boxbox */
+	{ 1599, 681, 4, 2 }, /* Zeta */
+	{ 1603, 683, 6, 2 }, /* ncedil */
+	{ 1609, 685, 6, 2 }, /* lcaron */
+	{ 1615, 687, 6, 3 }, /* nearhk */
+	{ 1621, 690, 5, 3 }, /* ctdot */
+	{ 1626, 693, 6, 6 }, /* vsupnE */
+	{ 1632, 292, 5, 3 }, /* swarr */
+	{ 1637, 699, 18, 3 }, /* SquareIntersection */
+	{ 1655, 702, 7, 3 }, /* angrtvb */
+	{ 1662, 705, 6, 3 }, /* xwedge */
+	{ 1668, 708, 5, 3 }, /* rtrif */
+	{ 1673, 711, 5, 3 }, /* utrif */
+	{ 1678, 714, 3, 4 }, /* Sfr */
+	{ 1681, 718, 3, 2 }, /* not */
+	{ 1684, 720, 6, 2 }, /* Ubreve */
+	{ 1690, 722, 4, 6 }, /* nvap */
+	{ 1694, 585, 4, 3 }, /* ngeq */
+	{ 1698, 728, 20, 3 }, /* NestedGreaterGreater */
+	{ 1718, 731, 20, 3 }, /* DoubleLongRightArrow */
+	{ 1738, 734, 3, 6 }, /* nGt */
+	{ 1741, 585, 3, 3 }, /* nge */
+	{ 1744, 740, 5, 3 }, /* fllig */
+	{ 1749, 743, 6, 3 }, /* divonx */
+	{ 1755, 746, 4, 2 }, /* GJcy */
+	{ 1759, 748, 8, 3 }, /* lrcorner */
+	{ 1767, 751, 5, 3 }, /* rsquo */
+	{ 1772, 341, 10, 5 }, /* nsubseteqq */
+	{ 1782, 754, 6, 6 }, /* sqcaps */
+	{ 1788, 760, 13, 3 }, /* shortparallel */
+	{ 1801, 763, 14, 3 }, /* ShortLeftArrow */
+	{ 1815, 766, 6, 2 }, /* scaron */
+	{ 1821, 768, 2, 3 }, /* Sc */
+	{ 1823, 771, 5, 3 }, /* boxVH */
+	{ 1828, 774, 4, 4 }, /* uscr */
+	{ 1832, 778, 6, 2 }, /* ccaron */
+	{ 1838, 780, 9, 3 }, /* NotExists */
+	{ 1847, 783, 3, 4 }, /* vfr */
+	{ 1850, 615, 6, 3 }, /* wreath */
+	{ 1856, 787, 6, 1 }, /* commat */
+	{ 1862, 788, 2, 3 }, /* ii */
+	{ 1864, 791, 12, 3 }, /* LeftArrowBar */
+	{ 1876, 794, 3, 2 }, /* phi */
+	{ 1879, 796, 4, 4 }, /* Lopf */
+	{ 1883, 800, 3, 4 }, /* Efr */
+	{ 1886, 804, 5, 3 }, /* twixt */
+	{ 1891, 807, 8, 3 }, /* angmsdab */
+	{ 1899, 810, 10, 3 }, /* mapstodown */
+	{ 1909, 813, 6, 6 }, /* vsubne */
+	{ 1915, 819, 3, 2 }, /* Ncy */
+	{ 1918, 821, 15, 3 }, /* OverParenthesis */
+	{ 1933, 824, 4, 3 }, /* Ropf */
+	{ 1937, 827, 5, 2 }, /* jukcy */
+	{ 1942, 829, 6, 2 }, /* ntilde */
+	{ 1948, 831, 5, 2 }, /* delta */
+	{ 1953, 833, 4, 2 }, /* YUcy */
+	{ 1957, 835, 3, 2 }, /* Dot */
+	{ 1960, 837, 5, 2 }, /* THORN */
+	{ 1965, 839, 8, 3 }, /* cwconint */
+	{ 1973, 842, 7, 2 }, /* omicron */
+	{ 1980, 844, 3, 2 }, /* reg */
+	{ 1983, 846, 3, 2 }, /* Dcy */
+	{ 1986, 848, 5, 3 }, /* nsucc */
+	{ 1991, 851, 3, 4 }, /* Bfr */
+	{ 1994, 855, 6, 1 }, /* verbar */
+	{ 2000, 856, 4, 3 }, /* Escr */
+	{ 2004, 859, 4, 4 }, /* hscr */
+	{ 2008, 863, 6, 3 }, /* Rarrtl */
+	{ 2014, 866, 5, 2 }, /* ycirc */
+	{ 2019, 868, 10, 5 }, /* nsupseteqq */
+	{ 2029, 873, 4, 4 }, /* Uopf */
+	{ 2033, 877, 6, 3 }, /* swarhk */
+	{ 2039, 880, 17, 3 }, /* leftrightharpoons */
+	{ 2056, 883, 4, 2 }, /* YAcy */
+	{ 2060, 885, 6, 2 }, /* Sacute */
+	{ 2066, 887, 5, 3 }, /* lneqq */
+	{ 2071, 890, 11, 3 }, /* circledcirc */
+	{ 2082, 893, 11, 3 }, /* UpDownArrow */
+	{ 2093, 896, 6, 2 }, /* cacute */
+	{ 2099, 433, 15, 3 }, /* leftrightarrows */
+	{ 2114, 898, 3, 3 }, /* top */
+	{ 2117, 901, 6, 3 }, /* larrtl */
+	{ 2123, 904, 5, 3 }, /* isinE */
+	{ 2128, 907, 5, 3 }, /* iiint */
+	{ 2133, 910, 3, 3 }, /* sce */
+	{ 2136, 913, 3, 4 }, /* yfr */
+	{ 2139, 917, 6, 2 }, /* varrho */
+	{ 2145, 919, 15, 3 }, /* nLeftrightarrow */
+	{ 2160, 922, 8, 3 }, /* supseteq */
+	{ 2168, 925, 3, 3 }, /* Sum */
+	{ 2171, 928, 21, 3 }, /* CloseCurlyDoubleQuote */
+	{ 2192, 931, 3, 2 }, /* zcy */
+	{ 2195, 933, 8, 3 }, /* angmsdad */
+	{ 2203, 510, 11, 3 }, /* Rrightarrow */
+	{ 2214, 936, 4, 4 }, /* Jscr */
+	{ 2218, 940, 9, 3 }, /* complexes */
+	{ 2227, 943, 6, 3 }, /* nltrie */
+	{ 2233, 946, 5, 2 }, /* hcirc */
+	{ 2238, 948, 3, 3 }, /* map */
+	{ 2241, 948, 6, 3 }, /* mapsto */
+	{ 2247, 951, 6, 2 }, /* Ntilde */
+	{ 2253, 953, 15, 3 }, /* downharpoonleft */
+	{ 2268, 956, 5, 2 }, /* gcirc */
+	{ 2273, 958, 5, 2 }, /* Alpha */
+	{ 2278, 72, 17, 3 }, /* NegativeThinSpace */
+	{ 2295, 960, 3, 4 }, /* Ofr */
+	{ 2298, 964, 6, 2 }, /* Lambda */
+	{ 2304, 966, 6, 3 }, /* Conint */
+	{ 2310, 969, 5, 2 }, /* Gamma */
+	{ 2315, 971, 3, 3 }, /* nle */
+	{ 2318, 974, 16, 3 }, /* RightUpVectorBar */
+	{ 2334, 977, 3, 4 }, /* kfr */
+	{ 2337, 981, 4, 2 }, /* iocy */
+	{ 2341, 983, 7, 3 }, /* rarrbfs */
+	{ 2348, 986, 4, 3 }, /* solb */
+	{ 2352, 728, 2, 3 }, /* Gt */
+	{ 2354, 989, 5, 3 }, /* urtri */
+	{ 2359, 992, 14, 3 }, /* rightarrowtail */
+	{ 2373, 995, 14, 3 }, /* nshortparallel */
+	{ 2387, 998, 2, 3 }, /* Gg */
+	{ 2389, 1001, 6, 3 }, /* hairsp */
+	{ 2395, 1004, 4, 2 }, /* para */
+	{ 2399, 519, 4, 3 }, /* uArr */
+	{ 2403, 1006, 3, 2 }, /* Tau */
+	{ 2406, 943, 15, 3 }, /* ntrianglelefteq */
+	{ 2421, 558, 20, 3 }, /* ReverseUpEquilibrium */
+	{ 2441, 763, 9, 3 }, /* leftarrow */
+	{ 2450, 1008, 13, 3 }, /* looparrowleft */
+	{ 2463, 1011, 3, 2 }, /* Phi */
+	{ 2466, 1013, 3, 3 }, /* leq */
+	{ 2469, 1016, 5, 2 }, /* Omacr */
+	{ 2474, 1018, 4, 4 }, /* Mopf */
+	{ 2478, 844, 8, 2 }, /* circledR */
+	{ 2486, 1022, 4, 3 }, /* bump */
+	{ 2490, 1025, 6, 3 }, /* cupdot */
+	{ 2496, 1028, 6, 2 }, /* Agrave */
+	{ 2502, 1030, 18, 5 }, /* NotLeftTriangleBar */
+	{ 2520, 1035, 8, 3 }, /* mapstoup */
+	{ 2528, 1038, 6, 3 }, /* daleth */
+	{ 2534, 1041, 13, 5 }, /* NotEqualTilde */
+	{ 2547, 1046, 6, 3 }, /* lesges */
+	{ 2553, 1049, 5, 3 }, /* uplus */
+	{ 2558, 1052, 2, 1 }, /* LT */
+	{ 2560, 1053, 6, 3 }, /* dagger */
+	{ 2566, 728, 2, 3 }, /* gg */
+	{ 2568, 1056, 5, 3 }, /* boxUL */
+	{ 2573, 1059, 5, 3 }, /* isins */
+	{ 2578, 100, 10, 3 }, /* mapstoleft */
+	{ 2588, 1062, 6, 3 }, /* frac25 */
+	{ 2594, 395, 4, 3 }, /* Bscr */
+	{ 2598, 1065, 13, 3 }, /* LeftTeeVector */
+	{ 2611, 1068, 6, 2 }, /* aacute */
+	{ 2617, 1070, 5, 3 }, /* smile */
+	{ 2622, 1073, 6, 3 }, /* models */
+	{ 2628, 1076, 5, 2 }, /* jcirc */
+	{ 2633, 640, 12, 3 }, /* triangleleft */
+	{ 2645, 1078, 6, 3 }, /* ratail */
+	{ 2651, 1081, 7, 3 }, /* ldrdhar */
+	{ 2658, 1084, 5, 3 }, /* infin */
+	{ 2663, 1087, 7, 3 }, /* precsim */
+	{ 2670, 1090, 13, 3 }, /* DoubleLeftTee */
+	{ 2683, 1093, 22, 3 }, /* NotSquareSupersetEqual */
+	{ 2705, 1096, 14, 3 }, /* leftleftarrows */
+	{ 2719, 646, 9, 5 }, /* nleqslant */
+	{ 2728, 548, 2, 1 }, /* GT */
+	{ 2730, 1099, 6, 3 }, /* solbar */
+	{ 2736, 1102, 4, 2 }, /* fnof */
+	{ 2740, 1104, 10, 3 }, /* Lleftarrow */
+	{ 2750, 1107, 6, 1 }, /* lbrace */
+	{ 2756, 1108, 13, 3 }, /* hookleftarrow */
+	{ 2769, 1111, 4, 2 }, /* kjcy */
+	{ 2773, 75, 5, 3 }, /* rtrie */
+	{ 2778, 629, 7, 3 }, /* lessdot */
+	{ 2785, 1113, 4, 3 }, /* ncup */
+	{ 2789, 1116, 5, 2 }, /* imped */
+	{ 2794, 1118, 11, 3 }, /* GreaterLess */
+	{ 2805, 1121, 3, 3 }, /* gnE */
+	{ 2808, 600, 5, 3 }, /* dharr */
+	{ 2813, 910, 13, 3 }, /* SucceedsEqual */
+	{ 2826, 1124, 5, 3 }, /* lobrk */
+	{ 2831, 1127, 8, 3 }, /* timesbar */
+	{ 2839, 1130, 5, 6 }, /* smtes */
+	{ 2844, 1136, 9, 3 }, /* downarrow */
+	{ 2853, 1139, 6, 3 }, /* capcap */
+	{ 2859, 1142, 3, 3 }, /* zwj */
+	{ 2862, 1145, 6, 2 }, /* Tcaron */
+	{ 2868, 1147, 18, 3 }, /* SucceedsSlantEqual */
+	{ 2886, 609, 3, 3 }, /* Hfr */
+	{ 2889, 1150, 3, 2 }, /* kcy */
+	{ 2892, 1152, 6, 3 }, /* xuplus */
+	{ 2898, 1155, 3, 2 }, /* fcy */
+	{ 2901, 1157, 5, 3 }, /* xhArr */
+	{ 2906, 1160, 4, 3 }, /* Nopf */
+	{ 2910, 1163, 6, 3 }, /* curarr */
+	{ 2916, 1166, 12, 5 }, /* NotHumpEqual */
+	{ 2928, 1171, 5, 3 }, /* gsiml */
+	{ 2933, 1174, 4, 3 }, /* nldr */
+	{ 2937, 1177, 6, 3 }, /* ffilig */
+	{ 2943, 1180, 4, 4 }, /* oopf */
+	{ 2947, 1184, 3, 2 }, /* scy */
+	{ 2950, 1186, 4, 4 }, /* kscr */
+	{ 2954, 1190, 4, 3 }, /* nsup */
+	{ 2958, 898, 7, 3 }, /* DownTee */
+	{ 2965, 1193, 4, 3 }, /* fork */
+	{ 2969, 1196, 6, 3 }, /* Assign */
+	{ 2975, 1199, 14, 3 }, /* leftrightarrow */
+	{ 2989, 1202, 8, 3 }, /* NotEqual */
+	{ 2997, 1205, 8, 3 }, /* sqsubset */
+	{ 3005, 1208, 4, 3 }, /* male */
+	{ 3009, 246, 20, 3 }, /* NotSquareSubsetEqual */
+	{ 3029, 1211, 6, 3 }, /* nequiv */
+	{ 3035, 1214, 6, 2 }, /* lmidot */
+	{ 3041, 1022, 6, 3 }, /* Bumpeq */
+	{ 3047, 1216, 4, 2 }, /* SHcy */
+	{ 3051, 1218, 5, 3 }, /* xrarr */
+	{ 3056, 1221, 4, 2 }, /* khcy */
+	{ 3060, 1223, 6, 3 }, /* gtrdot */
+	{ 3066, 1226, 4, 2 }, /* iecy */
+	{ 3070, 1228, 5, 3 }, /* bsemi */
+	{ 3075, 1231, 5, 3 }, /* nearr */
+	{ 3080, 1234, 6, 3 }, /* dlcorn */
+	{ 3086, 1237, 3, 3 }, /* lat */
+	{ 3089, 1240, 4, 3 }, /* xnis */
+	{ 3093, 1243, 11, 3 }, /* curlyeqprec */
+	{ 3104, 1246, 3, 3 }, /* ngt */
+	{ 3107, 1249, 5, 3 }, /* boxDR */
+	{ 3112, 748, 6, 3 }, /* drcorn */
+	{ 3118, 1252, 6, 2 }, /* kgreen */
+	{ 3124, 1254, 12, 3 }, /* GreaterEqual */
+	{ 3136, 1257, 6, 2 }, /* Lmidot */
+	{ 3142, 1259, 6, 2 }, /* zcaron */
+	{ 3148, 1261, 9, 3 }, /* TripleDot */
+	{ 3157, 1264, 8, 3 }, /* intlarhk */
+	{ 3165, 1267, 5, 3 }, /* sbquo */
+	{ 3170, 1270, 3, 3 }, /* lEg */
+	{ 3173, 1273, 9, 3 }, /* nsubseteq */
+	{ 3182, 1276, 6, 3 }, /* barwed */
+	{ 3188, 1279, 4, 3 }, /* esim */
+	{ 3192, 1282, 5, 3 }, /* boxdR */
+	{ 3197, 1285, 4, 3 }, /* oscr */
+	{ 3201, 1288, 3, 4 }, /* cfr */
+	{ 3204, 1292, 6, 3 }, /* larrpl */
+	{ 3210, 626, 9, 3 }, /* nshortmid */
+	{ 3219, 1295, 5, 3 }, /* nabla */
+	{ 3224, 1298, 5, 2 }, /* varpi */
+	{ 3229, 1300, 7, 3 }, /* demptyv */
+	{ 3236, 1303, 5, 2 }, /* Umacr */
+	{ 3241, 1305, 6, 2 }, /* Odblac */
+	{ 3247, 1307, 8, 3 }, /* cupbrcap */
+	{ 3255, 1310, 8, 3 }, /* curlyvee */
+	{ 3263, 1313, 6, 3 }, /* Vvdash */
+	{ 3269, 1316, 6, 3 }, /* bowtie */
+	{ 3275, 1319, 10, 3 }, /* nLeftarrow */
+	{ 3285, 1322, 2, 2 }, /* Nu */
+	{ 3287, 1324, 5, 2 }, /* umacr */
+	{ 3292, 1326, 6, 3 }, /* larrfs */
+	{ 3298, 1329, 4, 2 }, /* Auml */
+	{ 3302, 1331, 4, 2 }, /* Gdot */
+	{ 3306, 1333, 6, 3 }, /* bigcap */
+	{ 3312, 1336, 11, 6 }, /* NotSuperset */
+	{ 3323, 1342, 7, 3 }, /* suphsub */
+	{ 3330, 72, 21, 3 }, /* NegativeVeryThinSpace */
+	{ 3351, 1345, 4, 4 }, /* Vscr */
+	{ 3355, 1349, 5, 3 }, /* wedge */
+	{ 3360, 1352, 16, 2 }, /* DiacriticalAcute */
+	{ 3376, 353, 10, 3 }, /* succapprox */
+	{ 3386, 1354, 5, 3 }, /* exist */
+	{ 3391, 1352, 5, 2 }, /* acute */
+	{ 3396, 1357, 7, 3 }, /* cudarrl */
+	{ 3403, 72, 18, 3 }, /* NegativeThickSpace */
+	{ 3421, 1360, 4, 3 }, /* emsp */
+	{ 3425, 9, 16, 3 }, /* DownArrowUpArrow */
+	{ 3441, 1363, 3, 2 }, /* Chi */
+	{ 3444, 1365, 4, 3 }, /* omid */
+	{ 3448, 1368, 5, 3 }, /* veeeq */
+	{ 3453, 1371, 5, 3 }, /* awint */
+	{ 3458, 763, 4, 3 }, /* larr */
+	{ 3462, 1374, 4, 3 }, /* gtcc */
+	{ 3466, 1377, 7, 3 }, /* bigodot */
+	{ 3473, 6, 6, 3 }, /* xsqcup */
+	{ 3479, 1380, 8, 3 }, /* cirfnint */
+	{ 3487, 890, 4, 3 }, /* ocir */
+	{ 3491, 1383, 5, 3 }, /* sqsup */
+	{ 3496, 1386, 3, 2 }, /* div */
+	{ 3499, 1388, 6, 3 }, /* prnsim */
+	{ 3505, 1391, 8, 3 }, /* trpezium */
+	{ 3513, 1394, 5, 3 }, /* notni */
+	{ 3518, 1397, 7, 3 }, /* curarrm */
+	{ 3525, 1400, 4, 4 }, /* Ascr */
+	{ 3529, 1404, 2, 3 }, /* el */
+	{ 3531, 1407, 4, 2 }, /* dscy */
+	{ 3535, 995, 5, 3 }, /* nspar */
+	{ 3540, 1409, 6, 3 }, /* lesdot */
+	{ 3546, 1412, 3, 3 }, /* lrm */
+	{ 3549, 1415, 4, 3 }, /* rdca */
+	{ 3553, 1418, 6, 2 }, /* oacute */
+	{ 3559, 1420, 3, 3 }, /* ang */
+	{ 3562, 1336, 7, 6 }, /* nsupset */
+	{ 3569, 153, 10, 3 }, /* circledast */
+	{ 3579, 1423, 6, 3 }, /* simdot */
+	{ 3585, 1426, 6, 3 }, /* veebar */
+	{ 3591, 1429, 2, 3 }, /* ni */
+	{ 3593, 1432, 3, 2 }, /* Icy */
+	{ 3596, 1434, 5, 3 }, /* ropar */
+	{ 3601, 1437, 4, 6 }, /* nang */
+	{ 3605, 1443, 6, 3 }, /* rsaquo */
+	{ 3611, 1446, 3, 2 }, /* lcy */
+	{ 3614, 1273, 5, 3 }, /* nsube */
+	{ 3619, 1448, 8, 3 }, /* infintie */
+	{ 3627, 1451, 5, 3 }, /* boxHD */
+	{ 3632, 1454, 5, 3 }, /* olarr */
+	{ 3637, 186, 4, 3 }, /* part */
+	{ 3641, 95, 5, 2 }, /* epsiv */
+	{ 3646, 1457, 11, 3 }, /* LeftCeiling */
+	{ 3657, 1460, 3, 3 }, /* gne */
+	{ 3660, 1463, 4, 3 }, /* sdot */
+	{ 3664, 1466, 5, 3 }, /* lBarr */
+	{ 3669, 1469, 6, 1 }, /* period */
+	{ 3675, 1470, 11, 3 }, /* VerticalBar */
+	{ 3686, 1473, 4, 2 }, /* Beta */
+	{ 3690, 1475, 8, 3 }, /* multimap */
+	{ 3698, 106, 19, 3 }, /* DoubleLongLeftArrow */
+	{ 3717, 1478, 3, 2 }, /* Scy */
+	{ 3720, 346, 5, 3 }, /* nharr */
+	{ 3725, 1480, 4, 3 }, /* bnot */
+	{ 3729, 1483, 9, 3 }, /* ThinSpace */
+	{ 3738, 1486, 5, 3 }, /* trisb */
+	{ 3743, 1489, 5, 3 }, /* boxhD */
+	{ 3748, 1492, 6, 2 }, /* Kcedil */
+	{ 3754, 1494, 4, 1 }, /* rpar */
+	{ 3758, 1495, 5, 1 }, /* comma */
+	{ 3763, 1496, 4, 3 }, /* tbrk */
+	{ 3767, 1499, 5, 2 }, /* caron */
+	{ 3772, 1501, 5, 3 }, /* iiota */
+	{ 3777, 255, 18, 3 }, /* longleftrightarrow */
+	{ 3795, 1504, 17, 3 }, /* LeftDownVectorBar */
+	{ 3812, 1507, 3, 2 }, /* Ucy */
+	{ 3815, 1509, 6, 3 }, /* ufisht */
+	{ 3821, 1512, 5, 3 }, /* forkv */
+	{ 3826, 1515, 4, 3 }, /* csup */
+	{ 3830, 1518, 14, 3 }, /* RightVectorBar */
+	{ 3844, 1521, 4, 5 }, /* nGtv */
+	{ 3848, 1526, 6, 3 }, /* horbar */
+	{ 3854, 1529, 6, 3 }, /* isinsv */
+	{ 3860, 1532, 5, 3 }, /* gimel */
+	{ 3865, 1535, 4, 4 }, /* cscr */
+	{ 3869, 1539, 5, 2 }, /* ccirc */
+	{ 3874, 1541, 11, 5 }, /* NotLessLess */
+	{ 3885, 1546, 15, 3 }, /* LeftTriangleBar */
+	{ 3900, 1549, 6, 2 }, /* Tcedil */
+	{ 3906, 1551, 4, 3 }, /* Vbar */
+	{ 3910, 1554, 5, 3 }, /* image */
+	{ 3915, 1557, 4, 2 }, /* Cdot */
+	{ 3919, 1559, 3, 4 }, /* Vfr */
+	{ 3922, 1563, 5, 3 }, /* gescc */
+	{ 3927, 67, 9, 3 }, /* varpropto */
+	{ 3936, 1566, 15, 3 }, /* LeftUpTeeVector */
+	{ 3951, 1569, 4, 4 }, /* nvgt */
+	{ 3955, 1573, 6, 3 }, /* emptyv */
+	{ 3961, 1576, 8, 3 }, /* intercal */
+	{ 3969, 1579, 4, 3 }, /* simg */
+	{ 3973, 454, 7, 3 }, /* eqcolon */
+	{ 3980, 1582, 4, 2 }, /* gdot */
+	{ 3984, 1584, 5, 3 }, /* nltri */
+	{ 3989, 1587, 5, 5 }, /* napid */
+	{ 3994, 1592, 4, 2 }, /* LJcy */
+	{ 3998, 1594, 6, 3 }, /* nvrArr */
+	{ 4004, 848, 3, 3 }, /* nsc */
+	{ 4007, 1597, 3, 4 }, /* efr */
+	{ 4010, 1573, 8, 3 }, /* emptyset */
+	{ 4018, 1601, 8, 1 }, /* UnderBar */
+	{ 4026, 1602, 5, 3 }, /* boxdr */
+	{ 4031, 516, 5, 3 }, /* thkap */
+	{ 4036, 72, 19, 3 }, /* NegativeMediumSpace */
+	{ 4055, 1605, 5, 2 }, /* eogon */
+	{ 4060, 1087, 13, 3 }, /* PrecedesTilde */
+	{ 4073, 1607, 7, 3 }, /* cudarrr */
+	{ 4080, 1610, 6, 3 }, /* loplus */
+	{ 4086, 1613, 6, 3 }, /* nvdash */
+	{ 4092, 1616, 7, 3 }, /* cularrp */
+	{ 4099, 1619, 15, 3 }, /* DoubleDownArrow */
+	{ 4114, 1622, 4, 2 }, /* ogon */
+	{ 4118, 175, 6, 3 }, /* hamilt */
+	{ 4124, 1624, 4, 4 }, /* Cscr */
+	{ 4128, 1628, 4, 4 }, /* Bopf */
+	{ 4132, 439, 6, 3 }, /* nrtrie */
+	{ 4138, 331, 12, 3 }, /* ShortUpArrow */
+	{ 4150, 1632, 3, 2 }, /* deg */
+	{ 4153, 1634, 4, 2 }, /* chcy */
+	{ 4157, 1636, 5, 3 }, /* nhpar */
+	{ 4162, 1388, 8, 3 }, /* precnsim */
+	{ 4170, 1639, 6, 2 }, /* dstrok */
+	{ 4176, 1641, 7, 3 }, /* dbkarow */
+	{ 4183, 1644, 5, 2 }, /* raquo */
+	{ 4188, 1646, 5, 3 }, /* ohbar */
+	{ 4193, 1649, 3, 2 }, /* gcy */
+	{ 4196, 1651, 8, 3 }, /* clubsuit */
+	{ 4204, 1654, 4, 3 }, /* rect */
+	{ 4208, 1657, 7, 3 }, /* suplarr */
+	{ 4215, 1660, 6, 2 }, /* racute */
+	{ 4221, 1662, 5, 3 }, /* ndash */
+	{ 4226, 1665, 11, 3 }, /* diamondsuit */
+	{ 4237, 1668, 2, 2 }, /* Pi */
+	{ 4239, 386, 5, 3 }, /* UpTee */
+	{ 4244, 1670, 5, 3 }, /* csupe */
+	{ 4249, 516, 11, 3 }, /* thickapprox */
+	{ 4260, 1673, 5, 3 }, /* fltns */
+	{ 4265, 1676, 4, 3 }, /* Uarr */
+	{ 4269, 1679, 8, 2 }, /* vartheta */
+	{ 4277, 161, 6, 3 }, /* conint */
+	{ 4283, 1681, 5, 3 }, /* harrw */
+	{ 4288, 1684, 8, 3 }, /* RightTee */
+	{ 4296, 1687, 10, 3 }, /* eqslantgtr */
+	{ 4306, 1690, 7, 3 }, /* Diamond */
+	{ 4313, 1693, 4, 4 }, /* Vopf */
+	{ 4317, 1697, 6, 2 }, /* Dcaron */
+	{ 4323, 1699, 11, 3 }, /* eqslantless */
+	{ 4334, 603, 12, 6 }, /* varsupsetneq */
+	{ 4346, 1702, 4, 2 }, /* zdot */
+	{ 4350, 1704, 4, 3 }, /* flat */
+	{ 4354, 1707, 5, 2 }, /* Omega */
+	{ 4359, 1709, 3, 3 }, /* cap */
+	{ 4362, 1712, 4, 4 }, /* Uscr */
+	{ 4366, 1716, 4, 4 }, /* Xscr */
+	{ 4370, 1720, 6, 3 }, /* tprime */
+	{ 4376, 1723, 19, 3 }, /* DownLeftRightVector */
+	{ 4395, 1726, 3, 1 }, /* sol */
+	{ 4398, 1727, 6, 3 }, /* bigcup */
+	{ 4404, 1730, 14, 3 }, /* InvisibleComma */
+	{ 4418, 1733, 13, 3 }, /* longleftarrow */
+	{ 4431, 1736, 5, 3 }, /* natur */
+	{ 4436, 1739, 7, 3 }, /* plussim */
+	{ 4443, 1742, 4, 3 }, /* andd */
+	{ 4447, 1745, 13, 3 }, /* PrecedesEqual */
+	{ 4460, 1748, 7, 3 }, /* cirscir */
+	{ 4467, 1751, 6, 3 }, /* iiiint */
+	{ 4473, 1754, 3, 4 }, /* wfr */
+	{ 4476, 1758, 4, 3 }, /* sext */
+	{ 4480, 1727, 4, 3 }, /* xcup */
+	{ 4484, 1761, 7, 3 }, /* rarrsim */
+	{ 4491, 147, 13, 3 }, /* triangleright */
+	{ 4504, 1764, 6, 3 }, /* ltimes */
+	{ 4510, 419, 8, 3 }, /* Precedes */
+	{ 4518, 1767, 5, 2 }, /* cedil */
+	{ 4523, 561, 21, 3 }, /* FilledVerySmallSquare */
+	{ 4544, 1769, 4, 2 }, /* sup1 */
+	{ 4548, 1771, 8, 3 }, /* NotTilde */
+	{ 4556, 1774, 6, 3 }, /* angsph */
+	{ 4562, 1777, 6, 2 }, /* zacute */
+	{ 4568, 1779, 20, 3 }, /* DoubleLeftRightArrow */
+	{ 4588, 1782, 10, 3 }, /* rightarrow */
+	{ 4598, 1785, 3, 4 }, /* qfr */
+	{ 4601, 1789, 5, 2 }, /* OElig */
+	{ 4606, 1791, 6, 2 }, /* Abreve */
+	{ 4612, 1793, 7, 3 }, /* ccupssm */
+	{ 4619, 1796, 17, 5 }, /* NotNestedLessLess */
+	{ 4636, 1801, 3, 4 }, /* gfr */
+	{ 4639, 1805, 6, 3 }, /* CupCap */
+	{ 4645, 1808, 5, 6 }, /* nvsim */
+	{ 4650, 1814, 9, 3 }, /* gtrapprox */
+	{ 4659, 1817, 8, 5 }, /* notindot */
+	{ 4667, 1822, 5, 2 }, /* Emacr */
+	{ 4672, 1824, 6, 3 }, /* minusd */
+	{ 4678, 1827, 4, 2 }, /* sup3 */
+	{ 4682, 1829, 4, 4 }, /* Tscr */
+	{ 4686, 1833, 4, 3 }, /* epar */
+	{ 4690, 1499, 5, 2 }, /* Hacek */
+	{ 4695, 1836, 7, 3 }, /* notinvc */
+	{ 4702, 219, 9, 6 }, /* gvertneqq */
+	{ 4711, 1839, 6, 3 }, /* nvDash */
+	{ 4717, 1454, 15, 3 }, /* circlearrowleft */
+	{ 4732, 1842, 6, 2 }, /* utilde */
+	{ 4738, 243, 5, 3 }, /* orarr */
+	{ 4743, 1733, 13, 3 }, /* LongLeftArrow */
+	{ 4756, 1844, 6, 3 }, /* sstarf */
+	{ 4762, 1847, 5, 2 }, /* Theta */
+	{ 4767, 1849, 4, 3 }, /* lArr */
+	{ 4771, 419, 4, 3 }, /* prec */
+	{ 4775, 1521, 17, 5 }, /* NotGreaterGreater */
+	{ 4792, 1852, 8, 3 }, /* triminus */
+	{ 4800, 1855, 5, 3 }, /* amalg */
+	{ 4805, 1858, 6, 3 }, /* wedbar */
+	{ 4811, 1861, 5, 2 }, /* iexcl */
+	{ 4816, 1863, 6, 3 }, /* nprcue */
+	{ 4822, 1866, 2, 2 }, /* mu */
+	{ 4824, 1868, 7, 3 }, /* supmult */
+	{ 4831, 1871, 4, 4 }, /* fopf */
+	{ 4835, 1875, 5, 3 }, /* minus */
+	{ 4840, 1878, 16, 3 }, /* NotSupersetEqual */
+	{ 4856, 1881, 6, 3 }, /* lmoust */
+	{ 4862, 1884, 3, 2 }, /* pcy */
+	{ 4865, 1886, 4, 1 }, /* lsqb */
+	{ 4869, 1887, 5, 3 }, /* erDot */
+	{ 4874, 1890, 5, 3 }, /* ccups */
+	{ 4879, 276, 6, 3 }, /* bumpeq */
+	{ 4885, 1893, 16, 3 }, /* GreaterFullEqual */
+	{ 4901, 1896, 5, 2 }, /* tshcy */
+	{ 4906, 1898, 5, 3 }, /* oline */
+	{ 4911, 1901, 4, 4 }, /* hopf */
+	{ 4915, 417, 5, 2 }, /* upsih */
+	{ 4920, 1905, 6, 3 }, /* ulcrop */
+	{ 4926, 1908, 12, 3 }, /* exponentiale */
+	{ 4938, 1911, 3, 2 }, /* dcy */
+	{ 4941, 1913, 3, 3 }, /* cup */
+	{ 4944, 626, 14, 3 }, /* NotVerticalBar */
+	{ 4958, 1916, 5, 3 }, /* filig */
+	{ 4963, 12, 8, 3 }, /* circledS */
+	{ 4971, 1919, 16, 3 }, /* UnderParenthesis */
+	{ 4987, 1922, 4, 1 }, /* semi */
+	{ 4991, 1923, 17, 3 }, /* DownLeftVectorBar */
+	{ 5008, 1926, 5, 3 }, /* Colon */
+	{ 5013, 1929, 5, 3 }, /* lbrke */
+	{ 5018, 1932, 5, 3 }, /* ngsim */
+	{ 5023, 1935, 6, 3 }, /* swnwar */
+	{ 5029, 1938, 4, 3 }, /* bull */
+	{ 5033, 1166, 6, 5 }, /* nbumpe */
+	{ 5039, 1941, 6, 3 }, /* frac56 */
+	{ 5045, 1944, 6, 2 }, /* Dstrok */
+	{ 5051, 1946, 16, 5 }, /* NotPrecedesEqual */
+	{ 5067, 1951, 6, 3 }, /* subdot */
+	{ 5073, 1954, 5, 3 }, /* trade */
+	{ 5078, 1957, 8, 3 }, /* drbkarow */
+	{ 5086, 1960, 4, 2 }, /* IOcy */
+	{ 5090, 1962, 4, 2 }, /* edot */
+	{ 5094, 1964, 6, 3 }, /* frac45 */
+	{ 5100, 1967, 10, 3 }, /* gtreqqless */
+	{ 5110, 1970, 6, 2 }, /* Ncedil */
+	{ 5116, 1972, 6, 1 }, /* rbrack */
+	{ 5122, 1973, 5, 3 }, /* rnmid */
+	{ 5127, 1976, 7, 3 }, /* lbrkslu */
+	{ 5134, 1979, 4, 3 }, /* dtri */
+	{ 5138, 1157, 24, 3 }, /* DoubleLongLeftRightArrow */
+	{ 5162, 1254, 2, 3 }, /* ge */
+	{ 5164, 760, 3, 3 }, /* par */
+	{ 5167, 1049, 9, 3 }, /* UnionPlus */
+	{ 5176, 1982, 4, 2 }, /* iota */
+	{ 5180, 1576, 6, 3 }, /* intcal */
+	{ 5186, 1984, 6, 3 }, /* plusdu */
+	{ 5192, 1107, 4, 1 }, /* lcub */
+	{ 5196, 1987, 6, 3 }, /* mstpos */
+	{ 5202, 1990, 4, 3 }, /* ntlg */
+	{ 5206, 1993, 3, 3 }, /* Zfr */
+	{ 5209, 1996, 16, 3 }, /* EmptySmallSquare */
+	{ 5225, 1999, 2, 3 }, /* wp */
+	{ 5227, 2002, 13, 3 }, /* upharpoonleft */
+	{ 5240, 1707, 3, 2 }, /* ohm */
+	{ 5243, 893, 4, 3 }, /* varr */
+	{ 5247, 2005, 5, 3 }, /* dtrif */
+	{ 5252, 2008, 5, 3 }, /* lbarr */
+	{ 5257, 2011, 4, 4 }, /* lscr */
+	{ 5261, 2015, 9, 3 }, /* Coproduct */
+	{ 5270, 2018, 7, 3 }, /* bemptyv */
+	{ 5277, 1231, 7, 3 }, /* nearrow */
+	{ 5284, 2021, 6, 3 }, /* rAtail */
+	{ 5290, 1001, 13, 3 }, /* VeryThinSpace */
+	{ 5303, 516, 2, 3 }, /* ap */
+	{ 5305, 2024, 6, 3 }, /* ltrPar */
+	{ 5311, 2027, 17, 3 }, /* SquareSubsetEqual */
+	{ 5328, 1199, 4, 3 }, /* harr */
+	{ 5332, 2030, 5, 3 }, /* lhblk */
+	{ 5337, 791, 5, 3 }, /* larrb */
+	{ 5342, 995, 4, 3 }, /* npar */
+	{ 5346, 2033, 2, 3 }, /* or */
+	{ 5348, 2036, 7, 3 }, /* napprox */
+	{ 5355, 2039, 5, 2 }, /* aring */
+	{ 5360, 2041, 4, 3 }, /* lHar */
+	{ 5364, 2044, 4, 4 }, /* eopf */
+	{ 5368, 2048, 4, 6 }, /* gesl */
+	{ 5372, 2054, 6, 2 }, /* lambda */
+	{ 5378, 2056, 8, 3 }, /* awconint */
+	{ 5386, 2059, 7, 2 }, /* Upsilon */
+	{ 5393, 2061, 6, 2 }, /* rcaron */
+	{ 5399, 480, 6, 2 }, /* varphi */
+	{ 5405, 928, 5, 3 }, /* rdquo */
+	{ 5410, 1926, 10, 3 }, /* Proportion */
+	{ 5420, 84, 4, 3 }, /* bbrk */
+	{ 5424, 2063, 4, 2 }, /* Edot */
+	{ 5428, 2065, 3, 2 }, /* icy */
+	{ 5431, 1745, 3, 3 }, /* pre */
+	{ 5434, 2067, 8, 3 }, /* angmsdag */
+	{ 5442, 2070, 17, 3 }, /* rightleftharpoons */
+	{ 5459, 2073, 8, 3 }, /* ldrushar */
+	{ 5467, 1429, 3, 3 }, /* niv */
+	{ 5470, 2076, 7, 5 }, /* nsucceq */
+	{ 5477, 1886, 6, 1 }, /* lbrack */
+	{ 5483, 2081, 7, 3 }, /* pertenk */
+	{ 5490, 2084, 6, 2 }, /* SHCHcy */
+	{ 5496, 2086, 5, 3 }, /* simeq */
+	{ 5501, 2089, 6, 2 }, /* Nacute */
+	{ 5507, 1336, 5, 6 }, /* vnsup */
+	{ 5512, 2005, 17, 3 }, /* blacktriangledown */
+	{ 5529, 2091, 16, 3 }, /* rightharpoondown */
+	{ 5545, 2094, 5, 3 }, /* vDash */
+	{ 5550, 2097, 4, 4 }, /* fscr */
+	{ 5554, 2101, 4, 2 }, /* Iota */
+	{ 5558, 26, 2, 3 }, /* lE */
+	{ 5560, 2103, 4, 1 }, /* excl */
+	{ 5564, 2104, 6, 3 }, /* female */
+	{ 5570, 731, 14, 3 }, /* Longrightarrow */
+	{ 5584, 2107, 6, 3 }, /* DotDot */
+	{ 5590, 1782, 4, 3 }, /* rarr */
+	{ 5594, 2110, 3, 3 }, /* nis */
+	{ 5597, 1093, 7, 3 }, /* nsqsupe */
+	{ 5604, 2113, 4, 3 }, /* ange */
+	{ 5608, 2116, 3, 3 }, /* leg */
+	{ 5611, 2119, 6, 3 }, /* supsup */
+	{ 5617, 2122, 7, 3 }, /* subrarr */
+	{ 5624, 2125, 7, 3 }, /* larrsim */
+	{ 5631, 161, 15, 3 }, /* ContourIntegral */
+	{ 5646, 2128, 3, 3 }, /* les */
+	{ 5649, 516, 6, 3 }, /* approx */
+	{ 5655, 2131, 7, 3 }, /* npolint */
+	{ 5662, 1782, 10, 3 }, /* RightArrow */
+	{ 5672, 2134, 4, 3 }, /* late */
+	{ 5676, 561, 6, 3 }, /* squarf */
+	{ 5682, 2137, 8, 3 }, /* DDotrahd */
+	{ 5690, 2140, 3, 4 }, /* Ufr */
+	{ 5693, 2144, 4, 4 }, /* ascr */
+	{ 5697, 2148, 5, 3 }, /* bcong */
+	{ 5702, 2151, 8, 3 }, /* andslope */
+	{ 5710, 2154, 4, 2 }, /* epsi */
+	{ 5714, 699, 5, 3 }, /* sqcap */
+	{ 5719, 839, 24, 3 }, /* ClockwiseContourIntegral */
+	{ 5743, 2156, 5, 2 }, /* Eogon */
+	{ 5748, 2158, 7, 3 }, /* larrbfs */
+	{ 5755, 2161, 16, 3 }, /* RightUpTeeVector */
+	{ 5771, 2164, 6, 2 }, /* ccedil */
+	{ 5777, 2166, 5, 3 }, /* bsime */
+	{ 5782, 2169, 6, 3 }, /* bigvee */
+	{ 5788, 917, 4, 2 }, /* rhov */
+	{ 5792, 2172, 5, 5 }, /* nbump */
+	{ 5797, 1767, 7, 2 }, /* Cedilla */
+	{ 5804, 2177, 4, 4 }, /* iscr */
+	{ 5808, 2181, 3, 2 }, /* Ycy */
+	{ 5811, 2183, 4, 4 }, /* gopf */
+	{ 5815, 2187, 3, 6 }, /* nLt */
+	{ 5818, 2193, 2, 3 }, /* Ll */
+	{ 5820, 2196, 4, 4 }, /* sscr */
+	{ 5824, 663, 8, 3 }, /* Integral */
+	{ 5832, 1733, 5, 3 }, /* xlarr */
+	{ 5837, 2200, 3, 3 }, /* orv */
+	{ 5840, 1573, 10, 3 }, /* varnothing */
+	{ 5850, 2203, 6, 2 }, /* frac12 */
+	{ 5856, 2205, 15, 3 }, /* rightsquigarrow */
+	{ 5871, 2208, 6, 3 }, /* spades */
+	{ 5877, 2211, 3, 2 }, /* bcy */
+	{ 5880, 2213, 13, 3 }, /* RightArrowBar */
+	{ 5893, 2216, 3, 3 }, /* Rsh */
+	{ 5896, 2027, 6, 3 }, /* sqsube */
+	{ 5902, 536, 9, 3 }, /* checkmark */
+	{ 5911, 1267, 6, 3 }, /* lsquor */
+	{ 5917, 1147, 11, 3 }, /* succcurlyeq */
+	{ 5928, 2219, 4, 4 }, /* Dscr */
+	{ 5932, 2223, 5, 3 }, /* xutri */
+	{ 5937, 2226, 4, 2 }, /* circ */
+	{ 5941, 1619, 4, 3 }, /* dArr */
+	{ 5945, 2228, 6, 3 }, /* minusb */
+	{ 5951, 2231, 3, 3 }, /* ape */
+	{ 5954, 1273, 14, 3 }, /* NotSubsetEqual */
+	{ 5968, 2234, 5, 3 }, /* eplus */
+	{ 5973, 2237, 9, 3 }, /* Mellintrf */
+	{ 5982, 2240, 7, 3 }, /* bigstar */
+	{ 5989, 2243, 6, 3 }, /* elsdot */
+	{ 5995, 2246, 6, 2 }, /* Zcaron */
+	{ 6001, 2248, 7, 3 }, /* supedot */
+	{ 6008, 2251, 3, 3 }, /* Lsh */
+	{ 6011, 2254, 7, 3 }, /* lesssim */
+	{ 6018, 2257, 6, 3 }, /* hyphen */
+	{ 6024, 2260, 5, 3 }, /* loang */
+	{ 6029, 331, 7, 3 }, /* UpArrow */
+	{ 6036, 2263, 3, 4 }, /* Dfr */
+	{ 6039, 2267, 4, 4 }, /* topf */
+	{ 6043, 2271, 5, 3 }, /* prime */
+	{ 6048, 1573, 5, 3 }, /* empty */
+	{ 6053, 2274, 5, 3 }, /* vBarv */
+	{ 6058, 2277, 2, 3 }, /* Or */
+	{ 6060, 2280, 6, 2 }, /* Yacute */
+	{ 6066, 2282, 6, 2 }, /* Iacute */
+	{ 6072, 2284, 6, 3 }, /* egsdot */
+	{ 6078, 1157, 18, 3 }, /* Longleftrightarrow */
+	{ 6096, 824, 5, 3 }, /* reals */
+	{ 6101, 2287, 5, 3 }, /* frasl */
+	{ 6106, 2290, 3, 2 }, /* eng */
+	{ 6109, 2292, 4, 2 }, /* COPY */
+	{ 6113, 2294, 4, 3 }, /* Esim */
+	{ 6117, 2297, 4, 3 }, /* lneq */
+	{ 6121, 2237, 4, 3 }, /* Mscr */
+	{ 6125, 2300, 5, 2 }, /* ecirc */
+	{ 6130, 2302, 5, 3 }, /* efDot */
+	{ 6135, 2305, 7, 3 }, /* dotplus */
+	{ 6142, 2308, 5, 3 }, /* phone */
+	{ 6147, 2311, 4, 2 }, /* uuml */
+	{ 6151, 2313, 3, 3 }, /* glj */
+	{ 6154, 2316, 4, 4 }, /* Fopf */
+	{ 6158, 877, 8, 3 }, /* hkswarow */
+	{ 6166, 2320, 8, 3 }, /* integers */
+	{ 6174, 570, 5, 3 }, /* ltrie */
+	{ 6179, 2323, 2, 2 }, /* pm */
+	{ 6181, 2325, 2, 2 }, /* xi */
+	{ 6183, 2327, 5, 3 }, /* lltri */
+	{ 6188, 2330, 6, 3 }, /* prurel */
+	{ 6194, 2333, 4, 3 }, /* andv */
+	{ 6198, 2336, 4, 3 }, /* boxV */
+	{ 6202, 2339, 3, 2 }, /* eth */
+	{ 6205, 2341, 6, 2 }, /* ecaron */
+	{ 6211, 2343, 5, 3 }, /* rarrc */
+	{ 6216, 2346, 6, 2 }, /* hardcy */
+	{ 6222, 2348, 16, 3 }, /* twoheadleftarrow */
+	{ 6238, 2351, 10, 6 }, /* ThickSpace */
+	{ 6248, 2357, 4, 2 }, /* shcy */
+	{ 6252, 2359, 7, 6 }, /* bnequiv */
+	{ 6259, 2365, 6, 2 }, /* lstrok */
+	{ 6265, 2367, 4, 2 }, /* Yuml */
+	{ 6269, 2369, 7, 3 }, /* congdot */
+	{ 6276, 2372, 5, 3 }, /* uuarr */
+	{ 6281, 2375, 5, 3 }, /* boxVL */
+	{ 6286, 2378, 5, 3 }, /* simne */
+	{ 6291, 2381, 4, 4 }, /* lopf */
+	{ 6295, 2385, 6, 2 }, /* Utilde */
+	{ 6301, 2387, 9, 2 }, /* CenterDot */
+	{ 6310, 75, 18, 3 }, /* RightTriangleEqual */
+	{ 6328, 2389, 11, 3 }, /* SquareUnion */
+	{ 6339, 58, 6, 3 }, /* subset */
+	{ 6345, 2392, 7, 3 }, /* equivDD */
+	{ 6352, 856, 11, 3 }, /* expectation */
+	{ 6363, 2395, 4, 4 }, /* uopf */
+	{ 6367, 2399, 5, 3 }, /* aleph */
+	{ 6372, 780, 6, 3 }, /* nexist */
+	{ 6378, 2402, 5, 3 }, /* nwarr */
+	{ 6383, 2405, 6, 3 }, /* apacir */
+	{ 6389, 2408, 4, 2 }, /* sect */
+	{ 6393, 2410, 6, 2 }, /* uacute */
+	{ 6399, 1844, 4, 3 }, /* Star */
+	{ 6403, 121, 7, 3 }, /* realine */
+	{ 6410, 2412, 3, 2 }, /* ncy */
+	{ 6413, 2414, 11, 3 }, /* preccurlyeq */
+	{ 6424, 2251, 3, 3 }, /* lsh */
+	{ 6427, 2417, 5, 2 }, /* breve */
+	{ 6432, 2419, 2, 2 }, /* Mu */
+	{ 6434, 2421, 14, 3 }, /* ntriangleright */
+	{ 6448, 2424, 6, 2 }, /* lacute */
+	{ 6454, 2426, 16, 3 }, /* vartriangleright */
+	{ 6470, 2429, 8, 3 }, /* dzigrarr */
+	{ 6478, 2432, 5, 3 }, /* rharu */
+	{ 6483, 1979, 12, 3 }, /* triangledown */
+	{ 6495, 570, 17, 3 }, /* LeftTriangleEqual */
+	{ 6512, 2435, 5, 3 }, /* boxhu */
+	{ 6517, 1298, 3, 2 }, /* piv */
+	{ 6520, 2438, 6, 3 }, /* dlcrop */
+	{ 6526, 675, 11, 3 }, /* CircleTimes */
+	{ 6537, 2441, 6, 3 }, /* rfloor */
+	{ 6543, 2444, 6, 3 }, /* qprime */
+	{ 6549, 2231, 8, 3 }, /* approxeq */
+	{ 6557, 31, 6, 3 }, /* forall */
+	{ 6563, 2447, 3, 2 }, /* rho */
+	{ 6566, 646, 17, 5 }, /* NotLessSlantEqual */
+	{ 6583, 780, 7, 3 }, /* nexists */
+	{ 6590, 576, 9, 3 }, /* therefore */
+	{ 6599, 2449, 8, 3 }, /* angmsdaa */
+	{ 6607, 971, 4, 3 }, /* nleq */
+	{ 6611, 2452, 5, 2 }, /* thorn */
+	{ 6616, 1679, 8, 2 }, /* thetasym */
+	{ 6624, 855, 12, 1 }, /* VerticalLine */
+	{ 6636, 1470, 4, 3 }, /* smid */
+	{ 6640, 2417, 5, 2 }, /* Breve */
+	{ 6645, 2454, 3, 2 }, /* Rho */
+	{ 6648, 2456, 5, 3 }, /* cross */
+	{ 6653, 2459, 5, 3 }, /* frown */
+	{ 6658, 2462, 10, 3 }, /* longmapsto */
+	{ 6668, 2465, 3, 2 }, /* ycy */
+	{ 6671, 1730, 2, 3 }, /* ic */
+	{ 6673, 2467, 3, 4 }, /* ufr */
+	{ 6676, 2471, 3, 4 }, /* Lfr */
+	{ 6679, 2475, 14, 3 }, /* DownLeftVector */
+	{ 6693, 1690, 4, 3 }, /* diam */
+	{ 6697, 2478, 4, 2 }, /* euml */
+	{ 6701, 2480, 6, 3 }, /* Colone */
+	{ 6707, 2483, 8, 3 }, /* rtriltri */
+	{ 6715, 2086, 10, 3 }, /* TildeEqual */
+	{ 6725, 1205, 12, 3 }, /* SquareSubset */
+	{ 6737, 2486, 4, 3 }, /* siml */
+	{ 6741, 2489, 5, 3 }, /* equiv */
+	{ 6746, 2492, 6, 3 }, /* frac35 */
+	{ 6752, 998, 3, 3 }, /* ggg */
+	{ 6755, 2495, 4, 2 }, /* Euml */
+	{ 6759, 1751, 4, 3 }, /* qint */
+	{ 6763, 2497, 8, 3 }, /* plusacir */
+	{ 6771, 2500, 6, 3 }, /* nvHarr */
+	{ 6777, 1070, 6, 3 }, /* ssmile */
+	{ 6783, 2503, 4, 3 }, /* osol */
+	{ 6787, 1908, 2, 3 }, /* ee */
+	{ 6789, 2506, 10, 3 }, /* precapprox */
+	{ 6799, 2509, 5, 3 }, /* boxUr */
+	{ 6804, 2512, 23, 5 }, /* NotNestedGreaterGreater */
+	{ 6827, 2517, 6, 3 }, /* lthree */
+	{ 6833, 2399, 7, 3 }, /* alefsym */
+	{ 6840, 95, 15, 2 }, /* straightepsilon */
+	{ 6855, 2520, 3, 4 }, /* bfr */
+	{ 6858, 1013, 2, 3 }, /* le */
+	{ 6860, 2524, 2, 3 }, /* eg */
+	{ 6862, 2527, 6, 2 }, /* tcedil */
+	{ 6868, 1276, 8, 3 }, /* barwedge */
+	{ 6876, 2529, 3, 4 }, /* dfr */
+	{ 6879, 788, 10, 3 }, /* ImaginaryI */
+	{ 6889, 705, 5, 3 }, /* Wedge */
+	{ 6894, 2533, 3, 2 }, /* ecy */
+	{ 6897, 2070, 11, 3 }, /* Equilibrium */
+	{ 6908, 2535, 10, 3 }, /* supsetneqq */
+	{ 6918, 2538, 4, 4 }, /* jscr */
+	{ 6922, 1727, 5, 3 }, /* Union */
+	{ 6927, 2542, 5, 2 }, /* imacr */
+	{ 6932, 2544, 4, 4 }, /* Qscr */
+	{ 6936, 2462, 4, 3 }, /* xmap */
+	{ 6940, 2548, 5, 1 }, /* colon */
+	{ 6945, 194, 3, 5 }, /* ngE */
+	{ 6948, 2549, 3, 3 }, /* Int */
+	{ 6951, 2552, 5, 3 }, /* scnap */
+	{ 6956, 2555, 6, 2 }, /* kappav */
+	{ 6962, 2557, 6, 3 }, /* becaus */
+	{ 6968, 948, 13, 3 }, /* RightTeeArrow */
+	{ 6981, 2560, 10, 3 }, /* complement */
+	{ 6991, 2563, 11, 3 }, /* NotPrecedes */
+	{ 7002, 2432, 11, 3 }, /* RightVector */
+	{ 7013, 2566, 5, 2 }, /* tilde */
+	{ 7018, 2568, 4, 3 }, /* euro */
+	{ 7022, 2571, 3, 4 }, /* Gfr */
+	{ 7025, 2575, 4, 4 }, /* bopf */
+	{ 7029, 2579, 3, 3 }, /* smt */
+	{ 7032, 2582, 4, 4 }, /* iopf */
+	{ 7036, 2586, 7, 3 }, /* topfork */
+	{ 7043, 2589, 6, 3 }, /* eparsl */
+	{ 7049, 2432, 14, 3 }, /* rightharpoonup */
+	{ 7063, 2592, 5, 3 }, /* sdotb */
+	{ 7068, 910, 6, 3 }, /* succeq */
+	{ 7074, 2595, 6, 1 }, /* dollar */
+	{ 7080, 90, 4, 3 }, /* isin */
+	{ 7084, 2560, 4, 3 }, /* comp */
+	{ 7088, 2596, 10, 3 }, /* UpArrowBar */
+	{ 7098, 708, 18, 3 }, /* blacktriangleright */
+	{ 7116, 2599, 7, 3 }, /* notnivc */
+	{ 7123, 87, 4, 3 }, /* odot */
+	{ 7127, 2602, 5, 3 }, /* angrt */
+	{ 7132, 2605, 10, 3 }, /* rmoustache */
+	{ 7142, 2608, 15, 3 }, /* LowerRightArrow */
+	{ 7157, 2611, 4, 4 }, /* copf */
+	{ 7161, 1090, 5, 3 }, /* Dashv */
+	{ 7166, 2615, 4, 6 }, /* lvnE */
+	{ 7170, 2621, 6, 2 }, /* oslash */
+	{ 7176, 2623, 8, 3 }, /* angmsdaf */
+	{ 7184, 2626, 5, 3 }, /* caret */
+	{ 7189, 2629, 6, 3 }, /* nwnear */
+	{ 7195, 1136, 4, 3 }, /* darr */
+	{ 7199, 2632, 5, 3 }, /* Cross */
+	{ 7204, 2635, 4, 4 }, /* Gscr */
+	{ 7208, 442, 3, 3 }, /* loz */
+	{ 7211, 2639, 3, 4 }, /* Ffr */
+	{ 7214, 2643, 13, 3 }, /* smallsetminus */
+	{ 7227, 1035, 10, 3 }, /* UpTeeArrow */
+	{ 7237, 626, 5, 3 }, /* nsmid */
+	{ 7242, 2646, 4, 4 }, /* dscr */
+	{ 7246, 2650, 5, 2 }, /* Ycirc */
+	{ 7251, 1863, 21, 3 }, /* NotPrecedesSlantEqual */
+	{ 7272, 2302, 13, 3 }, /* fallingdotseq */
+	{ 7285, 2652, 5, 2 }, /* angst */
+	{ 7290, 2654, 3, 2 }, /* Rcy */
+	{ 7293, 267, 10, 3 }, /* subsetneqq */
+	{ 7303, 2656, 6, 3 }, /* scnsim */
+	{ 7309, 2659, 5, 2 }, /* Sigma */
+	{ 7314, 2661, 4, 3 }, /* trie */
+	{ 7318, 2664, 5, 2 }, /* ijlig */
+	{ 7323, 2666, 4, 3 }, /* rHar */
+	{ 7327, 2669, 3, 1 }, /* Tab */
+	{ 7330, 615, 13, 3 }, /* VerticalTilde */
+	{ 7343, 2670, 18, 3 }, /* RightDoubleBracket */
+	{ 7361, 928, 6, 3 }, /* rdquor */
+	{ 7367, 620, 9, 3 }, /* bigotimes */
+	{ 7376, 2673, 6, 3 }, /* parsim */
+	{ 7382, 2676, 4, 4 }, /* xopf */
+	{ 7386, 2680, 3, 2 }, /* Mcy */
+	{ 7389, 2682, 13, 3 }, /* leftharpoonup */
+	{ 7402, 2685, 22, 2 }, /* DiacriticalDoubleAcute */
+	{ 7424, 2687, 3, 3 }, /* Map */
+	{ 7427, 2690, 6, 3 }, /* lfisht */
+	{ 7433, 1887, 12, 3 }, /* risingdotseq */
+	{ 7445, 2693, 6, 3 }, /* topcir */
+	{ 7451, 2475, 5, 3 }, /* lhard */
+	{ 7456, 995, 9, 3 }, /* nparallel */
+	{ 7465, 2696, 3, 2 }, /* ocy */
+	{ 7468, 1483, 6, 3 }, /* thinsp */
+	{ 7474, 2698, 6, 2 }, /* Ncaron */
+	{ 7480, 995, 20, 3 }, /* NotDoubleVerticalBar */
+	{ 7500, 835, 3, 2 }, /* die */
+	{ 7503, 2700, 4, 3 }, /* lozf */
+	{ 7507, 2703, 6, 3 }, /* Dagger */
+	{ 7513, 1124, 17, 3 }, /* LeftDoubleBracket */
+	{ 7530, 2706, 4, 5 }, /* napE */
+	{ 7534, 2711, 5, 3 }, /* rbrke */
+	{ 7539, 2714, 4, 2 }, /* Idot */
+	{ 7543, 2716, 6, 3 }, /* latail */
+	{ 7549, 2128, 14, 3 }, /* LessSlantEqual */
+	{ 7563, 2719, 6, 3 }, /* subsup */
+	{ 7569, 2722, 6, 6 }, /* sqcups */
+	{ 7575, 2728, 3, 3 }, /* lap */
+	{ 7578, 2731, 4, 3 }, /* rdsh */
+	{ 7582, 2734, 3, 4 }, /* hfr */
+	{ 7585, 804, 7, 3 }, /* between */
+	{ 7592, 480, 11, 2 }, /* straightphi */
+	{ 7603, 1699, 3, 3 }, /* els */
+	{ 7606, 2387, 9, 2 }, /* centerdot */
+	{ 7615, 2738, 4, 4 }, /* rscr */
+	{ 7619, 2742, 12, 3 }, /* DownArrowBar */
+	{ 7631, 428, 3, 3 }, /* Cfr */
+	{ 7634, 2745, 5, 3 }, /* mdash */
+	{ 7639, 2748, 6, 3 }, /* hslash */
+	{ 7645, 2751, 6, 1 }, /* equals */
+	{ 7651, 2752, 6, 3 }, /* target */
+	{ 7657, 2755, 4, 3 }, /* Sqrt */
+	{ 7661, 2758, 7, 3 }, /* planckh */
+	{ 7668, 2761, 6, 3 }, /* incare */
+	{ 7674, 919, 5, 3 }, /* nhArr */
+	{ 7679, 1460, 4, 3 }, /* gneq */
+	{ 7683, 2764, 9, 3 }, /* supsetneq */
+	{ 7692, 2767, 4, 2 }, /* Zdot */
+	{ 7696, 2769, 5, 3 }, /* disin */
+	{ 7701, 2772, 5, 3 }, /* nwArr */
+	{ 7706, 2775, 4, 4 }, /* xscr */
+	{ 7710, 1584, 15, 3 }, /* NotLeftTriangle */
+	{ 7725, 2779, 6, 2 }, /* Jsercy */
+	{ 7731, 2781, 6, 2 }, /* Scaron */
+	{ 7737, 2783, 8, 3 }, /* DotEqual */
+	{ 7745, 2254, 4, 3 }, /* lsim */
+	{ 7749, 2786, 14, 3 }, /* hookrightarrow */
+	{ 7763, 1087, 5, 3 }, /* prsim */
+	{ 7768, 2789, 6, 3 }, /* lsaquo */
+	{ 7774, 2792, 5, 2 }, /* micro */
+	{ 7779, 2489, 9, 3 }, /* Congruent */
+	{ 7788, 1319, 5, 3 }, /* nlArr */
+	{ 7793, 751, 6, 3 }, /* rsquor */
+	{ 7799, 2426, 5, 3 }, /* vrtri */
+	{ 7804, 2794, 6, 2 }, /* shchcy */
+	{ 7810, 496, 5, 3 }, /* rbarr */
+	{ 7815, 2796, 8, 3 }, /* profline */
+	{ 7823, 2389, 5, 3 }, /* sqcup */
+	{ 7828, 2799, 6, 3 }, /* rarrlp */
+	{ 7834, 2802, 4, 2 }, /* Uuml */
+	{ 7838, 331, 7, 3 }, /* uparrow */
+	{ 7845, 2804, 9, 3 }, /* supseteqq */
+	{ 7854, 2807, 8, 3 }, /* bsolhsub */
+	{ 7862, 2810, 5, 3 }, /* bumpE */
+	{ 7867, 2608, 7, 3 }, /* searrow */
+	{ 7874, 433, 19, 3 }, /* LeftArrowRightArrow */
+	{ 7893, 2813, 6, 2 }, /* abreve */
+	{ 7899, 2815, 6, 2 }, /* inodot */
+	{ 7905, 1779, 14, 3 }, /* Leftrightarrow */
+	{ 7919, 2817, 3, 4 }, /* rfr */
+	{ 7922, 1987, 2, 3 }, /* ac */
+	{ 7924, 2821, 4, 3 }, /* toea */
+	{ 7928, 1243, 5, 3 }, /* cuepr */
+	{ 7933, 2824, 5, 3 }, /* prnap */
+	{ 7938, 2827, 6, 2 }, /* tstrok */
+	{ 7944, 2829, 7, 3 }, /* lbrksld */
+	{ 7951, 67, 4, 3 }, /* prop */
+	{ 7955, 2832, 7, 3 }, /* suphsol */
+	{ 7962, 2835, 16, 3 }, /* RightTriangleBar */
+	{ 7978, 2838, 7, 3 }, /* supplus */
+	{ 7985, 2841, 17, 3 }, /* DownLeftTeeVector */
+	{ 8002, 20, 7, 2 }, /* digamma */
+	{ 8009, 2844, 13, 3 }, /* ApplyFunction */
+	{ 8022, 2847, 4, 2 }, /* yucy */
+	{ 8026, 2849, 6, 2 }, /* sacute */
+	{ 8032, 2851, 6, 2 }, /* brvbar */
+	{ 8038, 2853, 5, 3 }, /* csube */
+	{ 8043, 2856, 4, 3 }, /* sung */
+	{ 8047, 2859, 5, 2 }, /* acirc */
+	{ 8052, 2861, 4, 2 }, /* njcy */
+	{ 8056, 2863, 4, 3 }, /* prod */
+	{ 8060, 1270, 10, 3 }, /* lesseqqgtr */
+	{ 8070, 2866, 7, 3 }, /* Cconint */
+	{ 8077, 2869, 6, 3 }, /* compfn */
+	{ 8083, 2872, 7, 3 }, /* isindot */
+	{ 8090, 2875, 5, 3 }, /* numsp */
+	{ 8095, 2878, 4, 2 }, /* yuml */
+	{ 8099, 2086, 4, 3 }, /* sime */
+	{ 8103, 2880, 5, 3 }, /* Equal */
+	{ 8108, 2883, 5, 3 }, /* erarr */
+	{ 8113, 395, 6, 3 }, /* bernou */
+	{ 8119, 743, 13, 3 }, /* divideontimes */
+	{ 8132, 2886, 4, 4 }, /* Yopf */
+	{ 8136, 2027, 10, 3 }, /* sqsubseteq */
+	{ 8146, 2890, 3, 3 }, /* cir */
+	{ 8149, 255, 5, 3 }, /* xharr */
+	{ 8154, 2893, 4, 4 }, /* yopf */
+	{ 8158, 2897, 3, 3 }, /* Sup */
+	{ 8161, 2900, 8, 3 }, /* pointint */
+	{ 8169, 2426, 13, 3 }, /* RightTriangle */
+	{ 8182, 1824, 8, 3 }, /* dotminus */
+	{ 8190, 2755, 5, 3 }, /* radic */
+	{ 8195, 2903, 4, 2 }, /* ring */
+	{ 8199, 2905, 2, 2 }, /* pi */
+	{ 8201, 2907, 6, 3 }, /* marker */
+	{ 8207, 2910, 5, 3 }, /* operp */
+	{ 8212, 2913, 5, 3 }, /* boxVh */
+	{ 8217, 2682, 5, 3 }, /* lharu */
+	{ 8222, 2916, 3, 3 }, /* ord */
+	{ 8225, 2919, 8, 3 }, /* LessLess */
+	{ 8233, 2922, 13, 3 }, /* LeftVectorBar */
+	{ 8246, 1554, 2, 3 }, /* Im */
+	{ 8248, 1261, 4, 3 }, /* tdot */
+	{ 8252, 1108, 6, 3 }, /* larrhk */
+	{ 8258, 2925, 6, 6 }, /* nparsl */
+	{ 8264, 2931, 4, 2 }, /* tscy */
+	{ 8268, 2933, 4, 3 }, /* mlcp */
+	{ 8272, 2936, 6, 5 }, /* nrarrc */
+	{ 8278, 2941, 4, 2 }, /* auml */
+	{ 8282, 2943, 6, 2 }, /* kcedil */
+	{ 8288, 1993, 6, 3 }, /* zeetrf */
+	{ 8294, 2945, 5, 3 }, /* boxuL */
+	{ 8299, 2948, 5, 3 }, /* ovbar */
+	{ 8304, 2951, 8, 3 }, /* angmsdac */
+	{ 8312, 2954, 5, 5 }, /* npart */
+	{ 8317, 2643, 8, 3 }, /* setminus */
+	{ 8325, 2959, 5, 3 }, /* nsime */
+	{ 8330, 2962, 6, 3 }, /* lharul */
+	{ 8336, 1118, 7, 3 }, /* gtrless */
+	{ 8343, 2685, 5, 2 }, /* dblac */
+	{ 8348, 2965, 8, 3 }, /* geqslant */
+	{ 8356, 2116, 16, 3 }, /* LessEqualGreater */
+	{ 8372, 2968, 3, 4 }, /* nfr */
+	{ 8375, 2700, 12, 3 }, /* blacklozenge */
+	{ 8387, 2972, 4, 4 }, /* wopf */
+	{ 8391, 2976, 5, 2 }, /* gamma */
+	{ 8396, 2978, 6, 6 }, /* vsubnE */
+	{ 8402, 2984, 17, 5 }, /* NotSquareSuperset */
+	{ 8419, 2989, 9, 3 }, /* gtreqless */
+	{ 8428, 2992, 10, 3 }, /* UnderBrace */
+	{ 8438, 2995, 7, 3 }, /* pluscir */
+	{ 8445, 2998, 4, 4 }, /* sopf */
+	{ 8449, 311, 7, 3 }, /* lessgtr */
+	{ 8456, 2605, 6, 3 }, /* rmoust */
+	{ 8462, 3002, 4, 3 }, /* dHar */
+	{ 8466, 3005, 5, 2 }, /* omacr */
+	{ 8471, 3007, 6, 3 }, /* cupcup */
+	{ 8477, 3010, 9, 3 }, /* rationals */
+	{ 8486, 3013, 5, 3 }, /* gnsim */
+	{ 8491, 1736, 7, 3 }, /* natural */
+	{ 8498, 3016, 7, 3 }, /* boxplus */
+	{ 8505, 46, 6, 3 }, /* mnplus */
+	{ 8511, 3019, 3, 3 }, /* lgE */
+	{ 8514, 3022, 6, 2 }, /* Ecaron */
+	{ 8520, 3024, 4, 3 }, /* boxH */
+	{ 8524, 3027, 5, 2 }, /* pound */
+	{ 8529, 3029, 6, 3 }, /* lrhard */
+	{ 8535, 3032, 6, 2 }, /* Hstrok */
+	{ 8541, 3034, 5, 3 }, /* olcir */
+	{ 8546, 3037, 8, 3 }, /* laemptyv */
+	{ 8554, 3040, 6, 3 }, /* rharul */
+	{ 8560, 525, 5, 3 }, /* vltri */
+	{ 8565, 3043, 7, 3 }, /* dwangle */
+	{ 8572, 3046, 4, 3 }, /* bNot */
+	{ 8576, 3049, 15, 3 }, /* bigtriangledown */
+	{ 8591, 549, 10, 3 }, /* nleftarrow */
+	{ 8601, 2402, 7, 3 }, /* nwarrow */
+	{ 8608, 2305, 6, 3 }, /* plusdo */
+	{ 8614, 3052, 3, 3 }, /* Sub */
+	{ 8617, 971, 12, 3 }, /* NotLessEqual */
+	{ 8629, 451, 5, 3 }, /* bdquo */
+	{ 8634, 3055, 7, 3 }, /* rbrksld */
+	{ 8641, 2615, 9, 6 }, /* lvertneqq */
+	{ 8650, 3058, 4, 4 }, /* pscr */
+	{ 8654, 1651, 5, 3 }, /* clubs */
+	{ 8659, 3062, 6, 3 }, /* ulcorn */
+	{ 8665, 3065, 8, 3 }, /* Uarrocir */
+	{ 8673, 3068, 5, 3 }, /* loarr */
+	{ 8678, 3071, 6, 3 }, /* nsccue */
+	{ 8684, 2557, 7, 3 }, /* because */
+	{ 8691, 3074, 6, 2 }, /* Ccedil */
+	{ 8697, 573, 6, 3 }, /* ominus */
+	{ 8703, 3076, 9, 3 }, /* subsetneq */
+	{ 8712, 3079, 5, 2 }, /* iogon */
+	{ 8717, 258, 6, 3 }, /* eqcirc */
+	{ 8723, 3081, 5, 2 }, /* ucirc */
+	{ 8728, 3083, 6, 3 }, /* Verbar */
+	{ 8734, 3086, 6, 3 }, /* frac58 */
+	{ 8740, 3089, 7, 1 }, /* NewLine */
+	{ 8747, 516, 5, 3 }, /* asymp */
+	{ 8752, 3090, 3, 4 }, /* Xfr */
+	{ 8755, 367, 14, 3 }, /* OpenCurlyQuote */
+	{ 8769, 2965, 17, 3 }, /* GreaterSlantEqual */
+	{ 8786, 1285, 5, 3 }, /* order */
+	{ 8791, 373, 9, 3 }, /* heartsuit */
+	{ 8800, 3094, 6, 2 }, /* scedil */
+	{ 8806, 3096, 5, 3 }, /* boxdl */
+	{ 8811, 1420, 5, 3 }, /* angle */
+	{ 8816, 3099, 6, 3 }, /* midcir */
+	{ 8822, 3102, 5, 3 }, /* boxDl */
+	{ 8827, 3105, 6, 3 }, /* vangrt */
+	{ 8833, 2552, 11, 3 }, /* succnapprox */
+	{ 8844, 1954, 5, 3 }, /* TRADE */
+	{ 8849, 3108, 6, 2 }, /* curren */
+	{ 8855, 3110, 4, 4 }, /* nopf */
+	{ 8859, 3114, 14, 3 }, /* RightTeeVector */
+	{ 8873, 3117, 3, 3 }, /* nlt */
+	{ 8876, 3120, 3, 4 }, /* Pfr */
+	{ 8879, 3124, 5, 2 }, /* Aogon */
+	{ 8884, 439, 16, 3 }, /* ntrianglerighteq */
+	{ 8900, 576, 6, 3 }, /* there4 */
+	{ 8906, 3126, 6, 3 }, /* rfisht */
+	{ 8912, 3129, 4, 2 }, /* YIcy */
+	{ 8916, 3131, 6, 3 }, /* hybull */
+	{ 8922, 3134, 4, 3 }, /* ncap */
+	{ 8926, 3137, 16, 2 }, /* NonBreakingSpace */
+	{ 8942, 1205, 5, 3 }, /* sqsub */
+	{ 8947, 3139, 4, 3 }, /* ntgl */
+	{ 8951, 3142, 5, 2 }, /* theta */
+	{ 8956, 2566, 16, 2 }, /* DiacriticalTilde */
+	{ 8972, 3144, 6, 2 }, /* nacute */
+	{ 8978, 2116, 9, 3 }, /* lesseqgtr */
+	{ 8987, 3146, 6, 3 }, /* square */
+	{ 8993, 26, 4, 3 }, /* leqq */
+	{ 8997, 3149, 5, 3 }, /* seArr */
+	{ 9002, 3152, 5, 3 }, /* roang */
+	{ 9007, 3155, 4, 4 }, /* Nscr */
+	{ 9011, 1849, 15, 3 }, /* DoubleLeftArrow */
+	{ 9026, 2863, 7, 3 }, /* Product */
+	{ 9033, 3159, 6, 3 }, /* sqsupe */
+	{ 9039, 3162, 6, 2 }, /* ugrave */
+	{ 9045, 3164, 5, 3 }, /* uhblk */
+	{ 9050, 3167, 5, 3 }, /* boxVR */
+	{ 9055, 3170, 5, 3 }, /* boxvR */
+	{ 9060, 3173, 7, 3 }, /* cemptyv */
+	{ 9067, 3176, 6, 3 }, /* odsold */
+	{ 9073, 3179, 6, 3 }, /* permil */
+	{ 9079, 3182, 5, 3 }, /* cwint */
+	{ 9084, 3185, 3, 1 }, /* AMP */
+	{ 9087, 1946, 4, 5 }, /* npre */
+	{ 9091, 3186, 4, 2 }, /* ljcy */
+	{ 9095, 2959, 13, 3 }, /* NotTildeEqual */
+	{ 9108, 3188, 6, 3 }, /* capand */
+	{ 9114, 3191, 6, 3 }, /* nwarhk */
+	{ 9120, 1211, 12, 3 }, /* NotCongruent */
+	{ 9132, 3194, 4, 4 }, /* kopf */
+	{ 9136, 3198, 5, 3 }, /* rangd */
+	{ 9141, 3201, 16, 3 }, /* LeftUpDownVector */
+	{ 9157, 2036, 13, 3 }, /* NotTildeTilde */
+	{ 9170, 3204, 5, 3 }, /* boxHu */
+	{ 9175, 2748, 6, 3 }, /* planck */
+	{ 9181, 3207, 6, 3 }, /* rthree */
+	{ 9187, 400, 5, 3 }, /* scsim */
+	{ 9192, 760, 4, 3 }, /* spar */
+	{ 9196, 3052, 6, 3 }, /* Subset */
+	{ 9202, 2786, 6, 3 }, /* rarrhk */
+	{ 9208, 3210, 6, 2 }, /* Racute */
+	{ 9214, 3212, 6, 5 }, /* notinE */
+	{ 9220, 55, 4, 3 }, /* rArr */
+	{ 9224, 3217, 4, 4 }, /* aopf */
+	{ 9228, 2821, 6, 3 }, /* nesear */
+	{ 9234, 3221, 6, 3 }, /* Vdashl */
+	{ 9240, 2094, 14, 3 }, /* DoubleRightTee */
+	{ 9254, 1196, 6, 3 }, /* colone */
+	{ 9260, 378, 4, 3 }, /* sube */
+	{ 9264, 400, 13, 3 }, /* SucceedsTilde */
+	{ 9277, 2414, 18, 3 }, /* PrecedesSlantEqual */
+	{ 9295, 3224, 8, 3 }, /* otimesas */
+	{ 9303, 3227, 4, 3 }, /* cirE */
+	{ 9307, 3230, 7, 3 }, /* subplus */
+	{ 9314, 3233, 2, 3 }, /* Lt */
+	{ 9316, 3236, 3, 2 }, /* Lcy */
+	{ 9319, 3238, 5, 2 }, /* iukcy */
+	{ 9324, 2682, 10, 3 }, /* LeftVector */
+	{ 9334, 3240, 5, 2 }, /* scirc */
+	{ 9339, 3242, 5, 5 }, /* nedot */
+	{ 9344, 3146, 6, 3 }, /* Square */
+	{ 9350, 3247, 17, 3 }, /* VerticalSeparator */
+	{ 9367, 3250, 6, 2 }, /* eacute */
+	{ 9373, 3252, 6, 1 }, /* percnt */
+	{ 9379, 3253, 13, 3 }, /* RightUpVector */
+	{ 9392, 3256, 4, 3 }, /* dsol */
+	{ 9396, 3259, 5, 3 }, /* boxvh */
+	{ 9401, 3262, 6, 2 }, /* Itilde */
+	{ 9407, 3264, 3, 2 }, /* Bcy */
+	{ 9410, 3266, 8, 3 }, /* angmsdah */
+	{ 9418, 3269, 16, 3 }, /* rightrightarrows */
+	{ 9434, 3272, 6, 2 }, /* ubreve */
+	{ 9440, 3274, 6, 2 }, /* agrave */
+	{ 9446, 3276, 7, 3 }, /* LeftTee */
+	{ 9453, 3076, 5, 3 }, /* subne */
+	{ 9458, 3279, 7, 3 }, /* maltese */
+	{ 9465, 1779, 4, 3 }, /* hArr */
+	{ 9469, 78, 8, 3 }, /* hksearow */
+	{ 9477, 3146, 3, 3 }, /* squ */
+	{ 9480, 2292, 4, 2 }, /* copy */
+	{ 9484, 3282, 20, 3 }, /* EmptyVerySmallSquare */
+	{ 9504, 1022, 12, 3 }, /* HumpDownHump */
+	{ 9516, 2254, 9, 3 }, /* LessTilde */
+	{ 9525, 855, 4, 1 }, /* vert */
+	{ 9529, 3285, 4, 2 }, /* ZHcy */
+	{ 9533, 2748, 6, 3 }, /* plankv */
+	{ 9539, 3287, 7, 6 }, /* nsubset */
+	{ 9546, 2257, 4, 3 }, /* dash */
+	{ 9550, 1893, 2, 3 }, /* gE */
+	{ 9552, 3293, 4, 3 }, /* Fscr */
+	{ 9556, 311, 11, 3 }, /* LessGreater */
+	{ 9567, 3296, 4, 6 }, /* lesg */
+	{ 9571, 3117, 5, 3 }, /* nless */
+	{ 9576, 3302, 6, 2 }, /* Atilde */
+	{ 9582, 731, 5, 3 }, /* xrArr */
+	{ 9587, 3304, 8, 3 }, /* Succeeds */
+	{ 9595, 2323, 6, 2 }, /* plusmn */
+	{ 9601, 3307, 7, 3 }, /* supdsub */
+	{ 9608, 2372, 10, 3 }, /* upuparrows */
+	{ 9618, 3310, 5, 3 }, /* pluse */
+	{ 9623, 3313, 5, 2 }, /* oelig */
+	{ 9628, 3315, 5, 2 }, /* bepsi */
+	{ 9633, 3317, 5, 3 }, /* boxur */
+	{ 9638, 3320, 7, 3 }, /* angzarr */
+	{ 9645, 194, 5, 5 }, /* ngeqq */
+	{ 9650, 3323, 6, 2 }, /* Gammad */
+	{ 9656, 3325, 6, 3 }, /* timesb */
+	{ 9662, 3328, 6, 5 }, /* nrarrw */
+	{ 9668, 525, 12, 3 }, /* LeftTriangle */
+	{ 9680, 3333, 5, 2 }, /* Kappa */
+	{ 9685, 669, 19, 3 }, /* RightArrowLeftArrow */
+	{ 9704, 1805, 7, 3 }, /* asympeq */
+	{ 9711, 3137, 4, 2 }, /* nbsp */
+	{ 9715, 3335, 4, 2 }, /* yicy */
+	{ 9719, 2652, 5, 2 }, /* Aring */
+	{ 9724, 3337, 6, 2 }, /* ncaron */
+	{ 9730, 3339, 6, 3 }, /* nvlArr */
+	{ 9736, 2076, 4, 5 }, /* nsce */
+	{ 9740, 3342, 3, 3 }, /* Not */
+	{ 9743, 3345, 6, 2 }, /* Udblac */
+	{ 9749, 3347, 14, 3 }, /* curvearrowleft */
+	{ 9763, 940, 4, 3 }, /* Copf */
+	{ 9767, 3350, 3, 1 }, /* ast */
+	{ 9770, 3351, 8, 3 }, /* precneqq */
+	{ 9778, 1429, 8, 3 }, /* SuchThat */
+	{ 9786, 3354, 5, 3 }, /* range */
+	{ 9791, 3357, 8, 3 }, /* doteqdot */
+	{ 9799, 2402, 14, 3 }, /* UpperLeftArrow */
+	{ 9813, 3360, 6, 3 }, /* capdot */
+	{ 9819, 1041, 5, 5 }, /* nesim */
+	{ 9824, 3325, 8, 3 }, /* boxtimes */
+	{ 9832, 3363, 3, 2 }, /* Eta */
+	{ 9835, 3365, 6, 2 }, /* Lcedil */
+	{ 9841, 3367, 6, 3 }, /* subsim */
+	{ 9847, 3370, 4, 1 }, /* lpar */
+	{ 9851, 669, 15, 3 }, /* rightleftarrows */
+	{ 9866, 3371, 3, 4 }, /* xfr */
+	{ 9869, 3375, 4, 3 }, /* smte */
+	{ 9873, 3378, 5, 1 }, /* quest */
+	{ 9878, 3379, 4, 4 }, /* popf */
+	{ 9882, 3383, 6, 3 }, /* frac13 */
+	{ 9888, 3386, 3, 4 }, /* pfr */
+	{ 9891, 2169, 4, 3 }, /* xvee */
+	{ 9895, 893, 11, 3 }, /* updownarrow */
+	{ 9906, 3390, 4, 6 }, /* cups */
+	{ 9910, 763, 9, 3 }, /* LeftArrow */
+	{ 9919, 3396, 5, 3 }, /* udarr */
+	{ 9924, 2228, 8, 3 }, /* boxminus */
+	{ 9932, 1394, 7, 3 }, /* notniva */
+	{ 9939, 3399, 5, 2 }, /* Ubrcy */
+	{ 9944, 3401, 3, 2 }, /* ETH */
+	{ 9947, 3403, 7, 3 }, /* gtquest */
+	{ 9954, 1231, 15, 3 }, /* UpperRightArrow */
+	{ 9969, 3406, 4, 4 }, /* Kscr */
+	{ 9973, 356, 20, 3 }, /* OpenCurlyDoubleQuote */
+	{ 9993, 1898, 7, 3 }, /* OverBar */
+	{ 10000, 3410, 17, 3 }, /* NotTildeFullEqual */
+	{ 10017, 3413, 6, 3 }, /* roplus */
+	{ 10023, 3416, 6, 3 }, /* supsim */
+	{ 10029, 3419, 5, 3 }, /* dtdot */
+	{ 10034, 3422, 6, 2 }, /* Cacute */
+	{ 10040, 1295, 3, 3 }, /* Del */
+	{ 10043, 552, 4, 3 }, /* mldr */
+	{ 10047, 3424, 4, 2 }, /* djcy */
+	{ 10051, 3426, 7, 3 }, /* rotimes */
+	{ 10058, 3429, 5, 3 }, /* lsimg */
+	{ 10063, 2844, 2, 3 }, /* af */
+	{ 10065, 3432, 4, 2 }, /* dzcy */
+	{ 10069, 3434, 5, 2 }, /* Uogon */
+	{ 10074, 3276, 5, 3 }, /* dashv */
+	{ 10079, 2216, 3, 3 }, /* rsh */
+	{ 10082, 3436, 6, 3 }, /* frac16 */
+	{ 10088, 252, 6, 3 }, /* Barwed */
+	{ 10094, 3396, 16, 3 }, /* UpArrowDownArrow */
+	{ 10110, 1690, 7, 3 }, /* diamond */
+	{ 10117, 3439, 6, 3 }, /* subsub */
+	{ 10123, 3442, 4, 3 }, /* lnap */
+	{ 10127, 2703, 7, 3 }, /* ddagger */
+	{ 10134, 3445, 3, 4 }, /* Nfr */
+	{ 10137, 3449, 5, 2 }, /* Ccirc */
+	{ 10142, 751, 15, 3 }, /* CloseCurlyQuote */
+	{ 10157, 3451, 16, 5 }, /* NotSucceedsTilde */
+	{ 10173, 3456, 6, 2 }, /* Gbreve */
+	{ 10179, 3458, 7, 3 }, /* notnivb */
+	{ 10186, 3461, 5, 2 }, /* jmath */
+	{ 10191, 3463, 6, 2 }, /* Gcedil */
+	{ 10197, 3465, 4, 3 }, /* Iscr */
+	{ 10201, 3468, 6, 3 }, /* topbot */
+	{ 10207, 3471, 3, 2 }, /* mcy */
+	{ 10210, 3473, 6, 2 }, /* ograve */
+	{ 10216, 3475, 8, 3 }, /* elinters */
+	{ 10224, 3478, 4, 3 }, /* uHar */
+	{ 10228, 3481, 7, 3 }, /* minusdu */
+	{ 10235, 1881, 10, 3 }, /* lmoustache */
+	{ 10245, 1383, 8, 3 }, /* sqsupset */
+	{ 10253, 3484, 4, 2 }, /* KHcy */
+	{ 10257, 1121, 5, 3 }, /* gneqq */
+	{ 10262, 1349, 3, 3 }, /* and */
+	{ 10265, 3486, 4, 2 }, /* upsi */
+	{ 10269, 1972, 4, 1 }, /* rsqb */
+	{ 10273, 3488, 6, 3 }, /* wedgeq */
+	{ 10279, 3357, 4, 3 }, /* eDot */
+	{ 10283, 3491, 5, 2 }, /* ocirc */
+	{ 10288, 1938, 6, 3 }, /* bullet */
+	{ 10294, 3493, 5, 2 }, /* sigma */
+	{ 10299, 519, 13, 3 }, /* DoubleUpArrow */
+	{ 10312, 2728, 10, 3 }, /* lessapprox */
+	{ 10322, 3495, 7, 3 }, /* subedot */
+	{ 10329, 3498, 4, 4 }, /* vopf */
+	{ 10333, 3304, 4, 3 }, /* succ */
+	{ 10337, 3502, 4, 4 }, /* Pscr */
+	{ 10341, 3506, 4, 3 }, /* vArr */
+	{ 10345, 3465, 8, 3 }, /* imagline */
+	{ 10353, 3509, 4, 2 }, /* macr */
+	{ 10357, 3511, 7, 3 }, /* vzigzag */
+	{ 10364, 3514, 5, 3 }, /* nrarr */
+	{ 10369, 493, 8, 3 }, /* realpart */
+	{ 10377, 3442, 8, 3 }, /* lnapprox */
+	{ 10385, 953, 14, 3 }, /* LeftDownVector */
+	{ 10399, 2643, 5, 3 }, /* setmn */
+	{ 10404, 3517, 4, 3 }, /* opar */
+	{ 10408, 3520, 5, 3 }, /* ccaps */
+	{ 10413, 1967, 3, 3 }, /* gEl */
+	{ 10416, 943, 20, 3 }, /* NotLeftTriangleEqual */
+	{ 10436, 705, 8, 3 }, /* bigwedge */
+	{ 10444, 1849, 9, 3 }, /* Leftarrow */
+	{ 10453, 3523, 3, 4 }, /* Qfr */
+	{ 10456, 3527, 5, 3 }, /* ltcir */
+	{ 10461, 3530, 3, 3 }, /* rlm */
+	{ 10464, 3533, 7, 3 }, /* ltquest */
+	{ 10471, 901, 13, 3 }, /* leftarrowtail */
+	{ 10484, 3536, 3, 4 }, /* bne */
+	{ 10487, 3540, 4, 3 }, /* gnap */
+	{ 10491, 3185, 3, 1 }, /* amp */
+	{ 10494, 3543, 3, 2 }, /* rcy */
+	{ 10497, 3545, 5, 2 }, /* Imacr */
+	{ 10502, 1223, 5, 3 }, /* gtdot */
+	{ 10507, 3547, 4, 2 }, /* KJcy */
+	{ 10511, 2203, 4, 2 }, /* half */
+	{ 10515, 3549, 5, 3 }, /* boxDr */
+	{ 10520, 3552, 5, 3 }, /* crarr */
+	{ 10525, 3555, 3, 5 }, /* acE */
+	{ 10528, 3560, 5, 3 }, /* lrtri */
+	{ 10533, 1333, 12, 3 }, /* Intersection */
+	{ 10545, 52, 7, 3 }, /* notinva */
+	{ 10552, 1554, 3, 3 }, /* Ifr */
+	{ 10555, 3563, 4, 3 }, /* Popf */
+	{ 10559, 3566, 7, 3 }, /* lotimes */
+	{ 10566, 2002, 12, 3 }, /* LeftUpVector */
+	{ 10578, 3569, 5, 3 }, /* Prime */
+	{ 10583, 3572, 6, 2 }, /* Ccaron */
+	{ 10589, 1218, 14, 3 }, /* LongRightArrow */
+	{ 10603, 3062, 8, 3 }, /* ulcorner */
+	{ 10611, 3574, 3, 2 }, /* Gcy */
+	{ 10614, 3576, 6, 3 }, /* frac15 */
+	{ 10620, 1163, 15, 3 }, /* curvearrowright */
+	{ 10635, 1687, 3, 3 }, /* egs */
+	{ 10638, 3579, 5, 3 }, /* roarr */
+	{ 10643, 2441, 10, 3 }, /* RightFloor */
+	{ 10653, 3582, 4, 2 }, /* zhcy */
+	{ 10657, 3584, 3, 3 }, /* mho */
+	{ 10660, 3293, 10, 3 }, /* Fouriertrf */
+	{ 10670, 3016, 5, 3 }, /* plusb */
+	{ 10675, 1136, 9, 3 }, /* DownArrow */
+	{ 10684, 3587, 7, 3 }, /* questeq */
+	{ 10691, 1246, 10, 3 }, /* NotGreater */
+	{ 10701, 3590, 4, 1 }, /* plus */
+	{ 10705, 3591, 4, 4 }, /* Oscr */
+	{ 10709, 1999, 6, 3 }, /* weierp */
+	{ 10715, 2592, 9, 3 }, /* dotsquare */
+	{ 10724, 880, 18, 3 }, /* ReverseEquilibrium */
+	{ 10742, 3595, 4, 2 }, /* DJcy */
+	{ 10746, 3597, 9, 3 }, /* backprime */
+	{ 10755, 3600, 5, 3 }, /* ratio */
+	{ 10760, 2748, 4, 3 }, /* hbar */
+	{ 10764, 3603, 17, 3 }, /* twoheadrightarrow */
+	{ 10781, 3207, 15, 3 }, /* rightthreetimes */
+	{ 10796, 3606, 6, 2 }, /* Tstrok */
+	{ 10802, 1254, 3, 3 }, /* geq */
+	{ 10805, 3608, 3, 5 }, /* nLl */
+	{ 10808, 3613, 6, 3 }, /* hercon */
+	{ 10814, 3616, 6, 2 }, /* Rcaron */
+	{ 10820, 3315, 11, 2 }, /* backepsilon */
+	{ 10831, 2563, 5, 3 }, /* nprec */
+	{ 10836, 3618, 5, 2 }, /* Jcirc */
+	{ 10841, 0, 5, 3 }, /* ddarr */
+	{ 10846, 3620, 3, 2 }, /* Pcy */
+	{ 10849, 3622, 11, 3 }, /* nRightarrow */
+	{ 10860, 3287, 5, 6 }, /* vnsub */
+	{ 10865, 378, 8, 3 }, /* subseteq */
+	{ 10873, 3625, 3, 4 }, /* lfr */
+	{ 10876, 844, 3, 2 }, /* REG */
+	{ 10879, 3629, 5, 3 }, /* blank */
+	{ 10884, 1946, 7, 5 }, /* npreceq */
+	{ 10891, 2154, 7, 2 }, /* epsilon */
+	{ 10898, 3632, 3, 2 }, /* Zcy */
+	{ 10901, 1782, 15, 3 }, /* ShortRightArrow */
+	{ 10916, 2475, 15, 3 }, /* leftharpoondown */
+	{ 10931, 835, 9, 2 }, /* DoubleDot */
+	{ 10940, 3634, 8, 3 }, /* gesdotol */
+	{ 10948, 1196, 7, 3 }, /* coloneq */
+	{ 10955, 2563, 3, 3 }, /* npr */
+	{ 10958, 3637, 6, 2 }, /* udblac */
+	{ 10964, 3639, 4, 2 }, /* cent */
+	{ 10968, 3506, 11, 3 }, /* Updownarrow */
+	{ 10979, 1354, 6, 3 }, /* Exists */
+	{ 10985, 295, 4, 3 }, /* scnE */
+	{ 10989, 3641, 11, 3 }, /* RuleDelayed */
+	{ 11000, 3644, 4, 4 }, /* zscr */
+	{ 11004, 2128, 8, 3 }, /* leqslant */
+	{ 11012, 3648, 6, 2 }, /* dcaron */
+	{ 11018, 3650, 3, 2 }, /* Jcy */
+	{ 11021, 3652, 5, 2 }, /* Acirc */
+	{ 11026, 3654, 4, 4 }, /* yscr */
+	{ 11030, 3658, 5, 2 }, /* amacr */
+	{ 11035, 3660, 4, 3 }, /* ensp */
+	{ 11039, 3663, 5, 2 }, /* Scirc */
+	{ 11044, 290, 3, 2 }, /* dot */
+	{ 11047, 2297, 3, 3 }, /* lne */
+	{ 11050, 3083, 4, 3 }, /* Vert */
+	{ 11054, 3665, 15, 3 }, /* LeftUpVectorBar */
+	{ 11069, 3668, 6, 2 }, /* Lstrok */
+	{ 11075, 966, 21, 3 }, /* DoubleContourIntegral */
+	{ 11096, 3670, 4, 4 }, /* Wscr */
+	{ 11100, 3674, 5, 3 }, /* boxul */
+	{ 11105, 3677, 6, 2 }, /* rcedil */
+	{ 11111, 3679, 4, 2 }, /* Ouml */
+	{ 11115, 3681, 2, 2 }, /* Xi */
+	{ 11117, 555, 11, 3 }, /* circleddash */
+	{ 11128, 270, 14, 3 }, /* TildeFullEqual */
+	{ 11142, 1893, 4, 3 }, /* geqq */
+	{ 11146, 3683, 5, 3 }, /* boxvH */
+	{ 11151, 3686, 6, 3 }, /* frac78 */
+	{ 11157, 3689, 7, 3 }, /* lesdoto */
+	{ 11164, 1136, 14, 3 }, /* ShortDownArrow */
+	{ 11178, 3692, 4, 3 }, /* Barv */
+	{ 11182, 103, 6, 3 }, /* xoplus */
+	{ 11188, 493, 4, 3 }, /* real */
+	{ 11192, 1601, 6, 1 }, /* lowbar */
+	{ 11198, 3695, 8, 3 }, /* capbrcup */
+	{ 11206, 3698, 6, 3 }, /* cirmid */
+	{ 11212, 300, 3, 5 }, /* nlE */
+	{ 11215, 3701, 4, 4 }, /* nscr */
+	{ 11219, 2555, 8, 2 }, /* varkappa */
+	{ 11227, 3587, 6, 3 }, /* equest */
+	{ 11233, 3705, 6, 3 }, /* rangle */
+	{ 11239, 1218, 14, 3 }, /* longrightarrow */
+	{ 11253, 3708, 4, 3 }, /* Lang */
+	{ 11257, 3711, 3, 2 }, /* eta */
+	{ 11260, 3351, 4, 3 }, /* prnE */
+	{ 11264, 3713, 8, 3 }, /* scpolint */
+	{ 11272, 545, 7, 3 }, /* bigcirc */
+	{ 11279, 3716, 3, 4 }, /* Mfr */
+	{ 11282, 3720, 6, 3 }, /* seswar */
+	{ 11288, 3723, 10, 3 }, /* curlywedge */
+	{ 11298, 1932, 15, 3 }, /* NotGreaterTilde */
+	{ 11313, 3726, 7, 3 }, /* simplus */
+	{ 11320, 3729, 3, 4 }, /* Jfr */
+	{ 11323, 3733, 6, 2 }, /* jsercy */
+	{ 11329, 3735, 5, 3 }, /* lnsim */
+	{ 11334, 1193, 9, 3 }, /* pitchfork */
+	{ 11343, 711, 13, 3 }, /* blacktriangle */
+	{ 11356, 3738, 5, 3 }, /* boxHU */
+	{ 11361, 3741, 5, 2 }, /* emacr */
+	{ 11366, 2643, 6, 3 }, /* ssetmn */
+	{ 11372, 141, 8, 3 }, /* Superset */
+	{ 11380, 3743, 7, 2 }, /* Omicron */
+	{ 11387, 3745, 6, 2 }, /* gacute */
+	{ 11393, 3747, 5, 3 }, /* langd */
+	{ 11398, 3750, 5, 2 }, /* napos */
+	{ 11403, 3752, 6, 2 }, /* Aacute */
+	{ 11409, 1957, 5, 3 }, /* RBarr */
+	{ 11414, 3754, 5, 3 }, /* gsime */
+	{ 11419, 1008, 6, 3 }, /* larrlp */
+	{ 11425, 2656, 8, 3 }, /* succnsim */
+	{ 11433, 880, 5, 3 }, /* lrhar */
+	{ 11438, 2643, 9, 3 }, /* Backslash */
+	{ 11447, 3757, 5, 3 }, /* nlsim */
+	{ 11452, 2965, 3, 3 }, /* ges */
+	{ 11455, 922, 4, 3 }, /* supe */
+	{ 11459, 3233, 2, 3 }, /* ll */
+	{ 11461, 1679, 6, 2 }, /* thetav */
+	{ 11467, 3760, 4, 4 }, /* Gopf */
+	{ 11471, 1470, 8, 3 }, /* shortmid */
+	{ 11479, 3764, 4, 6 }, /* caps */
+	{ 11483, 1779, 3, 3 }, /* iff */
+	{ 11486, 2815, 5, 2 }, /* imath */
+	{ 11491, 3770, 4, 3 }, /* ltcc */
+	{ 11495, 3773, 7, 2 }, /* Epsilon */
+	{ 11502, 2166, 9, 3 }, /* backsimeq */
+	{ 11511, 3775, 5, 3 }, /* simlE */
+	{ 11516, 3778, 4, 3 }, /* Hopf */
+	{ 11520, 3781, 4, 3 }, /* cire */
+	{ 11524, 3784, 6, 3 }, /* andand */
+	{ 11530, 3787, 4, 3 }, /* boxh */
+	{ 11534, 3790, 6, 2 }, /* igrave */
+	{ 11540, 3253, 5, 3 }, /* uharr */
+	{ 11545, 3792, 4, 2 }, /* TScy */
+	{ 11549, 3794, 8, 3 }, /* rppolint */
+	{ 11557, 3797, 4, 4 }, /* Sscr */
+	{ 11561, 3287, 9, 6 }, /* NotSubset */
+	{ 11570, 3801, 5, 2 }, /* AElig */
+	{ 11575, 3803, 3, 2 }, /* psi */
+	{ 11578, 2989, 16, 3 }, /* GreaterEqualLess */
+	{ 11594, 1684, 5, 3 }, /* vdash */
+	{ 11599, 3787, 14, 3 }, /* HorizontalLine */
+	{ 11613, 3805, 6, 3 }, /* lowast */
+	{ 11619, 3808, 2, 3 }, /* DD */
+	{ 11621, 3811, 4, 4 }, /* ropf */
+	{ 11625, 464, 6, 3 }, /* gtrsim */
+	{ 11631, 141, 6, 3 }, /* supset */
+	{ 11637, 3815, 4, 4 }, /* zopf */
+	{ 11641, 623, 5, 3 }, /* rceil */
+	{ 11646, 3819, 4, 3 }, /* zwnj */
+	{ 11650, 3822, 7, 3 }, /* simrarr */
+	{ 11657, 3825, 6, 3 }, /* ltlarr */
+	{ 11663, 3828, 2, 3 }, /* Pr */
+	{ 11665, 175, 12, 3 }, /* HilbertSpace */
+	{ 11677, 3831, 7, 3 }, /* triplus */
+	{ 11684, 2169, 3, 3 }, /* Vee */
+	{ 11687, 3834, 6, 3 }, /* frac23 */
+	{ 11693, 3837, 4, 4 }, /* Xopf */
+	{ 11697, 3841, 4, 3 }, /* nisd */
+	{ 11701, 3350, 6, 1 }, /* midast */
+	{ 11707, 3844, 4, 3 }, /* utri */
+	{ 11711, 3847, 8, 3 }, /* raemptyv */
+	{ 11719, 474, 7, 3 }, /* ddotseq */
+	{ 11726, 3850, 3, 2 }, /* ucy */
+	{ 11729, 1470, 3, 3 }, /* mid */
+	{ 11732, 3852, 6, 3 }, /* emsp13 */
+	{ 11738, 2897, 6, 3 }, /* Supset */
+	{ 11744, 3855, 4, 4 }, /* Sopf */
+	{ 11748, 2978, 13, 6 }, /* varsubsetneqq */
+	{ 11761, 3859, 3, 2 }, /* Ecy */
+	{ 11764, 2459, 6, 3 }, /* sfrown */
+	{ 11770, 3861, 6, 3 }, /* telrec */
+	{ 11776, 2764, 5, 3 }, /* supne */
+	{ 11781, 3864, 7, 3 }, /* nvinfin */
+	{ 11788, 3867, 5, 3 }, /* blk14 */
+	{ 11793, 386, 4, 3 }, /* perp */
+	{ 11797, 3870, 5, 2 }, /* Gcirc */
+	{ 11802, 482, 6, 3 }, /* urcorn */
+	{ 11808, 3872, 5, 3 }, /* utdot */
+	{ 11813, 3875, 6, 3 }, /* barvee */
+	{ 11819, 3878, 4, 2 }, /* Iuml */
+	{ 11823, 3880, 7, 3 }, /* rdldhar */
+	{ 11830, 3269, 5, 3 }, /* rrarr */
+	{ 11835, 3883, 4, 2 }, /* yacy */
+	{ 11839, 3049, 5, 3 }, /* xdtri */
+	{ 11844, 3885, 6, 3 }, /* numero */
+	{ 11850, 3888, 8, 3 }, /* angrtvbd */
+	{ 11858, 1377, 5, 3 }, /* xodot */
+	{ 11863, 3603, 4, 3 }, /* Rarr */
+	{ 11867, 3891, 6, 2 }, /* Rcedil */
+	{ 11873, 3893, 4, 4 }, /* Topf */
+	{ 11877, 2002, 5, 3 }, /* uharl */
+	{ 11882, 887, 3, 3 }, /* lnE */
+	{ 11885, 3897, 5, 3 }, /* blk34 */
+	{ 11890, 3900, 4, 3 }, /* vBar */
+	{ 11894, 3903, 3, 3 }, /* gla */
+	{ 11897, 3906, 6, 2 }, /* frac34 */
+	{ 11903, 240, 3, 3 }, /* sim */
+	{ 11906, 1199, 14, 3 }, /* LeftRightArrow */
+	{ 11920, 3908, 5, 2 }, /* Ecirc */
+	{ 11925, 3910, 4, 4 }, /* bscr */
+	{ 11929, 3347, 6, 3 }, /* cularr */
+	{ 11935, 3914, 5, 2 }, /* ubrcy */
+	{ 11940, 3916, 4, 4 }, /* Aopf */
+	{ 11944, 3920, 6, 2 }, /* iacute */
+	{ 11950, 1990, 14, 3 }, /* NotLessGreater */
+	{ 11964, 389, 10, 3 }, /* Laplacetrf */
+	{ 11974, 3922, 5, 3 }, /* lopar */
+	{ 11979, 3925, 8, 5 }, /* ncongdot */
+	{ 11987, 3930, 8, 3 }, /* fpartint */
+	{ 11995, 3933, 4, 4 }, /* qscr */
+	{ 11999, 3757, 12, 3 }, /* NotLessTilde */
+	{ 12011, 3937, 5, 3 }, /* block */
+	{ 12016, 1878, 5, 3 }, /* nsupe */
+	{ 12021, 3940, 4, 3 }, /* star */
+	{ 12025, 1584, 13, 3 }, /* ntriangleleft */
+	{ 12038, 1160, 8, 3 }, /* naturals */
+	{ 12046, 3622, 5, 3 }, /* nrArr */
+	{ 12051, 3943, 6, 3 }, /* gesles */
+	{ 12057, 3946, 3, 2 }, /* yen */
+	{ 12060, 3948, 5, 3 }, /* hoarr */
+	{ 12065, 3951, 5, 3 }, /* boxdL */
+	{ 12070, 2989, 3, 3 }, /* gel */
+	{ 12073, 3540, 8, 3 }, /* gnapprox */
+	{ 12081, 760, 17, 3 }, /* DoubleVerticalBar */
+	{ 12098, 3954, 3, 3 }, /* ogt */
+	{ 12101, 922, 13, 3 }, /* SupersetEqual */
+	{ 12114, 3957, 5, 6 }, /* lates */
+	{ 12119, 2172, 15, 5 }, /* NotHumpDownHump */
+	{ 12134, 3509, 5, 2 }, /* strns */
+	{ 12139, 464, 4, 3 }, /* gsim */
+	{ 12143, 3778, 11, 3 }, /* quaternions */
+	{ 12154, 3963, 7, 3 }, /* intprod */
+	{ 12161, 1285, 7, 3 }, /* orderof */
+	{ 12168, 240, 8, 3 }, /* thicksim */
+	{ 12176, 3410, 5, 3 }, /* ncong */
+	{ 12181, 3966, 4, 4 }, /* Iopf */
+	{ 12185, 3970, 3, 2 }, /* jcy */
+	{ 12188, 3972, 5, 2 }, /* Delta */
+	{ 12193, 1386, 6, 2 }, /* divide */
+	{ 12199, 3974, 6, 3 }, /* dfisht */
+	{ 12205, 240, 5, 3 }, /* Tilde */
+	{ 12210, 3977, 4, 2 }, /* ouml */
+	{ 12214, 3979, 6, 2 }, /* Otilde */
+	{ 12220, 3981, 5, 3 }, /* boxHd */
+	{ 12225, 2608, 5, 3 }, /* searr */
+	{ 12230, 2506, 4, 3 }, /* prap */
+	{ 12234, 3984, 6, 3 }, /* Otimes */
+	{ 12240, 3253, 14, 3 }, /* upharpoonright */
+	{ 12254, 3987, 3, 2 }, /* tau */
+	{ 12257, 3989, 5, 3 }, /* swArr */
+	{ 12262, 3506, 17, 3 }, /* DoubleUpDownArrow */
+	{ 12279, 3992, 3, 3 }, /* ell */
+	{ 12282, 3995, 7, 3 }, /* NoBreak */
+	{ 12289, 3514, 11, 3 }, /* nrightarrow */
+	{ 12300, 3998, 6, 3 }, /* gtrarr */
+	{ 12306, 4001, 6, 2 }, /* Ograve */
+	{ 12312, 1202, 2, 3 }, /* ne */
+	{ 12314, 4003, 8, 3 }, /* lesdotor */
+	{ 12322, 4006, 4, 3 }, /* escr */
+	{ 12326, 693, 13, 6 }, /* varsupsetneqq */
+	{ 12339, 1475, 5, 3 }, /* mumap */
+	{ 12344, 1104, 5, 3 }, /* lAarr */
+	{ 12349, 4009, 5, 3 }, /* boxvr */
+	{ 12354, 4012, 4, 1 }, /* apos */
+	{ 12358, 1246, 4, 3 }, /* ngtr */
+	{ 12362, 4013, 5, 3 }, /* bsolb */
+	{ 12367, 1496, 11, 3 }, /* OverBracket */
+	{ 12378, 3723, 5, 3 }, /* cuwed */
+	{ 12383, 4016, 18, 3 }, /* RightDownVectorBar */
+	{ 12401, 4019, 5, 3 }, /* boxvl */
+	{ 12406, 4022, 2, 2 }, /* nu */
+	{ 12408, 4024, 5, 3 }, /* ultri */
+	{ 12413, 225, 20, 5 }, /* NotGreaterSlantEqual */
+	{ 12433, 337, 5, 1 }, /* grave */
+	{ 12438, 172, 9, 3 }, /* LeftFloor */
+	{ 12447, 4027, 3, 2 }, /* ENG */
+	{ 12450, 4029, 5, 2 }, /* Ucirc */
+	{ 12455, 1310, 5, 3 }, /* cuvee */
+	{ 12460, 4031, 4, 4 }, /* nvlt */
+	{ 12464, 2323, 9, 2 }, /* PlusMinus */
+	{ 12473, 4035, 4, 3 }, /* csub */
+	{ 12477, 2557, 7, 3 }, /* Because */
+	{ 12484, 4038, 5, 2 }, /* Uring */
+	{ 12489, 4040, 4, 4 }, /* mopf */
+	{ 12493, 1279, 5, 3 }, /* eqsim */
+	{ 12498, 4044, 4, 4 }, /* Zscr */
+	{ 12502, 4048, 3, 1 }, /* num */
+	{ 12505, 4049, 9, 2 }, /* DownBreve */
+	{ 12514, 4051, 3, 4 }, /* ffr */
+	{ 12517, 4055, 6, 2 }, /* lcedil */
+	{ 12523, 55, 16, 3 }, /* DoubleRightArrow */
+	{ 12539, 4057, 7, 3 }, /* submult */
+	{ 12546, 643, 4, 3 }, /* bsim */
+	{ 12550, 4060, 7, 3 }, /* luruhar */
+	{ 12557, 2783, 5, 3 }, /* esdot */
+	{ 12562, 810, 12, 3 }, /* DownTeeArrow */
+	{ 12574, 4063, 3, 2 }, /* tcy */
+	{ 12577, 4065, 7, 3 }, /* olcross */
+	{ 12584, 4068, 3, 5 }, /* nGg */
+	{ 12587, 4073, 4, 4 }, /* wscr */
+	{ 12591, 4077, 6, 2 }, /* Igrave */
+	{ 12597, 4079, 6, 3 }, /* vellip */
+	{ 12603, 4082, 4, 2 }, /* CHcy */
+	{ 12607, 4084, 4, 4 }, /* jopf */
+	{ 12611, 1147, 5, 3 }, /* sccue */
+	{ 12616, 398, 6, 2 }, /* sigmaf */
+	{ 12622, 4088, 4, 4 }, /* mscr */
+	{ 12626, 4092, 5, 3 }, /* neArr */
+	{ 12631, 1052, 2, 1 }, /* lt */
+	{ 12633, 4095, 4, 2 }, /* ordf */
+	{ 12637, 225, 4, 5 }, /* nges */
+	{ 12641, 1745, 6, 3 }, /* preceq */
+	{ 12647, 398, 6, 2 }, /* sigmav */
+	{ 12653, 4097, 3, 4 }, /* Wfr */
+	{ 12656, 1152, 8, 3 }, /* biguplus */
+	{ 12664, 3486, 7, 2 }, /* upsilon */
+	{ 12671, 4101, 19, 5 }, /* NotRightTriangleBar */
+	{ 12690, 2783, 5, 3 }, /* doteq */
+	{ 12695, 2804, 4, 3 }, /* supE */
+	{ 12699, 1096, 5, 3 }, /* llarr */
+	{ 12704, 4106, 7, 3 }, /* ruluhar */
+	{ 12711, 1383, 14, 3 }, /* SquareSuperset */
+	{ 12725, 4109, 3, 2 }, /* Vcy */
+	{ 12728, 4111, 4, 2 }, /* beta */
+	{ 12732, 4113, 4, 1 }, /* bsol */
+	{ 12736, 4114, 6, 3 }, /* nVDash */
+	{ 12742, 2421, 16, 3 }, /* NotRightTriangle */
+	{ 12758, 2240, 5, 3 }, /* starf */
+	{ 12763, 4117, 5, 3 }, /* lescc */
+	{ 12768, 4120, 4, 3 }, /* oror */
+	{ 12772, 436, 6, 3 }, /* langle */
+	{ 12778, 4123, 6, 2 }, /* yacute */
+	{ 12784, 4125, 6, 3 }, /* frac18 */
+	{ 12790, 4128, 4, 4 }, /* qopf */
+	{ 12794, 1619, 9, 3 }, /* Downarrow */
+	{ 12803, 2148, 8, 3 }, /* backcong */
+	{ 12811, 4132, 6, 2 }, /* softcy */
+	{ 12817, 3117, 7, 3 }, /* NotLess */
+	{ 12824, 2670, 5, 3 }, /* robrk */
+	{ 12829, 4134, 6, 2 }, /* frac14 */
+	{ 12835, 116, 9, 3 }, /* subseteqq */
+	{ 12844, 334, 5, 3 }, /* oplus */
+	{ 12849, 4136, 4, 4 }, /* Eopf */
+	{ 12853, 2015, 6, 3 }, /* coprod */
+	{ 12859, 4140, 3, 4 }, /* Kfr */
+	{ 12862, 4144, 4, 2 }, /* zeta */
+	{ 12866, 3844, 8, 3 }, /* triangle */
+	{ 12874, 4146, 3, 2 }, /* Ocy */
+	{ 12877, 813, 12, 6 }, /* varsubsetneq */
+	{ 12889, 1429, 14, 3 }, /* ReverseElement */
+	{ 12903, 4148, 3, 2 }, /* vcy */
+	{ 12906, 4150, 5, 2 }, /* Iogon */
+	{ 12911, 2223, 13, 3 }, /* bigtriangleup */
+	{ 12924, 2070, 5, 3 }, /* rlhar */
+	{ 12929, 3139, 14, 3 }, /* NotGreaterLess */
+	{ 12943, 4152, 5, 3 }, /* rbbrk */
+	{ 12948, 4155, 5, 2 }, /* TSHcy */
+	{ 12953, 848, 11, 3 }, /* NotSucceeds */
+	{ 12964, 1554, 8, 3 }, /* imagpart */
+	{ 12972, 4157, 3, 2 }, /* Tcy */
+	{ 12975, 2661, 9, 3 }, /* triangleq */
+	{ 12984, 3720, 4, 3 }, /* tosa */
+	{ 12988, 4159, 5, 3 }, /* gtcir */
+	{ 12993, 907, 4, 3 }, /* tint */
+	{ 12997, 1118, 2, 3 }, /* gl */
+	{ 12999, 2824, 11, 3 }, /* precnapprox */
+	{ 13010, 4162, 12, 3 }, /* RoundImplies */
+	{ 13022, 4165, 4, 2 }, /* NJcy */
+	{ 13026, 4167, 7, 6 }, /* nvltrie */
+	{ 13033, 1681, 19, 3 }, /* leftrightsquigarrow */
+	{ 13052, 4173, 3, 3 }, /* Cap */
+	{ 13055, 4176, 6, 2 }, /* Scedil */
+	{ 13061, 4178, 6, 2 }, /* gbreve */
+	{ 13067, 4180, 6, 2 }, /* egrave */
+	{ 13073, 1333, 4, 3 }, /* xcap */
+	{ 13077, 2869, 11, 3 }, /* SmallCircle */
+	{ 13088, 4182, 5, 3 }, /* cupor */
+	{ 13093, 2056, 31, 3 }, /* CounterClockwiseContourIntegral */
+	{ 13124, 4185, 5, 3 }, /* lsime */
+	{ 13129, 953, 5, 3 }, /* dharl */
+	{ 13134, 3705, 17, 3 }, /* RightAngleBracket */
+	{ 13151, 1878, 9, 3 }, /* nsupseteq */
+	{ 13160, 1782, 5, 3 }, /* srarr */
+	{ 13165, 2421, 5, 3 }, /* nrtri */
+	{ 13170, 4188, 4, 6 }, /* nvle */
+	{ 13174, 4194, 4, 4 }, /* Yscr */
+	{ 13178, 1279, 10, 3 }, /* EqualTilde */
+	{ 13188, 4198, 17, 3 }, /* LeftDownTeeVector */
+	{ 13205, 2799, 14, 3 }, /* looparrowright */
+	{ 13219, 4201, 7, 3 }, /* orslope */
+	{ 13226, 4204, 6, 2 }, /* Ugrave */
+	{ 13232, 3597, 6, 3 }, /* bprime */
+	{ 13238, 1457, 5, 3 }, /* lceil */
+	{ 13243, 4206, 6, 3 }, /* rarrpl */
+	{ 13249, 2535, 5, 3 }, /* supnE */
+	{ 13254, 4209, 4, 3 }, /* ldsh */
+	{ 13258, 1234, 8, 3 }, /* llcorner */
+	{ 13266, 3781, 6, 3 }, /* circeq */
+	{ 13272, 4212, 3, 3 }, /* Cup */
+	{ 13275, 4215, 8, 3 }, /* profalar */
+	{ 13283, 4218, 3, 2 }, /* chi */
+	{ 13286, 90, 2, 3 }, /* in */
+	{ 13288, 4220, 8, 3 }, /* eqvparsl */
+	{ 13296, 4223, 6, 2 }, /* odblac */
+	{ 13302, 1908, 12, 3 }, /* ExponentialE */
+	{ 13314, 4225, 17, 3 }, /* RightUpDownVector */
+	{ 13331, 4228, 5, 2 }, /* omega */
+	{ 13336, 4230, 5, 3 }, /* ofcir */
+	{ 13341, 2348, 4, 3 }, /* Larr */
+	{ 13345, 1394, 17, 3 }, /* NotReverseElement */
+	{ 13362, 2091, 5, 3 }, /* rhard */
+	{ 13367, 3304, 2, 3 }, /* sc */
+	{ 13369, 4233, 5, 2 }, /* Wcirc */
+	{ 13374, 4235, 7, 6 }, /* nvrtrie */
+	{ 13381, 3233, 14, 3 }, /* NestedLessLess */
+	{ 13395, 3705, 4, 3 }, /* rang */
+	{ 13399, 4241, 4, 4 }, /* Jopf */
+	{ 13403, 3563, 6, 3 }, /* primes */
+	{ 13409, 2205, 5, 3 }, /* rarrw */
+	{ 13414, 4245, 6, 3 }, /* origof */
+	{ 13420, 4248, 4, 3 }, /* odiv */
+	{ 13424, 4251, 5, 3 }, /* Vdash */
+	{ 13429, 4254, 8, 3 }, /* angmsdae */
+	{ 13437, 4257, 5, 3 }, /* VDash */
+	{ 13442, 4260, 13, 3 }, /* DifferentialD */
+	{ 13455, 4263, 4, 3 }, /* boxv */
+	{ 13459, 4266, 6, 2 }, /* Oslash */
+	{ 13465, 2414, 5, 3 }, /* prcue */
+	{ 13470, 1641, 5, 3 }, /* rBarr */
+	{ 13475, 4268, 5, 2 }, /* Hcirc */
+	{ 13480, 4270, 3, 4 }, /* jfr */
+	{ 13483, 4274, 3, 1 }, /* Hat */
+	{ 13486, 2387, 6, 2 }, /* middot */
+	{ 13492, 4275, 5, 2 }, /* Icirc */
+	{ 13497, 2237, 6, 3 }, /* phmmat */
+	{ 13503, 2213, 5, 3 }, /* rarrb */
+	{ 13508, 4277, 5, 3 }, /* boxuR */
+	{ 13513, 314, 4, 1 }, /* rcub */
+	{ 13517, 4280, 5, 2 }, /* aogon */
+	{ 13522, 4282, 4, 4 }, /* Dopf */
+	{ 13526, 992, 6, 3 }, /* rarrtl */
+	{ 13532, 4286, 3, 4 }, /* Afr */
+	{ 13535, 4290, 4, 5 }, /* race */
+	{ 13539, 1814, 3, 3 }, /* gap */
+	{ 13542, 4295, 3, 4 }, /* Tfr */
+	{ 13545, 4299, 5, 2 }, /* Jukcy */
+	{ 13550, 4301, 4, 4 }, /* Wopf */
+	{ 13554, 2208, 9, 3 }, /* spadesuit */
+	{ 13563, 4305, 6, 2 }, /* atilde */
+	{ 13569, 4260, 2, 3 }, /* dd */
+	{ 13571, 2959, 6, 3 }, /* nsimeq */
+	{ 13577, 3159, 10, 3 }, /* sqsupseteq */
+	{ 13587, 2033, 3, 3 }, /* vee */
+	{ 13590, 55, 10, 3 }, /* Rightarrow */
+	{ 13600, 4307, 6, 3 }, /* frac38 */
+	{ 13606, 835, 3, 2 }, /* uml */
+	{ 13609, 4310, 6, 3 }, /* emsp14 */
+	{ 13615, 4313, 6, 3 }, /* lAtail */
+	{ 13621, 1771, 4, 3 }, /* nsim */
+	{ 13625, 4316, 8, 3 }, /* lurdshar */
+	{ 13633, 3159, 19, 3 }, /* SquareSupersetEqual */
+	{ 13652, 4319, 6, 3 }, /* supsub */
+	{ 13658, 425, 2, 3 }, /* it */
+	{ 13660, 1665, 5, 3 }, /* diams */
+	{ 13665, 386, 3, 3 }, /* bot */
+	{ 13668, 3808, 20, 3 }, /* CapitalDifferentialD */
+	{ 13688, 52, 10, 3 }, /* NotElement */
+	{ 13698, 2036, 3, 3 }, /* nap */
+	{ 13701, 3279, 4, 3 }, /* malt */
+	{ 13705, 760, 8, 3 }, /* parallel */
+	{ 13713, 436, 16, 3 }, /* LeftAngleBracket */
+	{ 13729, 4322, 4, 4 }, /* tscr */
+	{ 13733, 763, 5, 3 }, /* slarr */
+	{ 13738, 2320, 4, 3 }, /* Zopf */
+	{ 13742, 4326, 7, 3 }, /* gesdoto */
+	{ 13749, 4329, 3, 3 }, /* prE */
+	{ 13752, 4332, 5, 3 }, /* boxVl */
+	{ 13757, 4335, 7, 3 }, /* quatint */
+	{ 13764, 3010, 4, 3 }, /* Qopf */
+	{ 13768, 4338, 13, 3 }, /* UpEquilibrium */
+	{ 13781, 600, 16, 3 }, /* downharpoonright */
+	{ 13797, 925, 3, 3 }, /* sum */
+	{ 13800, 2517, 14, 3 }, /* leftthreetimes */
+	{ 13814, 4341, 4, 3 }, /* Rang */
+	{ 13818, 3963, 5, 3 }, /* iprod */
+	{ 13823, 106, 5, 3 }, /* xlArr */
+	{ 13828, 4344, 15, 5 }, /* NotSquareSubset */
+	{ 13843, 4349, 2, 3 }, /* rx */
+	{ 13845, 2091, 15, 3 }, /* DownRightVector */
+	{ 13860, 4352, 5, 2 }, /* uogon */
+	{ 13865, 493, 2, 3 }, /* Re */
+	{ 13867, 389, 6, 3 }, /* lagran */
+	{ 13873, 4354, 4, 2 }, /* IEcy */
+	{ 13877, 135, 11, 3 }, /* curlyeqsucc */
+	{ 13888, 4356, 6, 3 }, /* llhard */
+	{ 13894, 4359, 18, 3 }, /* DownRightVectorBar */
+	{ 13912, 1541, 4, 5 }, /* nLtv */
+	{ 13916, 561, 11, 3 }, /* blacksquare */
+	{ 13927, 4362, 3, 3 }, /* And */
+	{ 13930, 868, 5, 5 }, /* nsupE */
+	{ 13935, 3071, 21, 3 }, /* NotSucceedsSlantEqual */
+	{ 13956, 4338, 5, 3 }, /* udhar */
+	{ 13961, 292, 7, 3 }, /* swarrow */
+	{ 13968, 2076, 16, 5 }, /* NotSucceedsEqual */
+	{ 13984, 4365, 4, 2 }, /* gjcy */
+	{ 13988, 4367, 5, 2 }, /* uring */
+	{ 13993, 4369, 5, 2 }, /* alpha */
+	{ 13998, 4371, 6, 3 }, /* urcrop */
+};
+
+static const char ENTITY_NAMES[] =
+	"downdownarrowsgscrbigsqcupduarroSoltlaquogammadZacuteSOFTcyLessF"
+	"ullEqualacyForAllifrapEiinfinaeligmpquotEacutenotinImpliessubPsi"
+	"tfrproptoDScyZeroWidthSpacetrianglerighteqsearhksmashpUnderBrack"
+	"etCircleDotElementKcyvarepsilontimesdLeftTeeArrowbigoplusLonglef"
+	"tarrowmfrFilledSmallSquaresubEszligRscrbethhstrokgtlParmeasureda"
+	"nglecuescmDDotsupGreaterGreaterrtrisdoteoastglEIJligointboxvLici"
+	"rcrpargtlfloorHscracdblacktriangleleftFcyPartialDLcaronffligNotG"
+	"reaterFullEqualAmacrsfriumlplustwoapidffllighomthtvpropgvnEngeqs"
+	"lantafrcylctyboxURthksimcirclearrowrightnsqsubesharpdoublebarwed"
+	"geLongLeftRightArrowecirvscrtcaronsubnEcongNotCupCapbumpenvgensu"
+	"bshyDiacriticalDotLowerLeftArrowsuccneqqitildenleqqboxhdeasterlg"
+	"rbracesup2DZcyRightDownTeeVectornVdashbbrktbrkprofsurfuarrCircle"
+	"PlusDiacriticalGravelparltnsubEnleftrightarrowiquesttimesscapldq"
+	"uoofrYfrlsquoDownRightTeeVectorheartscdotSubsetEqualpuncspordmbo"
+	"ttomLscrOverBraceBernoullisvarsigmasuccsimProportionalparslkappa"
+	"rtimesDarrblk12UpsiprgesdotInvisibleTimesCayleyswcirclrarrlangNo"
+	"tRightTriangleEquallozengeltrifharrcirimofldquorecolonsupdotisin"
+	"vKopfGreaterTildedopfldcaeDDotMediumSpacephivurcornercopysrLacut"
+	"eboxUlRfrMinusPlusbkarowsmeparslOacutecupcapboxhUrAarrboxVrTilde"
+	"TildeUparrowtridotvartriangleleftHARDcyscErarrfsangmsdcheckOopfU"
+	"acutexcircgtnlarrhellipodashduharsqufcapcuprbrkslutrianglelefteq"
+	"CircleMinusThereforeOcircotildefjligNotGreaterEqualuwangletritim"
+	"eHumpEqualdrcropQUOTboxDLRightDownVectorvsupnePoincareplanemcomm"
+	"awrEgravexotimeRightCeilingnmidltdotAcyrarrapzigrarrltribacksimn"
+	"leszfrIukcylbbrknotinvbintsimgErlarrLeftRightVectorotimesboxboxZ"
+	"etancedillcaronnearhkctdotvsupnEswarrSquareIntersectionangrtvbxw"
+	"edgertrifutrifSfrnotUbrevenvapngeqNestedGreaterGreaterDoubleLong"
+	"RightArrownGtngeflligdivonxGJcylrcornerrsquonsubseteqqsqcapsshor"
+	"tparallelShortLeftArrowscaronScboxVHuscrccaronNotExistsvfrwreath"
+	"commatiiLeftArrowBarphiLopfEfrtwixtangmsdabmapstodownvsubneNcyOv"
+	"erParenthesisRopfjukcyntildedeltaYUcyDotTHORNcwconintomicronregD"
+	"cynsuccBfrverbarEscrhscrRarrtlycircnsupseteqqUopfswarhkleftright"
+	"harpoonsYAcySacutelneqqcircledcircUpDownArrowcacuteleftrightarro"
+	"wstoplarrtlisinEiiintsceyfrvarrhonLeftrightarrowsupseteqSumClose"
+	"CurlyDoubleQuotezcyangmsdadRrightarrowJscrcomplexesnltriehcircma"
+	"pmapstoNtildedownharpoonleftgcircAlphaNegativeThinSpaceOfrLambda"
+	"ConintGammanleRightUpVectorBarkfriocyrarrbfssolbGturtrirightarro"
+	"wtailnshortparallelGghairspparauArrTauntrianglelefteqReverseUpEq"
+	"uilibriumleftarrowlooparrowleftPhileqOmacrMopfcircledRbumpcupdot"
+	"AgraveNotLeftTriangleBarmapstoupdalethNotEqualTildelesgesuplusLT"
+	"daggerggboxULisinsmapstoleftfrac25BscrLeftTeeVectoraacutesmilemo"
+	"delsjcirctriangleleftratailldrdharinfinprecsimDoubleLeftTeeNotSq"
+	"uareSupersetEqualleftleftarrowsnleqslantGTsolbarfnofLleftarrowlb"
+	"racehookleftarrowkjcyrtrielessdotncupimpedGreaterLessgnEdharrSuc"
+	"ceedsEquallobrktimesbarsmtesdownarrowcapcapzwjTcaronSucceedsSlan"
+	"tEqualHfrkcyxuplusfcyxhArrNopfcurarrNotHumpEqualgsimlnldrffiligo"
+	"opfscykscrnsupDownTeeforkAssignleftrightarrowNotEqualsqsubsetmal"
+	"eNotSquareSubsetEqualnequivlmidotBumpeqSHcyxrarrkhcygtrdotiecybs"
+	"eminearrdlcornlatxniscurlyeqprecngtboxDRdrcornkgreenGreaterEqual"
+	"LmidotzcaronTripleDotintlarhksbquolEgnsubseteqbarwedesimboxdRosc"
+	"rcfrlarrplnshortmidnablavarpidemptyvUmacrOdblaccupbrcapcurlyveeV"
+	"vdashbowtienLeftarrowNuumacrlarrfsAumlGdotbigcapNotSupersetsuphs"
+	"ubNegativeVeryThinSpaceVscrwedgeDiacriticalAcutesuccapproxexista"
+	"cutecudarrlNegativeThickSpaceemspDownArrowUpArrowChiomidveeeqawi"
+	"ntlarrgtccbigodotxsqcupcirfnintocirsqsupdivprnsimtrpeziumnotnicu"
+	"rarrmAscreldscynsparlesdotlrmrdcaoacuteangnsupsetcircledastsimdo"
+	"tveebarniIcyroparnangrsaquolcynsubeinfintieboxHDolarrpartepsivLe"
+	"ftCeilinggnesdotlBarrperiodVerticalBarBetamultimapDoubleLongLeft"
+	"ArrowScynharrbnotThinSpacetrisbboxhDKcedilrparcommatbrkcaroniiot"
+	"alongleftrightarrowLeftDownVectorBarUcyufishtforkvcsupRightVecto"
+	"rBarnGtvhorbarisinsvgimelcscrccircNotLessLessLeftTriangleBarTced"
+	"ilVbarimageCdotVfrgesccvarproptoLeftUpTeeVectornvgtemptyvinterca"
+	"lsimgeqcolongdotnltrinapidLJcynvrArrnscefremptysetUnderBarboxdrt"
+	"hkapNegativeMediumSpaceeogonPrecedesTildecudarrrloplusnvdashcula"
+	"rrpDoubleDownArrowogonhamiltCscrBopfnrtrieShortUpArrowdegchcynhp"
+	"arprecnsimdstrokdbkarowraquoohbargcyclubsuitrectsuplarrracutenda"
+	"shdiamondsuitPiUpTeecsupethickapproxfltnsUarrvarthetaconintharrw"
+	"RightTeeeqslantgtrDiamondVopfDcaroneqslantlessvarsupsetneqzdotfl"
+	"atOmegacapUscrXscrtprimeDownLeftRightVectorsolbigcupInvisibleCom"
+	"malongleftarrownaturplussimanddPrecedesEqualcirsciriiiintwfrsext"
+	"xcuprarrsimtrianglerightltimesPrecedescedilFilledVerySmallSquare"
+	"sup1NotTildeangsphzacuteDoubleLeftRightArrowrightarrowqfrOEligAb"
+	"reveccupssmNotNestedLessLessgfrCupCapnvsimgtrapproxnotindotEmacr"
+	"minusdsup3TscreparHaceknotinvcgvertneqqnvDashcirclearrowleftutil"
+	"deorarrLongLeftArrowsstarfThetalArrprecNotGreaterGreatertriminus"
+	"amalgwedbariexclnprcuemusupmultfopfminusNotSupersetEquallmoustpc"
+	"ylsqberDotccupsbumpeqGreaterFullEqualtshcyolinehopfupsihulcropex"
+	"ponentialedcycupNotVerticalBarfiligcircledSUnderParenthesissemiD"
+	"ownLeftVectorBarColonlbrkengsimswnwarbullnbumpefrac56DstrokNotPr"
+	"ecedesEqualsubdottradedrbkarowIOcyedotfrac45gtreqqlessNcedilrbra"
+	"ckrnmidlbrksludtriDoubleLongLeftRightArrowgeparUnionPlusiotaintc"
+	"alplusdulcubmstposntlgZfrEmptySmallSquarewpupharpoonleftohmvarrd"
+	"triflbarrlscrCoproductbemptyvnearrowrAtailVeryThinSpaceapltrParS"
+	"quareSubsetEqualharrlhblklarrbnparornapproxaringlHareopfgesllamb"
+	"daawconintUpsilonrcaronvarphirdquoProportionbbrkEdoticypreangmsd"
+	"agrightleftharpoonsldrusharnivnsucceqlbrackpertenkSHCHcysimeqNac"
+	"utevnsupblacktriangledownrightharpoondownvDashfscrIotalEexclfema"
+	"leLongrightarrowDotDotrarrnisnsqsupeangelegsupsupsubrarrlarrsimC"
+	"ontourIntegrallesapproxnpolintRightArrowlatesquarfDDotrahdUfrasc"
+	"rbcongandslopeepsisqcapClockwiseContourIntegralEogonlarrbfsRight"
+	"UpTeeVectorccedilbsimebigveerhovnbumpCedillaiscrYcygopfnLtLlsscr"
+	"Integralxlarrorvvarnothingfrac12rightsquigarrowspadesbcyRightArr"
+	"owBarRshsqsubecheckmarklsquorsucccurlyeqDscrxutricircdArrminusba"
+	"peNotSubsetEqualeplusMellintrfbigstarelsdotZcaronsupedotLshlesss"
+	"imhyphenloangUpArrowDfrtopfprimeemptyvBarvOrYacuteIacuteegsdotLo"
+	"ngleftrightarrowrealsfraslengCOPYEsimlneqMscrecircefDotdotplusph"
+	"oneuumlgljFopfhkswarowintegersltriepmxilltriprurelandvboxVetheca"
+	"ronrarrchardcytwoheadleftarrowThickSpaceshcybnequivlstrokYumlcon"
+	"gdotuuarrboxVLsimnelopfUtildeCenterDotRightTriangleEqualSquareUn"
+	"ionsubsetequivDDexpectationuopfalephnexistnwarrapacirsectuacuteS"
+	"tarrealinencypreccurlyeqlshbreveMuntrianglerightlacutevartriangl"
+	"erightdzigrarrrharutriangledownLeftTriangleEqualboxhupivdlcropCi"
+	"rcleTimesrfloorqprimeapproxeqforallrhoNotLessSlantEqualnexiststh"
+	"ereforeangmsdaanleqthornthetasymVerticalLinesmidBreveRhocrossfro"
+	"wnlongmapstoycyicufrLfrDownLeftVectordiameumlColonertriltriTilde"
+	"EqualSquareSubsetsimlequivfrac35gggEumlqintplusacirnvHarrssmileo"
+	"soleeprecapproxboxUrNotNestedGreaterGreaterlthreealefsymstraight"
+	"epsilonbfrleegtcedilbarwedgedfrImaginaryIWedgeecyEquilibriumsups"
+	"etneqqjscrUnionimacrQscrxmapcolonngEIntscnapkappavbecausRightTee"
+	"ArrowcomplementNotPrecedesRightVectortildeeuroGfrbopfsmtiopftopf"
+	"orkeparslrightharpoonupsdotbsucceqdollarisincompUpArrowBarblackt"
+	"rianglerightnotnivcodotangrtrmoustacheLowerRightArrowcopfDashvlv"
+	"nEoslashangmsdafcaretnwneardarrCrossGscrlozFfrsmallsetminusUpTee"
+	"ArrownsmiddscrYcircNotPrecedesSlantEqualfallingdotseqangstRcysub"
+	"setneqqscnsimSigmatrieijligrHarTabVerticalTildeRightDoubleBracke"
+	"trdquorbigotimesparsimxopfMcyleftharpoonupDiacriticalDoubleAcute"
+	"MaplfishtrisingdotseqtopcirlhardnparallelocythinspNcaronNotDoubl"
+	"eVerticalBardielozfDaggerLeftDoubleBracketnapErbrkeIdotlatailLes"
+	"sSlantEqualsubsupsqcupslaprdshhfrbetweenstraightphielscenterdotr"
+	"scrDownArrowBarCfrmdashhslashequalstargetSqrtplanckhincarenhArrg"
+	"neqsupsetneqZdotdisinnwArrxscrNotLeftTriangleJsercyScaronDotEqua"
+	"llsimhookrightarrowprsimlsaquomicroCongruentnlArrrsquorvrtrishch"
+	"cyrbarrproflinesqcuprarrlpUumluparrowsupseteqqbsolhsubbumpEsearr"
+	"owLeftArrowRightArrowabreveinodotLeftrightarrowrfractoeacueprprn"
+	"aptstroklbrksldpropsuphsolRightTriangleBarsupplusDownLeftTeeVect"
+	"ordigammaApplyFunctionyucysacutebrvbarcsubesungacircnjcyprodless"
+	"eqqgtrCconintcompfnisindotnumspyumlsimeEqualerarrbernoudivideont"
+	"imesYopfsqsubseteqcirxharryopfSuppointintRightTriangledotminusra"
+	"dicringpimarkeroperpboxVhlharuordLessLessLeftVectorBarImtdotlarr"
+	"hknparsltscymlcpnrarrcaumlkcedilzeetrfboxuLovbarangmsdacnpartset"
+	"minusnsimelharulgtrlessdblacgeqslantLessEqualGreaternfrblackloze"
+	"ngewopfgammavsubnENotSquareSupersetgtreqlessUnderBracepluscirsop"
+	"flessgtrrmoustdHaromacrcupcuprationalsgnsimnaturalboxplusmnplusl"
+	"gEEcaronboxHpoundlrhardHstrokolcirlaemptyvrharulvltridwanglebNot"
+	"bigtriangledownnleftarrownwarrowplusdoSubNotLessEqualbdquorbrksl"
+	"dlvertneqqpscrclubsulcornUarrocirloarrnsccuebecauseCcedilominuss"
+	"ubsetneqiogoneqcircucircVerbarfrac58NewLineasympXfrOpenCurlyQuot"
+	"eGreaterSlantEqualorderheartsuitscedilboxdlanglemidcirboxDlvangr"
+	"tsuccnapproxTRADEcurrennopfRightTeeVectornltPfrAogonntrianglerig"
+	"hteqthere4rfishtYIcyhybullncapNonBreakingSpacesqsubntglthetaDiac"
+	"riticalTildenacutelesseqgtrsquareleqqseArrroangNscrDoubleLeftArr"
+	"owProductsqsupeugraveuhblkboxVRboxvRcemptyvodsoldpermilcwintAMPn"
+	"preljcyNotTildeEqualcapandnwarhkNotCongruentkopfrangdLeftUpDownV"
+	"ectorNotTildeTildeboxHuplanckrthreescsimsparSubsetrarrhkRacuteno"
+	"tinErArraopfnesearVdashlDoubleRightTeecolonesubeSucceedsTildePre"
+	"cedesSlantEqualotimesascirEsubplusLtLcyiukcyLeftVectorscircnedot"
+	"SquareVerticalSeparatoreacutepercntRightUpVectordsolboxvhItildeB"
+	"cyangmsdahrightrightarrowsubreveagraveLeftTeesubnemaltesehArrhks"
+	"earowsqucopyEmptyVerySmallSquareHumpDownHumpLessTildevertZHcypla"
+	"nkvnsubsetdashgEFscrLessGreaterlesgnlessAtildexrArrSucceedsplusm"
+	"nsupdsubupuparrowspluseoeligbepsiboxurangzarrngeqqGammadtimesbnr"
+	"arrwLeftTriangleKappaRightArrowLeftArrowasympeqnbspyicyAringncar"
+	"onnvlArrnsceNotUdblaccurvearrowleftCopfastprecneqqSuchThatranged"
+	"oteqdotUpperLeftArrowcapdotnesimboxtimesEtaLcedilsubsimlparright"
+	"leftarrowsxfrsmtequestpopffrac13pfrxveeupdownarrowcupsLeftArrowu"
+	"darrboxminusnotnivaUbrcyETHgtquestUpperRightArrowKscrOpenCurlyDo"
+	"ubleQuoteOverBarNotTildeFullEqualroplussupsimdtdotCacuteDelmldrd"
+	"jcyrotimeslsimgafdzcyUogondashvrshfrac16BarwedUpArrowDownArrowdi"
+	"amondsubsublnapddaggerNfrCcircCloseCurlyQuoteNotSucceedsTildeGbr"
+	"evenotnivbjmathGcedilIscrtopbotmcyograveelintersuHarminusdulmous"
+	"tachesqsupsetKHcygneqqandupsirsqbwedgeqeDotocircbulletsigmaDoubl"
+	"eUpArrowlessapproxsubedotvopfsuccPscrvArrimaglinemacrvzigzagnrar"
+	"rrealpartlnapproxLeftDownVectorsetmnoparccapsgElNotLeftTriangleE"
+	"qualbigwedgeLeftarrowQfrltcirrlmltquestleftarrowtailbnegnapamprc"
+	"yImacrgtdotKJcyhalfboxDrcrarracElrtriIntersectionnotinvaIfrPopfl"
+	"otimesLeftUpVectorPrimeCcaronLongRightArrowulcornerGcyfrac15curv"
+	"earrowrightegsroarrRightFloorzhcymhoFouriertrfplusbDownArrowques"
+	"teqNotGreaterplusOscrweierpdotsquareReverseEquilibriumDJcybackpr"
+	"imeratiohbartwoheadrightarrowrightthreetimesTstrokgeqnLlherconRc"
+	"aronbackepsilonnprecJcircddarrPcynRightarrowvnsubsubseteqlfrREGb"
+	"lanknpreceqepsilonZcyShortRightArrowleftharpoondownDoubleDotgesd"
+	"otolcoloneqnprudblaccentUpdownarrowExistsscnERuleDelayedzscrleqs"
+	"lantdcaronJcyAcircyscramacrenspScircdotlneVertLeftUpVectorBarLst"
+	"rokDoubleContourIntegralWscrboxulrcedilOumlXicircleddashTildeFul"
+	"lEqualgeqqboxvHfrac78lesdotoShortDownArrowBarvxoplusreallowbarca"
+	"pbrcupcirmidnlEnscrvarkappaequestranglelongrightarrowLangetaprnE"
+	"scpolintbigcircMfrseswarcurlywedgeNotGreaterTildesimplusJfrjserc"
+	"ylnsimpitchforkblacktriangleboxHUemacrssetmnSupersetOmicrongacut"
+	"elangdnaposAacuteRBarrgsimelarrlpsuccnsimlrharBackslashnlsimgess"
+	"upellthetavGopfshortmidcapsiffimathltccEpsilonbacksimeqsimlEHopf"
+	"cireandandboxhigraveuharrTScyrppolintSscrNotSubsetAEligpsiGreate"
+	"rEqualLessvdashHorizontalLinelowastDDropfgtrsimsupsetzopfrceilzw"
+	"njsimrarrltlarrPrHilbertSpacetriplusVeefrac23Xopfnisdmidastutrir"
+	"aemptyvddotsequcymidemsp13SupsetSopfvarsubsetneqqEcysfrowntelrec"
+	"supnenvinfinblk14perpGcircurcornutdotbarveeIumlrdldharrrarryacyx"
+	"dtrinumeroangrtvbdxodotRarrRcedilTopfuharllnEblk34vBarglafrac34s"
+	"imLeftRightArrowEcircbscrcularrubrcyAopfiacuteNotLessGreaterLapl"
+	"acetrfloparncongdotfpartintqscrNotLessTildeblocknsupestarntriang"
+	"leleftnaturalsnrArrgeslesyenhoarrboxdLgelgnapproxDoubleVerticalB"
+	"arogtSupersetEquallatesNotHumpDownHumpstrnsgsimquaternionsintpro"
+	"dorderofthicksimncongIopfjcyDeltadividedfishtTildeoumlOtildeboxH"
+	"dsearrprapOtimesupharpoonrighttauswArrDoubleUpDownArrowellNoBrea"
+	"knrightarrowgtrarrOgravenelesdotorescrvarsupsetneqqmumaplAarrbox"
+	"vraposngtrbsolbOverBracketcuwedRightDownVectorBarboxvlnuultriNot"
+	"GreaterSlantEqualgraveLeftFloorENGUcirccuveenvltPlusMinuscsubBec"
+	"auseUringmopfeqsimZscrnumDownBreveffrlcedilDoubleRightArrowsubmu"
+	"ltbsimluruharesdotDownTeeArrowtcyolcrossnGgwscrIgravevellipCHcyj"
+	"opfsccuesigmafmscrneArrltordfngespreceqsigmavWfrbiguplusupsilonN"
+	"otRightTriangleBardoteqsupEllarrruluharSquareSupersetVcybetabsol"
+	"nVDashNotRightTrianglestarflesccororlangleyacutefrac18qopfDownar"
+	"rowbackcongsoftcyNotLessrobrkfrac14subseteqqoplusEopfcoprodKfrze"
+	"tatriangleOcyvarsubsetneqReverseElementvcyIogonbigtriangleuprlha"
+	"rNotGreaterLessrbbrkTSHcyNotSucceedsimagpartTcytriangleqtosagtci"
+	"rtintglprecnapproxRoundImpliesNJcynvltrieleftrightsquigarrowCapS"
+	"cedilgbreveegravexcapSmallCirclecuporCounterClockwiseContourInte"
+	"grallsimedharlRightAngleBracketnsupseteqsrarrnrtrinvleYscrEqualT"
+	"ildeLeftDownTeeVectorlooparrowrightorslopeUgravebprimelceilrarrp"
+	"lsupnEldshllcornercirceqCupprofalarchiineqvparslodblacExponentia"
+	"lERightUpDownVectoromegaofcirLarrNotReverseElementrhardscWcircnv"
+	"rtrieNestedLessLessrangJopfprimesrarrworigofodivVdashangmsdaeVDa"
+	"shDifferentialDboxvOslashprcuerBarrHcircjfrHatmiddotIcircphmmatr"
+	"arrbboxuRrcubaogonDopfrarrtlAfrracegapTfrJukcyWopfspadesuitatild"
+	"eddnsimeqsqsupseteqveeRightarrowfrac38umlemsp14lAtailnsimlurdsha"
+	"rSquareSupersetEqualsupsubitdiamsbotCapitalDifferentialDNotEleme"
+	"ntnapmaltparallelLeftAngleBrackettscrslarrZopfgesdotoprEboxVlqua"
+	"tintQopfUpEquilibriumdownharpoonrightsumleftthreetimesRangiprodx"
+	"lArrNotSquareSubsetrxDownRightVectoruogonRelagranIEcycurlyeqsucc"
+	"llhardDownRightVectorBarnLtvblacksquareAndnsupENotSucceedsSlantE"
+	"qualudharswarrowNotSucceedsEqualgjcyuringalphaurcrop"
+	;
+
+static const char ENTITY_VALUES[] =
+	"\xE2\x87\x8A\xE2\x84\x8A\xE2\xA8\x86\xE2\x87\xB5\xE2\x93\x88\xE2"
+	"\xA7\x80\xC2\xAB\xCF\x9D\xC5\xB9\xD0\xAC\xE2\x89\xA6\xD0\xB0\xE2"
+	"\x88\x80\xF0\x9D\x94\xA6\xE2\xA9\xB0\xE2\xA7\x9C\xC3\xA6\xE2\x88"
+	"\x93\x22\xC3\x89\xE2\x88\x89\xE2\x87\x92\xE2\x8A\x82\xCE\xA8\xF0"
+	"\x9D\x94\xB1\xE2\x88\x9D\xD0\x85\xE2\x80\x8B\xE2\x8A\xB5\xE2\xA4"
+	"\xA5\xE2\xA8\xB3\xE2\x8E\xB5\xE2\x8A\x99\xE2\x88\x88\xD0\x9A\xCF"
+	"\xB5\xE2\xA8\xB0\xE2\x86\xA4\xE2\xA8\x81\xE2\x9F\xB8\xF0\x9D\x94"
+	"\xAA\xE2\x97\xBC\xE2\xAB\x85\xC3\x9F\xE2\x84\x9B\xE2\x84\xB6\xC4"
+	"\xA7\xE2\xA6\x95\xE2\x88\xA1\xE2\x8B\x9F\xE2\x88\xBA\xE2\x8A\x83"
+	"\xE2\xAA\xA2\xE2\x96\xB9\xE2\xA9\xA6\xE2\x8A\x9B\xE2\xAA\x92\xC4"
+	"\xB2\xE2\x88\xAE\xE2\x95\xA1\xC3\xAE\xE2\xA6\x94\xE2\x8C\x8A\xE2"
+	"\x84\x8B\xE2\x88\xBF\xE2\x97\x82\xD0\xA4\xE2\x88\x82\xC4\xBD\xEF"
+	"\xAC\x80\xE2\x89\xA7\xCC\xB8\xC4\x80\xF0\x9D\x94\xB0\xC3\xAF\xE2"
+	"\xA8\xA7\xE2\x89\x8B\xEF\xAC\x84\xE2\x88\xBB\xE2\x89\xA9\xEF\xB8"
+	"\x80\xE2\xA9\xBE\xCC\xB8\xF0\x9D\x94\x9E\xE2\x8C\xAD\xE2\x95\x9A"
+	"\xE2\x88\xBC\xE2\x86\xBB\xE2\x8B\xA2\xE2\x99\xAF\xE2\x8C\x86\xE2"
+	"\x9F\xB7\xE2\x89\x96\xF0\x9D\x93\x8B\xC5\xA5\xE2\xAB\x8B\xE2\x89"
+	"\x85\xE2\x89\xAD\xE2\x89\x8F\xE2\x89\xA5\xE2\x83\x92\xE2\x8A\x84"
+	"\xC2\xAD\xCB\x99\xE2\x86\x99\xE2\xAA\xB6\xC4\xA9\xE2\x89\xA6\xCC"
+	"\xB8\xE2\x94\xAC\xE2\xA9\xAE\xE2\x89\xB6\x7D\xC2\xB2\xD0\x8F\xE2"
+	"\xA5\x9D\xE2\x8A\xAE\xE2\x8E\xB6\xE2\x8C\x93\xE2\x86\x91\xE2\x8A"
+	"\x95\x60\xE2\xA6\x93\xE2\xAB\x85\xCC\xB8\xE2\x86\xAE\xC2\xBF\xC3"
+	"\x97\xE2\xAA\xB8\xE2\x80\x9C\xF0\x9D\x94\xAC\xF0\x9D\x94\x9C\xE2"
+	"\x80\x98\xE2\xA5\x9F\xE2\x99\xA5\xC4\x8B\xE2\x8A\x86\xE2\x80\x88"
+	"\xC2\xBA\xE2\x8A\xA5\xE2\x84\x92\xE2\x8F\x9E\xE2\x84\xAC\xCF\x82"
+	"\xE2\x89\xBF\xE2\xAB\xBD\xCE\xBA\xE2\x8B\x8A\xE2\x86\xA1\xE2\x96"
+	"\x92\xCF\x92\xE2\x89\xBA\xE2\xAA\x80\xE2\x81\xA2\xE2\x84\xAD\xC5"
+	"\xB5\xE2\x87\x86\xE2\x9F\xA8\xE2\x8B\xAD\xE2\x97\x8A\xE2\xA5\x88"
+	"\xE2\x8A\xB7\xE2\x80\x9E\xE2\x89\x95\xE2\xAA\xBE\xF0\x9D\x95\x82"
+	"\xE2\x89\xB3\xF0\x9D\x95\x95\xE2\xA4\xB6\xE2\xA9\xB7\xE2\x81\x9F"
+	"\xCF\x95\xE2\x8C\x9D\xE2\x84\x97\xC4\xB9\xE2\x95\x9C\xE2\x84\x9C"
+	"\xE2\xA4\x8D\xE2\xA7\xA4\xC3\x93\xE2\xA9\x86\xE2\x95\xA8\xE2\x87"
+	"\x9B\xE2\x95\x9F\xE2\x89\x88\xE2\x87\x91\xE2\x97\xAC\xE2\x8A\xB2"
+	"\xD0\xAA\xE2\xAA\xB4\xE2\xA4\x9E\xE2\x9C\x93\xF0\x9D\x95\x86\xC3"
+	"\x9A\xE2\x97\xAF\x3E\xE2\x86\x9A\xE2\x80\xA6\xE2\x8A\x9D\xE2\xA5"
+	"\xAF\xE2\x96\xAA\xE2\xA9\x87\xE2\xA6\x90\xE2\x8A\xB4\xE2\x8A\x96"
+	"\xE2\x88\xB4\xC3\x94\xC3\xB5\x66\x6A\xE2\x89\xB1\xE2\xA6\xA7\xE2"
+	"\xA8\xBB\xE2\x8C\x8C\xE2\x95\x97\xE2\x87\x82\xE2\x8A\x8B\xEF\xB8"
+	"\x80\xE2\x84\x8C\xE2\xA8\xA9\xE2\x89\x80\xC3\x88\xE2\xA8\x82\xE2"
+	"\x8C\x89\xE2\x88\xA4\xE2\x8B\x96\xD0\x90\xE2\xA5\xB5\xE2\x87\x9D"
+	"\xE2\x97\x83\xE2\x88\xBD\xE2\xA9\xBD\xCC\xB8\xF0\x9D\x94\xB7\xD0"
+	"\x86\xE2\x9D\xB2\xE2\x8B\xB7\xE2\x88\xAB\xE2\xAA\xA0\xE2\x87\x84"
+	"\xE2\xA5\x8E\xE2\x8A\x97\xE2\xA7\x89\xCE\x96\xC5\x86\xC4\xBE\xE2"
+	"\xA4\xA4\xE2\x8B\xAF\xE2\xAB\x8C\xEF\xB8\x80\xE2\x8A\x93\xE2\x8A"
+	"\xBE\xE2\x8B\x80\xE2\x96\xB8\xE2\x96\xB4\xF0\x9D\x94\x96\xC2\xAC"
+	"\xC5\xAC\xE2\x89\x8D\xE2\x83\x92\xE2\x89\xAB\xE2\x9F\xB9\xE2\x89"
+	"\xAB\xE2\x83\x92\xEF\xAC\x82\xE2\x8B\x87\xD0\x83\xE2\x8C\x9F\xE2"
+	"\x80\x99\xE2\x8A\x93\xEF\xB8\x80\xE2\x88\xA5\xE2\x86\x90\xC5\xA1"
+	"\xE2\xAA\xBC\xE2\x95\xAC\xF0\x9D\x93\x8A\xC4\x8D\xE2\x88\x84\xF0"
+	"\x9D\x94\xB3\x40\xE2\x85\x88\xE2\x87\xA4\xCF\x86\xF0\x9D\x95\x83"
+	"\xF0\x9D\x94\x88\xE2\x89\xAC\xE2\xA6\xA9\xE2\x86\xA7\xE2\x8A\x8A"
+	"\xEF\xB8\x80\xD0\x9D\xE2\x8F\x9C\xE2\x84\x9D\xD1\x94\xC3\xB1\xCE"
+	"\xB4\xD0\xAE\xC2\xA8\xC3\x9E\xE2\x88\xB2\xCE\xBF\xC2\xAE\xD0\x94"
+	"\xE2\x8A\x81\xF0\x9D\x94\x85\x7C\xE2\x84\xB0\xF0\x9D\x92\xBD\xE2"
+	"\xA4\x96\xC5\xB7\xE2\xAB\x86\xCC\xB8\xF0\x9D\x95\x8C\xE2\xA4\xA6"
+	"\xE2\x87\x8B\xD0\xAF\xC5\x9A\xE2\x89\xA8\xE2\x8A\x9A\xE2\x86\x95"
+	"\xC4\x87\xE2\x8A\xA4\xE2\x86\xA2\xE2\x8B\xB9\xE2\x88\xAD\xE2\xAA"
+	"\xB0\xF0\x9D\x94\xB6\xCF\xB1\xE2\x87\x8E\xE2\x8A\x87\xE2\x88\x91"
+	"\xE2\x80\x9D\xD0\xB7\xE2\xA6\xAB\xF0\x9D\x92\xA5\xE2\x84\x82\xE2"
+	"\x8B\xAC\xC4\xA5\xE2\x86\xA6\xC3\x91\xE2\x87\x83\xC4\x9D\xCE\x91"
+	"\xF0\x9D\x94\x92\xCE\x9B\xE2\x88\xAF\xCE\x93\xE2\x89\xB0\xE2\xA5"
+	"\x94\xF0\x9D\x94\xA8\xD1\x91\xE2\xA4\xA0\xE2\xA7\x84\xE2\x97\xB9"
+	"\xE2\x86\xA3\xE2\x88\xA6\xE2\x8B\x99\xE2\x80\x8A\xC2\xB6\xCE\xA4"
+	"\xE2\x86\xAB\xCE\xA6\xE2\x89\xA4\xC5\x8C\xF0\x9D\x95\x84\xE2\x89"
+	"\x8E\xE2\x8A\x8D\xC3\x80\xE2\xA7\x8F\xCC\xB8\xE2\x86\xA5\xE2\x84"
+	"\xB8\xE2\x89\x82\xCC\xB8\xE2\xAA\x93\xE2\x8A\x8E\x3C\xE2\x80\xA0"
+	"\xE2\x95\x9D\xE2\x8B\xB4\xE2\x85\x96\xE2\xA5\x9A\xC3\xA1\xE2\x8C"
+	"\xA3\xE2\x8A\xA7\xC4\xB5\xE2\xA4\x9A\xE2\xA5\xA7\xE2\x88\x9E\xE2"
+	"\x89\xBE\xE2\xAB\xA4\xE2\x8B\xA3\xE2\x87\x87\xE2\x8C\xBF\xC6\x92"
+	"\xE2\x87\x9A\x7B\xE2\x86\xA9\xD1\x9C\xE2\xA9\x82\xC6\xB5\xE2\x89"
+	"\xB7\xE2\x89\xA9\xE2\x9F\xA6\xE2\xA8\xB1\xE2\xAA\xAC\xEF\xB8\x80"
+	"\xE2\x86\x93\xE2\xA9\x8B\xE2\x80\x8D\xC5\xA4\xE2\x89\xBD\xD0\xBA"
+	"\xE2\xA8\x84\xD1\x84\xE2\x9F\xBA\xE2\x84\x95\xE2\x86\xB7\xE2\x89"
+	"\x8F\xCC\xB8\xE2\xAA\x90\xE2\x80\xA5\xEF\xAC\x83\xF0\x9D\x95\xA0"
+	"\xD1\x81\xF0\x9D\x93\x80\xE2\x8A\x85\xE2\x8B\x94\xE2\x89\x94\xE2"
+	"\x86\x94\xE2\x89\xA0\xE2\x8A\x8F\xE2\x99\x82\xE2\x89\xA2\xC5\x80"
+	"\xD0\xA8\xE2\x9F\xB6\xD1\x85\xE2\x8B\x97\xD0\xB5\xE2\x81\x8F\xE2"
+	"\x86\x97\xE2\x8C\x9E\xE2\xAA\xAB\xE2\x8B\xBB\xE2\x8B\x9E\xE2\x89"
+	"\xAF\xE2\x95\x94\xC4\xB8\xE2\x89\xA5\xC4\xBF\xC5\xBE\xE2\x83\x9B"
+	"\xE2\xA8\x97\xE2\x80\x9A\xE2\xAA\x8B\xE2\x8A\x88\xE2\x8C\x85\xE2"
+	"\x89\x82\xE2\x95\x92\xE2\x84\xB4\xF0\x9D\x94\xA0\xE2\xA4\xB9\xE2"
+	"\x88\x87\xCF\x96\xE2\xA6\xB1\xC5\xAA\xC5\x90\xE2\xA9\x88\xE2\x8B"
+	"\x8E\xE2\x8A\xAA\xE2\x8B\x88\xE2\x87\x8D\xCE\x9D\xC5\xAB\xE2\xA4"
+	"\x9D\xC3\x84\xC4\xA0\xE2\x8B\x82\xE2\x8A\x83\xE2\x83\x92\xE2\xAB"
+	"\x97\xF0\x9D\x92\xB1\xE2\x88\xA7\xC2\xB4\xE2\x88\x83\xE2\xA4\xB8"
+	"\xE2\x80\x83\xCE\xA7\xE2\xA6\xB6\xE2\x89\x9A\xE2\xA8\x91\xE2\xAA"
+	"\xA7\xE2\xA8\x80\xE2\xA8\x90\xE2\x8A\x90\xC3\xB7\xE2\x8B\xA8\xE2"
+	"\x8F\xA2\xE2\x88\x8C\xE2\xA4\xBC\xF0\x9D\x92\x9C\xE2\xAA\x99\xD1"
+	"\x95\xE2\xA9\xBF\xE2\x80\x8E\xE2\xA4\xB7\xC3\xB3\xE2\x88\xA0\xE2"
+	"\xA9\xAA\xE2\x8A\xBB\xE2\x88\x8B\xD0\x98\xE2\xA6\x86\xE2\x88\xA0"
+	"\xE2\x83\x92\xE2\x80\xBA\xD0\xBB\xE2\xA7\x9D\xE2\x95\xA6\xE2\x86"
+	"\xBA\xE2\x8C\x88\xE2\xAA\x88\xE2\x8B\x85\xE2\xA4\x8E\x2E\xE2\x88"
+	"\xA3\xCE\x92\xE2\x8A\xB8\xD0\xA1\xE2\x8C\x90\xE2\x80\x89\xE2\xA7"
+	"\x8D\xE2\x95\xA5\xC4\xB6\x29\x2C\xE2\x8E\xB4\xCB\x87\xE2\x84\xA9"
+	"\xE2\xA5\x99\xD0\xA3\xE2\xA5\xBE\xE2\xAB\x99\xE2\xAB\x90\xE2\xA5"
+	"\x93\xE2\x89\xAB\xCC\xB8\xE2\x80\x95\xE2\x8B\xB3\xE2\x84\xB7\xF0"
+	"\x9D\x92\xB8\xC4\x89\xE2\x89\xAA\xCC\xB8\xE2\xA7\x8F\xC5\xA2\xE2"
+	"\xAB\xAB\xE2\x84\x91\xC4\x8A\xF0\x9D\x94\x99\xE2\xAA\xA9\xE2\xA5"
+	"\xA0\x3E\xE2\x83\x92\xE2\x88\x85\xE2\x8A\xBA\xE2\xAA\x9E\xC4\xA1"
+	"\xE2\x8B\xAA\xE2\x89\x8B\xCC\xB8\xD0\x89\xE2\xA4\x83\xF0\x9D\x94"
+	"\xA2\x5F\xE2\x94\x8C\xC4\x99\xE2\xA4\xB5\xE2\xA8\xAD\xE2\x8A\xAC"
+	"\xE2\xA4\xBD\xE2\x87\x93\xCB\x9B\xF0\x9D\x92\x9E\xF0\x9D\x94\xB9"
+	"\xC2\xB0\xD1\x87\xE2\xAB\xB2\xC4\x91\xE2\xA4\x8F\xC2\xBB\xE2\xA6"
+	"\xB5\xD0\xB3\xE2\x99\xA3\xE2\x96\xAD\xE2\xA5\xBB\xC5\x95\xE2\x80"
+	"\x93\xE2\x99\xA6\xCE\xA0\xE2\xAB\x92\xE2\x96\xB1\xE2\x86\x9F\xCF"
+	"\x91\xE2\x86\xAD\xE2\x8A\xA2\xE2\xAA\x96\xE2\x8B\x84\xF0\x9D\x95"
+	"\x8D\xC4\x8E\xE2\xAA\x95\xC5\xBC\xE2\x99\xAD\xCE\xA9\xE2\x88\xA9"
+	"\xF0\x9D\x92\xB0\xF0\x9D\x92\xB3\xE2\x80\xB4\xE2\xA5\x90\x2F\xE2"
+	"\x8B\x83\xE2\x81\xA3\xE2\x9F\xB5\xE2\x99\xAE\xE2\xA8\xA6\xE2\xA9"
+	"\x9C\xE2\xAA\xAF\xE2\xA7\x82\xE2\xA8\x8C\xF0\x9D\x94\xB4\xE2\x9C"
+	"\xB6\xE2\xA5\xB4\xE2\x8B\x89\xC2\xB8\xC2\xB9\xE2\x89\x81\xE2\x88"
+	"\xA2\xC5\xBA\xE2\x87\x94\xE2\x86\x92\xF0\x9D\x94\xAE\xC5\x92\xC4"
+	"\x82\xE2\xA9\x90\xE2\xAA\xA1\xCC\xB8\xF0\x9D\x94\xA4\xE2\x89\x8D"
+	"\xE2\x88\xBC\xE2\x83\x92\xE2\xAA\x86\xE2\x8B\xB5\xCC\xB8\xC4\x92"
+	"\xE2\x88\xB8\xC2\xB3\xF0\x9D\x92\xAF\xE2\x8B\x95\xE2\x8B\xB6\xE2"
+	"\x8A\xAD\xC5\xA9\xE2\x8B\x86\xCE\x98\xE2\x87\x90\xE2\xA8\xBA\xE2"
+	"\xA8\xBF\xE2\xA9\x9F\xC2\xA1\xE2\x8B\xA0\xCE\xBC\xE2\xAB\x82\xF0"
+	"\x9D\x95\x97\xE2\x88\x92\xE2\x8A\x89\xE2\x8E\xB0\xD0\xBF\x5B\xE2"
+	"\x89\x93\xE2\xA9\x8C\xE2\x89\xA7\xD1\x9B\xE2\x80\xBE\xF0\x9D\x95"
+	"\x99\xE2\x8C\x8F\xE2\x85\x87\xD0\xB4\xE2\x88\xAA\xEF\xAC\x81\xE2"
+	"\x8F\x9D\x3B\xE2\xA5\x96\xE2\x88\xB7\xE2\xA6\x8B\xE2\x89\xB5\xE2"
+	"\xA4\xAA\xE2\x80\xA2\xE2\x85\x9A\xC4\x90\xE2\xAA\xAF\xCC\xB8\xE2"
+	"\xAA\xBD\xE2\x84\xA2\xE2\xA4\x90\xD0\x81\xC4\x97\xE2\x85\x98\xE2"
+	"\xAA\x8C\xC5\x85\x5D\xE2\xAB\xAE\xE2\xA6\x8D\xE2\x96\xBF\xCE\xB9"
+	"\xE2\xA8\xA5\xE2\x88\xBE\xE2\x89\xB8\xE2\x84\xA8\xE2\x97\xBB\xE2"
+	"\x84\x98\xE2\x86\xBF\xE2\x96\xBE\xE2\xA4\x8C\xF0\x9D\x93\x81\xE2"
+	"\x88\x90\xE2\xA6\xB0\xE2\xA4\x9C\xE2\xA6\x96\xE2\x8A\x91\xE2\x96"
+	"\x84\xE2\x88\xA8\xE2\x89\x89\xC3\xA5\xE2\xA5\xA2\xF0\x9D\x95\x96"
+	"\xE2\x8B\x9B\xEF\xB8\x80\xCE\xBB\xE2\x88\xB3\xCE\xA5\xC5\x99\xC4"
+	"\x96\xD0\xB8\xE2\xA6\xAE\xE2\x87\x8C\xE2\xA5\x8B\xE2\xAA\xB0\xCC"
+	"\xB8\xE2\x80\xB1\xD0\xA9\xE2\x89\x83\xC5\x83\xE2\x87\x81\xE2\x8A"
+	"\xA8\xF0\x9D\x92\xBB\xCE\x99\x21\xE2\x99\x80\xE2\x83\x9C\xE2\x8B"
+	"\xBC\xE2\xA6\xA4\xE2\x8B\x9A\xE2\xAB\x96\xE2\xA5\xB9\xE2\xA5\xB3"
+	"\xE2\xA9\xBD\xE2\xA8\x94\xE2\xAA\xAD\xE2\xA4\x91\xF0\x9D\x94\x98"
+	"\xF0\x9D\x92\xB6\xE2\x89\x8C\xE2\xA9\x98\xCE\xB5\xC4\x98\xE2\xA4"
+	"\x9F\xE2\xA5\x9C\xC3\xA7\xE2\x8B\x8D\xE2\x8B\x81\xE2\x89\x8E\xCC"
+	"\xB8\xF0\x9D\x92\xBE\xD0\xAB\xF0\x9D\x95\x98\xE2\x89\xAA\xE2\x83"
+	"\x92\xE2\x8B\x98\xF0\x9D\x93\x88\xE2\xA9\x9B\xC2\xBD\xE2\x86\x9D"
+	"\xE2\x99\xA0\xD0\xB1\xE2\x87\xA5\xE2\x86\xB1\xF0\x9D\x92\x9F\xE2"
+	"\x96\xB3\xCB\x86\xE2\x8A\x9F\xE2\x89\x8A\xE2\xA9\xB1\xE2\x84\xB3"
+	"\xE2\x98\x85\xE2\xAA\x97\xC5\xBD\xE2\xAB\x84\xE2\x86\xB0\xE2\x89"
+	"\xB2\xE2\x80\x90\xE2\x9F\xAC\xF0\x9D\x94\x87\xF0\x9D\x95\xA5\xE2"
+	"\x80\xB2\xE2\xAB\xA9\xE2\xA9\x94\xC3\x9D\xC3\x8D\xE2\xAA\x98\xE2"
+	"\x81\x84\xC5\x8B\xC2\xA9\xE2\xA9\xB3\xE2\xAA\x87\xC3\xAA\xE2\x89"
+	"\x92\xE2\x88\x94\xE2\x98\x8E\xC3\xBC\xE2\xAA\xA4\xF0\x9D\x94\xBD"
+	"\xE2\x84\xA4\xC2\xB1\xCE\xBE\xE2\x97\xBA\xE2\x8A\xB0\xE2\xA9\x9A"
+	"\xE2\x95\x91\xC3\xB0\xC4\x9B\xE2\xA4\xB3\xD1\x8A\xE2\x86\x9E\xE2"
+	"\x81\x9F\xE2\x80\x8A\xD1\x88\xE2\x89\xA1\xE2\x83\xA5\xC5\x82\xC5"
+	"\xB8\xE2\xA9\xAD\xE2\x87\x88\xE2\x95\xA3\xE2\x89\x86\xF0\x9D\x95"
+	"\x9D\xC5\xA8\xC2\xB7\xE2\x8A\x94\xE2\xA9\xB8\xF0\x9D\x95\xA6\xE2"
+	"\x84\xB5\xE2\x86\x96\xE2\xA9\xAF\xC2\xA7\xC3\xBA\xD0\xBD\xE2\x89"
+	"\xBC\xCB\x98\xCE\x9C\xE2\x8B\xAB\xC4\xBA\xE2\x8A\xB3\xE2\x9F\xBF"
+	"\xE2\x87\x80\xE2\x94\xB4\xE2\x8C\x8D\xE2\x8C\x8B\xE2\x81\x97\xCF"
+	"\x81\xE2\xA6\xA8\xC3\xBE\xCE\xA1\xE2\x9C\x97\xE2\x8C\xA2\xE2\x9F"
+	"\xBC\xD1\x8B\xF0\x9D\x94\xB2\xF0\x9D\x94\x8F\xE2\x86\xBD\xC3\xAB"
+	"\xE2\xA9\xB4\xE2\xA7\x8E\xE2\xAA\x9D\xE2\x89\xA1\xE2\x85\x97\xC3"
+	"\x8B\xE2\xA8\xA3\xE2\xA4\x84\xE2\x8A\x98\xE2\xAA\xB7\xE2\x95\x99"
+	"\xE2\xAA\xA2\xCC\xB8\xE2\x8B\x8B\xF0\x9D\x94\x9F\xE2\xAA\x9A\xC5"
+	"\xA3\xF0\x9D\x94\xA1\xD1\x8D\xE2\xAB\x8C\xF0\x9D\x92\xBF\xC4\xAB"
+	"\xF0\x9D\x92\xAC\x3A\xE2\x88\xAC\xE2\xAA\xBA\xCF\xB0\xE2\x88\xB5"
+	"\xE2\x88\x81\xE2\x8A\x80\xCB\x9C\xE2\x82\xAC\xF0\x9D\x94\x8A\xF0"
+	"\x9D\x95\x93\xE2\xAA\xAA\xF0\x9D\x95\x9A\xE2\xAB\x9A\xE2\xA7\xA3"
+	"\xE2\x8A\xA1\x24\xE2\xA4\x92\xE2\x8B\xBD\xE2\x88\x9F\xE2\x8E\xB1"
+	"\xE2\x86\x98\xF0\x9D\x95\x94\xE2\x89\xA8\xEF\xB8\x80\xC3\xB8\xE2"
+	"\xA6\xAD\xE2\x81\x81\xE2\xA4\xA7\xE2\xA8\xAF\xF0\x9D\x92\xA2\xF0"
+	"\x9D\x94\x89\xE2\x88\x96\xF0\x9D\x92\xB9\xC5\xB6\xC3\x85\xD0\xA0"
+	"\xE2\x8B\xA9\xCE\xA3\xE2\x89\x9C\xC4\xB3\xE2\xA5\xA4\x09\xE2\x9F"
+	"\xA7\xE2\xAB\xB3\xF0\x9D\x95\xA9\xD0\x9C\xE2\x86\xBC\xCB\x9D\xE2"
+	"\xA4\x85\xE2\xA5\xBC\xE2\xAB\xB1\xD0\xBE\xC5\x87\xE2\xA7\xAB\xE2"
+	"\x80\xA1\xE2\xA9\xB0\xCC\xB8\xE2\xA6\x8C\xC4\xB0\xE2\xA4\x99\xE2"
+	"\xAB\x93\xE2\x8A\x94\xEF\xB8\x80\xE2\xAA\x85\xE2\x86\xB3\xF0\x9D"
+	"\x94\xA5\xF0\x9D\x93\x87\xE2\xA4\x93\xE2\x80\x94\xE2\x84\x8F\x3D"
+	"\xE2\x8C\x96\xE2\x88\x9A\xE2\x84\x8E\xE2\x84\x85\xE2\x8A\x8B\xC5"
+	"\xBB\xE2\x8B\xB2\xE2\x87\x96\xF0\x9D\x93\x8D\xD0\x88\xC5\xA0\xE2"
+	"\x89\x90\xE2\x86\xAA\xE2\x80\xB9\xC2\xB5\xD1\x89\xE2\x8C\x92\xE2"
+	"\x86\xAC\xC3\x9C\xE2\xAB\x86\xE2\x9F\x88\xE2\xAA\xAE\xC4\x83\xC4"
+	"\xB1\xF0\x9D\x94\xAF\xE2\xA4\xA8\xE2\xAA\xB9\xC5\xA7\xE2\xA6\x8F"
+	"\xE2\x9F\x89\xE2\xA7\x90\xE2\xAB\x80\xE2\xA5\x9E\xE2\x81\xA1\xD1"
+	"\x8E\xC5\x9B\xC2\xA6\xE2\xAB\x91\xE2\x99\xAA\xC3\xA2\xD1\x9A\xE2"
+	"\x88\x8F\xE2\x88\xB0\xE2\x88\x98\xE2\x8B\xB5\xE2\x80\x87\xC3\xBF"
+	"\xE2\xA9\xB5\xE2\xA5\xB1\xF0\x9D\x95\x90\xE2\x97\x8B\xF0\x9D\x95"
+	"\xAA\xE2\x8B\x91\xE2\xA8\x95\xCB\x9A\xCF\x80\xE2\x96\xAE\xE2\xA6"
+	"\xB9\xE2\x95\xAB\xE2\xA9\x9D\xE2\xAA\xA1\xE2\xA5\x92\xE2\xAB\xBD"
+	"\xE2\x83\xA5\xD1\x86\xE2\xAB\x9B\xE2\xA4\xB3\xCC\xB8\xC3\xA4\xC4"
+	"\xB7\xE2\x95\x9B\xE2\x8C\xBD\xE2\xA6\xAA\xE2\x88\x82\xCC\xB8\xE2"
+	"\x89\x84\xE2\xA5\xAA\xE2\xA9\xBE\xF0\x9D\x94\xAB\xF0\x9D\x95\xA8"
+	"\xCE\xB3\xE2\xAB\x8B\xEF\xB8\x80\xE2\x8A\x90\xCC\xB8\xE2\x8B\x9B"
+	"\xE2\x8F\x9F\xE2\xA8\xA2\xF0\x9D\x95\xA4\xE2\xA5\xA5\xC5\x8D\xE2"
+	"\xA9\x8A\xE2\x84\x9A\xE2\x8B\xA7\xE2\x8A\x9E\xE2\xAA\x91\xC4\x9A"
+	"\xE2\x95\x90\xC2\xA3\xE2\xA5\xAD\xC4\xA6\xE2\xA6\xBE\xE2\xA6\xB4"
+	"\xE2\xA5\xAC\xE2\xA6\xA6\xE2\xAB\xAD\xE2\x96\xBD\xE2\x8B\x90\xE2"
+	"\xA6\x8E\xF0\x9D\x93\x85\xE2\x8C\x9C\xE2\xA5\x89\xE2\x87\xBD\xE2"
+	"\x8B\xA1\xC3\x87\xE2\x8A\x8A\xC4\xAF\xC3\xBB\xE2\x80\x96\xE2\x85"
+	"\x9D\x0A\xF0\x9D\x94\x9B\xC5\x9F\xE2\x94\x90\xE2\xAB\xB0\xE2\x95"
+	"\x96\xE2\xA6\x9C\xC2\xA4\xF0\x9D\x95\x9F\xE2\xA5\x9B\xE2\x89\xAE"
+	"\xF0\x9D\x94\x93\xC4\x84\xE2\xA5\xBD\xD0\x87\xE2\x81\x83\xE2\xA9"
+	"\x83\xC2\xA0\xE2\x89\xB9\xCE\xB8\xC5\x84\xE2\x96\xA1\xE2\x87\x98"
+	"\xE2\x9F\xAD\xF0\x9D\x92\xA9\xE2\x8A\x92\xC3\xB9\xE2\x96\x80\xE2"
+	"\x95\xA0\xE2\x95\x9E\xE2\xA6\xB2\xE2\xA6\xBC\xE2\x80\xB0\xE2\x88"
+	"\xB1\x26\xD1\x99\xE2\xA9\x84\xE2\xA4\xA3\xF0\x9D\x95\x9C\xE2\xA6"
+	"\x92\xE2\xA5\x91\xE2\x95\xA7\xE2\x8B\x8C\xC5\x94\xE2\x8B\xB9\xCC"
+	"\xB8\xF0\x9D\x95\x92\xE2\xAB\xA6\xE2\xA8\xB6\xE2\xA7\x83\xE2\xAA"
+	"\xBF\xE2\x89\xAA\xD0\x9B\xD1\x96\xC5\x9D\xE2\x89\x90\xCC\xB8\xE2"
+	"\x9D\x98\xC3\xA9\x25\xE2\x86\xBE\xE2\xA7\xB6\xE2\x94\xBC\xC4\xA8"
+	"\xD0\x91\xE2\xA6\xAF\xE2\x87\x89\xC5\xAD\xC3\xA0\xE2\x8A\xA3\xE2"
+	"\x9C\xA0\xE2\x96\xAB\xD0\x96\xE2\x8A\x82\xE2\x83\x92\xE2\x84\xB1"
+	"\xE2\x8B\x9A\xEF\xB8\x80\xC3\x83\xE2\x89\xBB\xE2\xAB\x98\xE2\xA9"
+	"\xB2\xC5\x93\xCF\xB6\xE2\x94\x94\xE2\x8D\xBC\xCF\x9C\xE2\x8A\xA0"
+	"\xE2\x86\x9D\xCC\xB8\xCE\x9A\xD1\x97\xC5\x88\xE2\xA4\x82\xE2\xAB"
+	"\xAC\xC5\xB0\xE2\x86\xB6\x2A\xE2\xAA\xB5\xE2\xA6\xA5\xE2\x89\x91"
+	"\xE2\xA9\x80\xCE\x97\xC4\xBB\xE2\xAB\x87\x28\xF0\x9D\x94\xB5\xE2"
+	"\xAA\xAC\x3F\xF0\x9D\x95\xA1\xE2\x85\x93\xF0\x9D\x94\xAD\xE2\x88"
+	"\xAA\xEF\xB8\x80\xE2\x87\x85\xD0\x8E\xC3\x90\xE2\xA9\xBC\xF0\x9D"
+	"\x92\xA6\xE2\x89\x87\xE2\xA8\xAE\xE2\xAB\x88\xE2\x8B\xB1\xC4\x86"
+	"\xD1\x92\xE2\xA8\xB5\xE2\xAA\x8F\xD1\x9F\xC5\xB2\xE2\x85\x99\xE2"
+	"\xAB\x95\xE2\xAA\x89\xF0\x9D\x94\x91\xC4\x88\xE2\x89\xBF\xCC\xB8"
+	"\xC4\x9E\xE2\x8B\xBE\xC8\xB7\xC4\xA2\xE2\x84\x90\xE2\x8C\xB6\xD0"
+	"\xBC\xC3\xB2\xE2\x8F\xA7\xE2\xA5\xA3\xE2\xA8\xAA\xD0\xA5\xCF\x85"
+	"\xE2\x89\x99\xC3\xB4\xCF\x83\xE2\xAB\x83\xF0\x9D\x95\xA7\xF0\x9D"
+	"\x92\xAB\xE2\x87\x95\xC2\xAF\xE2\xA6\x9A\xE2\x86\x9B\xE2\xA6\xB7"
+	"\xE2\xA9\x8D\xF0\x9D\x94\x94\xE2\xA9\xB9\xE2\x80\x8F\xE2\xA9\xBB"
+	"\x3D\xE2\x83\xA5\xE2\xAA\x8A\xD1\x80\xC4\xAA\xD0\x8C\xE2\x95\x93"
+	"\xE2\x86\xB5\xE2\x88\xBE\xCC\xB3\xE2\x8A\xBF\xE2\x84\x99\xE2\xA8"
+	"\xB4\xE2\x80\xB3\xC4\x8C\xD0\x93\xE2\x85\x95\xE2\x87\xBE\xD0\xB6"
+	"\xE2\x84\xA7\xE2\x89\x9F\x2B\xF0\x9D\x92\xAA\xD0\x82\xE2\x80\xB5"
+	"\xE2\x88\xB6\xE2\x86\xA0\xC5\xA6\xE2\x8B\x98\xCC\xB8\xE2\x8A\xB9"
+	"\xC5\x98\xC4\xB4\xD0\x9F\xE2\x87\x8F\xF0\x9D\x94\xA9\xE2\x90\xA3"
+	"\xD0\x97\xE2\xAA\x84\xC5\xB1\xC2\xA2\xE2\xA7\xB4\xF0\x9D\x93\x8F"
+	"\xC4\x8F\xD0\x99\xC3\x82\xF0\x9D\x93\x8E\xC4\x81\xE2\x80\x82\xC5"
+	"\x9C\xE2\xA5\x98\xC5\x81\xF0\x9D\x92\xB2\xE2\x94\x98\xC5\x97\xC3"
+	"\x96\xCE\x9E\xE2\x95\xAA\xE2\x85\x9E\xE2\xAA\x81\xE2\xAB\xA7\xE2"
+	"\xA9\x89\xE2\xAB\xAF\xF0\x9D\x93\x83\xE2\x9F\xA9\xE2\x9F\xAA\xCE"
+	"\xB7\xE2\xA8\x93\xF0\x9D\x94\x90\xE2\xA4\xA9\xE2\x8B\x8F\xE2\xA8"
+	"\xA4\xF0\x9D\x94\x8D\xD1\x98\xE2\x8B\xA6\xE2\x95\xA9\xC4\x93\xCE"
+	"\x9F\xC7\xB5\xE2\xA6\x91\xC5\x89\xC3\x81\xE2\xAA\x8E\xE2\x89\xB4"
+	"\xF0\x9D\x94\xBE\xE2\x88\xA9\xEF\xB8\x80\xE2\xAA\xA6\xCE\x95\xE2"
+	"\xAA\x9F\xE2\x84\x8D\xE2\x89\x97\xE2\xA9\x95\xE2\x94\x80\xC3\xAC"
+	"\xD0\xA6\xE2\xA8\x92\xF0\x9D\x92\xAE\xC3\x86\xCF\x88\xE2\x88\x97"
+	"\xE2\x85\x85\xF0\x9D\x95\xA3\xF0\x9D\x95\xAB\xE2\x80\x8C\xE2\xA5"
+	"\xB2\xE2\xA5\xB6\xE2\xAA\xBB\xE2\xA8\xB9\xE2\x85\x94\xF0\x9D\x95"
+	"\x8F\xE2\x8B\xBA\xE2\x96\xB5\xE2\xA6\xB3\xD1\x83\xE2\x80\x84\xF0"
+	"\x9D\x95\x8A\xD0\xAD\xE2\x8C\x95\xE2\xA7\x9E\xE2\x96\x91\xC4\x9C"
+	"\xE2\x8B\xB0\xE2\x8A\xBD\xC3\x8F\xE2\xA5\xA9\xD1\x8F\xE2\x84\x96"
+	"\xE2\xA6\x9D\xC5\x96\xF0\x9D\x95\x8B\xE2\x96\x93\xE2\xAB\xA8\xE2"
+	"\xAA\xA5\xC2\xBE\xC3\x8A\xF0\x9D\x92\xB7\xD1\x9E\xF0\x9D\x94\xB8"
+	"\xC3\xAD\xE2\xA6\x85\xE2\xA9\xAD\xCC\xB8\xE2\xA8\x8D\xF0\x9D\x93"
+	"\x86\xE2\x96\x88\xE2\x98\x86\xE2\xAA\x94\xC2\xA5\xE2\x87\xBF\xE2"
+	"\x95\x95\xE2\xA7\x81\xE2\xAA\xAD\xEF\xB8\x80\xE2\xA8\xBC\xF0\x9D"
+	"\x95\x80\xD0\xB9\xCE\x94\xE2\xA5\xBF\xC3\xB6\xC3\x95\xE2\x95\xA4"
+	"\xE2\xA8\xB7\xCF\x84\xE2\x87\x99\xE2\x84\x93\xE2\x81\xA0\xE2\xA5"
+	"\xB8\xC3\x92\xE2\xAA\x83\xE2\x84\xAF\xE2\x94\x9C\x27\xE2\xA7\x85"
+	"\xE2\xA5\x95\xE2\x94\xA4\xCE\xBD\xE2\x97\xB8\xC5\x8A\xC3\x9B\x3C"
+	"\xE2\x83\x92\xE2\xAB\x8F\xC5\xAE\xF0\x9D\x95\x9E\xF0\x9D\x92\xB5"
+	"\x23\xCC\x91\xF0\x9D\x94\xA3\xC4\xBC\xE2\xAB\x81\xE2\xA5\xA6\xD1"
+	"\x82\xE2\xA6\xBB\xE2\x8B\x99\xCC\xB8\xF0\x9D\x93\x8C\xC3\x8C\xE2"
+	"\x8B\xAE\xD0\xA7\xF0\x9D\x95\x9B\xF0\x9D\x93\x82\xE2\x87\x97\xC2"
+	"\xAA\xF0\x9D\x94\x9A\xE2\xA7\x90\xCC\xB8\xE2\xA5\xA8\xD0\x92\xCE"
+	"\xB2\x5C\xE2\x8A\xAF\xE2\xAA\xA8\xE2\xA9\x96\xC3\xBD\xE2\x85\x9B"
+	"\xF0\x9D\x95\xA2\xD1\x8C\xC2\xBC\xF0\x9D\x94\xBC\xF0\x9D\x94\x8E"
+	"\xCE\xB6\xD0\x9E\xD0\xB2\xC4\xAE\xE2\x9D\xB3\xD0\x8B\xD0\xA2\xE2"
+	"\xA9\xBA\xE2\xA5\xB0\xD0\x8A\xE2\x8A\xB4\xE2\x83\x92\xE2\x8B\x92"
+	"\xC5\x9E\xC4\x9F\xC3\xA8\xE2\xA9\x85\xE2\xAA\x8D\xE2\x89\xA4\xE2"
+	"\x83\x92\xF0\x9D\x92\xB4\xE2\xA5\xA1\xE2\xA9\x97\xC3\x99\xE2\xA5"
+	"\x85\xE2\x86\xB2\xE2\x8B\x93\xE2\x8C\xAE\xCF\x87\xE2\xA7\xA5\xC5"
+	"\x91\xE2\xA5\x8F\xCF\x89\xE2\xA6\xBF\xC5\xB4\xE2\x8A\xB5\xE2\x83"
+	"\x92\xF0\x9D\x95\x81\xE2\x8A\xB6\xE2\xA8\xB8\xE2\x8A\xA9\xE2\xA6"
+	"\xAC\xE2\x8A\xAB\xE2\x85\x86\xE2\x94\x82\xC3\x98\xC4\xA4\xF0\x9D"
+	"\x94\xA7\x5E\xC3\x8E\xE2\x95\x98\xC4\x85\xF0\x9D\x94\xBB\xF0\x9D"
+	"\x94\x84\xE2\x88\xBD\xCC\xB1\xF0\x9D\x94\x97\xD0\x84\xF0\x9D\x95"
+	"\x8E\xC3\xA3\xE2\x85\x9C\xE2\x80\x85\xE2\xA4\x9B\xE2\xA5\x8A\xE2"
+	"\xAB\x94\xF0\x9D\x93\x89\xE2\xAA\x82\xE2\xAA\xB3\xE2\x95\xA2\xE2"
+	"\xA8\x96\xE2\xA5\xAE\xE2\x9F\xAB\xE2\x8A\x8F\xCC\xB8\xE2\x84\x9E"
+	"\xC5\xB3\xD0\x95\xE2\xA5\xAB\xE2\xA5\x97\xE2\xA9\x93\xD1\x93\xC5"
+	"\xAF\xCE\xB1\xE2\x8C\x8E"
+	;
+
+#endif /* entities_table_h */
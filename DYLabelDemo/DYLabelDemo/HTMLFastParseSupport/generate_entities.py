@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+#
+#  generate_entities.py
+#  HTMLFastParse
+#
+#  Generates entities_table.h, a minimal perfect hash over every HTML5 named character reference.
+#  The entity list comes from Python's html.entities.html5 (which mirrors https://html.spec.whatwg.org/entities.json).
+#  Run this again to pick up a newer list: python3 generate_entities.py > entities_table.h
+#
+
+from html.entities import html5
+
+# Entities per bucket in the first level of the hash. Lower is faster to generate, higher is smaller
+BUCKET_SIZE = 4
+
+
+def entity_hash(name, seed):
+    # 32 bit FNV-1a with the seed mixed into the offset basis. Must match entityHash in entities.c
+    value = (2166136261 ^ seed) & 0xFFFFFFFF
+    for byte in name:
+        value ^= byte
+        value = (value * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def build_table(names):
+    table_size = len(names)
+    bucket_count = (len(names) + BUCKET_SIZE - 1) // BUCKET_SIZE
+    buckets = [[] for _ in range(bucket_count)]
+    for name in names:
+        buckets[entity_hash(name, 0) % bucket_count].append(name)
+
+    slots = [None] * table_size
+    displacements = [0] * bucket_count
+    # Place the fullest buckets first while there's still lots of room
+    for index in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        bucket = buckets[index]
+        if not bucket:
+            continue
+        displacement = 1
+        while True:
+            candidate = [entity_hash(name, displacement) % table_size for name in bucket]
+            if len(set(candidate)) == len(candidate) and all(slots[slot] is None for slot in candidate):
+                break
+            displacement += 1
+        displacements[index] = displacement
+        for name, slot in zip(bucket, candidate):
+            slots[slot] = name
+    return slots, displacements
+
+
+def c_string(data):
+    return "".join("\\x%02X" % byte for byte in data)
+
+
+def main():
+    entities = {}
+    for name, value in html5.items():
+        # Only the terminated forms, the tokenizer always requires the ';'
+        if name.endswith(";"):
+            entities[name[:-1].encode("ascii")] = value.encode("utf-8")
+
+    names = sorted(entities)
+    slots, displacements = build_table(names)
+
+    name_pool = bytearray()
+    value_pool = bytearray()
+    value_offsets = {}
+    rows = []
+    for name in slots:
+        value = entities[name]
+        if value not in value_offsets:
+            value_offsets[value] = len(value_pool)
+            value_pool += value
+        rows.append((len(name_pool), len(name), value_offsets[value], len(value), name))
+        name_pool += name
+
+    print("//")
+    print("//  entities_table.h")
+    print("//  HTMLFastParse")
+    print("//")
+    print("//  GENERATED BY generate_entities.py, DO NOT EDIT")
+    print("//  %d HTML5 named character references" % len(names))
+    print("//")
+    print()
+    print("#ifndef entities_table_h")
+    print("#define entities_table_h")
+    print()
+    print("#include <stdint.h>")
+    print()
+    print("//Longest entity name (without the '&' and ';')")
+    print("#define ENTITY_NAME_MAX_LENGTH %d" % max(len(name) for name in names))
+    print("#define ENTITY_TABLE_SIZE %d" % len(slots))
+    print("#define ENTITY_BUCKET_COUNT %d" % len(displacements))
+    print()
+    print("struct t_entity_entry {")
+    print("\tuint16_t nameOffset;")
+    print("\tuint16_t valueOffset;")
+    print("\tuint8_t nameLength;")
+    print("\tuint8_t valueLength;")
+    print("};")
+    print()
+    print("static const uint16_t ENTITY_DISPLACEMENTS[ENTITY_BUCKET_COUNT] = {")
+    for start in range(0, len(displacements), 16):
+        print("\t" + " ".join("%d," % d for d in displacements[start:start + 16]))
+    print("};")
+    print()
+    print("static const struct t_entity_entry ENTITY_TABLE[ENTITY_TABLE_SIZE] = {")
+    for name_offset, name_length, value_offset, value_length, name in rows:
+        print("\t{ %d, %d, %d, %d }, /* %s */" % (name_offset, value_offset, name_length, value_length, name.decode("ascii")))
+    print("};")
+    print()
+    print("static const char ENTITY_NAMES[] =")
+    for start in range(0, len(name_pool), 64):
+        print("\t\"%s\"" % name_pool[start:start + 64].decode("ascii"))
+    print("\t;")
+    print()
+    print("static const char ENTITY_VALUES[] =")
+    for start in range(0, len(value_pool), 16):
+        print("\t\"%s\"" % c_string(value_pool[start:start + 16]))
+    print("\t;")
+    print()
+    print("#endif /* entities_table_h */")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+#
+#  generate_tag_kinds.py
+#  HTMLFastParse
+#
+#  Generates t_tag_kind.h, the tag kind enum and a perfect hash from tag names to kinds.
+#  Run this again after changing TAGS: python3 generate_tag_kinds.py > t_tag_kind.h
+#
+
+import itertools
+
+# (tag name, enum suffix) for every tag the parser understands. Anything else is TAG_UNKNOWN
+TAGS = [
+    ("a", "A"),
+    ("b", "B"),
+    ("blockquote", "BLOCKQUOTE"),
+    ("br", "BR"),
+    ("code", "CODE"),
+    ("del", "DEL"),
+    ("div", "DIV"),
+    ("em", "EM"),
+    ("h1", "H1"),
+    ("h2", "H2"),
+    ("h3", "H3"),
+    ("h4", "H4"),
+    ("h5", "H5"),
+    ("h6", "H6"),
+    ("hr", "HR"),
+    ("i", "I"),
+    ("li", "LI"),
+    ("ol", "OL"),
+    ("p", "P"),
+    ("pre", "PRE"),
+    ("s", "S"),
+    ("strike", "STRIKE"),
+    ("strong", "STRONG"),
+    ("sup", "SUP"),
+    ("ul", "UL"),
+]
+
+MAX_TAG_LENGTH = max(len(name) for name, _ in TAGS)
+
+
+def tag_hash(name, multipliers, table_size):
+    first = ord(name[0])
+    last = ord(name[-1])
+    a, b, c = multipliers
+    return (len(name) * a + first * b + last * c) % table_size
+
+
+def find_perfect_hash():
+    table_size = 1
+    while table_size < len(TAGS):
+        table_size *= 2
+    while True:
+        for multipliers in itertools.product(range(1, 64), repeat=3):
+            slots = set(tag_hash(name, multipliers, table_size) for name, _ in TAGS)
+            if len(slots) == len(TAGS):
+                return multipliers, table_size
+        table_size *= 2
+
+
+def main():
+    multipliers, table_size = find_perfect_hash()
+    table = [None] * table_size
+    for name, kind in TAGS:
+        table[tag_hash(name, multipliers, table_size)] = (name, kind)
+
+    print("//")
+    print("//  t_tag_kind.h")
+    print("//  HTMLFastParse")
+    print("//")
+    print("//  GENERATED BY generate_tag_kinds.py, DO NOT EDIT")
+    print("//")
+    print()
+    print("#ifndef t_tag_kind_h")
+    print("#define t_tag_kind_h")
+    print()
+    print("#include <stddef.h>")
+    print("#include <string.h>")
+    print()
+    print("/**")
+    print(" Every tag the parser knows about")
+    print(" */")
+    print("enum t_tag_kind {")
+    print("\tTAG_UNKNOWN = 0,")
+    for name, kind in TAGS:
+        print("\tTAG_%s," % kind)
+    print("\tTAG_KIND_COUNT")
+    print("};")
+    print()
+    print("struct t_tag_kind_entry {")
+    print("\tconst char *name;")
+    print("\tunsigned char length;")
+    print("\tunsigned char kind;")
+    print("};")
+    print()
+    print("static const struct t_tag_kind_entry TAG_KIND_TABLE[%d] = {" % table_size)
+    for entry in table:
+        if entry is None:
+            print("\t{ NULL, 0, TAG_UNKNOWN },")
+        else:
+            name, kind = entry
+            print("\t{ \"%s\", %d, TAG_%s }," % (name, len(name), kind))
+    print("};")
+    print()
+    print("/**")
+    print(" Classify a tag name with a perfect hash. There's exactly one slot each name could be in so this is a hash and a single compare")
+    print(" ")
+    print(" @param name The tag name (not null terminated)")
+    print(" @param length The length of name")
+    print(" @return The kind of tag, TAG_UNKNOWN if we don't know it")
+    print(" */")
+    print("static inline enum t_tag_kind classifyTagName(const char *name, size_t length) {")
+    print("\tif (length == 0 || length > %d) {" % MAX_TAG_LENGTH)
+    print("\t\treturn TAG_UNKNOWN;")
+    print("\t}")
+    print("\tsize_t slot = (length * %d + (unsigned char)name[0] * %d + (unsigned char)name[length - 1] * %d) %% %d;" % (multipliers[0], multipliers[1], multipliers[2], table_size))
+    print("\tconst struct t_tag_kind_entry *entry = &TAG_KIND_TABLE[slot];")
+    print("\tif (entry->length == length && memcmp(entry->name, name, length) == 0) {")
+    print("\t\treturn (enum t_tag_kind)entry->kind;")
+    print("\t}")
+    print("\treturn TAG_UNKNOWN;")
+    print("}")
+    print()
+    print("#endif /* t_tag_kind_h */")
+
+
+if __name__ == "__main__":
+    main()
@@ -9,30 +9,98 @@
 #ifndef t_format_h
 #define t_format_h
 
+#include <stdint.h>
+#include <stdbool.h>
 
+/*
+ Layout of t_format.style. Everything that affects how a run looks lives in this one word so two runs look the same exactly when their styles are equal
+ */
+#define T_FORMAT_BOLD ((uint64_t)1 << 0)
+#define T_FORMAT_ITALICS ((uint64_t)1 << 1)
+#define T_FORMAT_STRUCK ((uint64_t)1 << 2)
+#define T_FORMAT_CODE ((uint64_t)1 << 3)
+#define T_FORMAT_H_LEVEL_SHIFT 4
+#define T_FORMAT_EXPONENT_LEVEL_SHIFT 8
+#define T_FORMAT_QUOTE_LEVEL_SHIFT 16
+#define T_FORMAT_LIST_NEST_LEVEL_SHIFT 24
+#define T_FORMAT_LINK_ID_SHIFT 32
+//Levels saturate at this
+#define T_FORMAT_MAX_LEVEL 0xFF
 
 /**
- A structure representing a charachter/range's text formatting
+ A structure representing a charachter/range's text formatting. Read it through the accessors below
  */
 struct t_format {
 	//ZERO MEANS DISABLED
-	unsigned char isBold;
-	unsigned char isItalics;
-	unsigned char isStruck;
-	unsigned char isCode;
-	unsigned char exponentLevel;
-	unsigned char quoteLevel;
-	unsigned char hLevel;
-    unsigned char listNestLevel;
-    /*unsigned short LONG_DOUBLE_BUFFER_REMOVE2;
-    unsigned short LONG_DOUBLE_BUFFER_REMOVE4;
-    unsigned short LONG_DOUBLE_BUFFER_REMOVE6;
-    unsigned char LONG_DOUBLE_BUFFER_REMOVE7;*/
-    
-	char* linkURL;
+	//Bits 0-3 bold/italics/struck/code, 4-7 hLevel, 8-15 exponentLevel, 16-23 quoteLevel, 24-31 listNestLevel, 32-63 link ID
+	uint64_t style;
 	
 	unsigned int startPosition;
 	unsigned int endPosition;
 };
 
+static inline bool formatIsBold(struct t_format format) {
+	return (format.style & T_FORMAT_BOLD) != 0;
+}
+
+static inline bool formatIsItalics(struct t_format format) {
+	return (format.style & T_FORMAT_ITALICS) != 0;
+}
+
+static inline bool formatIsStruck(struct t_format format) {
+	return (format.style & T_FORMAT_STRUCK) != 0;
+}
+
+static inline bool formatIsCode(struct t_format format) {
+	return (format.style & T_FORMAT_CODE) != 0;
+}
+
+static inline unsigned char formatHLevel(struct t_format format) {
+	return (format.style >> T_FORMAT_H_LEVEL_SHIFT) & 0xF;
+}
+
+static inline unsigned char formatExponentLevel(struct t_format format) {
+	return (format.style >> T_FORMAT_EXPONENT_LEVEL_SHIFT) & 0xFF;
+}
+
+static inline unsigned char formatQuoteLevel(struct t_format format) {
+	return (format.style >> T_FORMAT_QUOTE_LEVEL_SHIFT) & 0xFF;
+}
+
+static inline unsigned char formatListNestLevel(struct t_format format) {
+	return (format.style >> T_FORMAT_LIST_NEST_LEVEL_SHIFT) & 0xFF;
+}
+
+/**
+ The link of a format, as an index into the document's link table plus one. Zero means no link
+ */
+static inline unsigned int formatLinkID(struct t_format format) {
+	return (unsigned int)(format.style >> T_FORMAT_LINK_ID_SHIFT);
+}
+
+/**
+ The links referred to by a document's formats. Every unique link URL is stored once, back to back in linkText, so a link spanning several runs is shared by all of them
+ */
+struct t_link_table {
+	//Null terminated link URLs one after another
+	char *linkText;
+	size_t linkTextLength;
+	size_t linkTextCapacity;
+	//Where each link's URL starts in linkText, link ID n is at linkOffsets[n - 1]
+	size_t *linkOffsets;
+	int numberOfLinks;
+	size_t capacity;
+};
+
+/**
+ The URL of a link
+ 
+ @param links The document's link table
+ @param linkID A non zero link ID, as given by formatLinkID
+ @return The null terminated URL, which belongs to the table
+ */
+static inline const char* linkTableURL(const struct t_link_table *links, unsigned int linkID) {
+	return links->linkText + links->linkOffsets[linkID - 1];
+}
+
 #endif /* t_format_h */
@@ -4,9 +4,14 @@
 
 #ifndef HTMLTOATTR_FORMAT_H
 #define HTMLTOATTR_FORMAT_H
+#include "t_tag_kind.h"
+
 struct t_tag {
     unsigned int startPosition;
     unsigned int endPosition;
-    char* tag;
+    //The kind of tag, classified once when the tag is closed (a t_tag_kind)
+    unsigned char kind;
+    //The link target of <a href="..."> tags, NULL for everything else
+    char* linkURL;
 };
 #endif //HTMLTOATTR_FORMAT_H
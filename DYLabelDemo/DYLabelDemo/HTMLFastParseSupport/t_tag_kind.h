@@ -0,0 +1,203 @@
+//
+//  t_tag_kind.h
+//  HTMLFastParse
+//
+//  GENERATED BY generate_tag_kinds.py, DO NOT EDIT
+//
+
+#ifndef t_tag_kind_h
+#define t_tag_kind_h
+
+#include <stddef.h>
+#include <string.h>
+
+/**
+ Every tag the parser knows about
+ */
+enum t_tag_kind {
+	TAG_UNKNOWN = 0,
+	TAG_A,
+	TAG_B,
+	TAG_BLOCKQUOTE,
+	TAG_BR,
+	TAG_CODE,
+	TAG_DEL,
+	TAG_DIV,
+	TAG_EM,
+	TAG_H1,
+	TAG_H2,
+	TAG_H3,
+	TAG_H4,
+	TAG_H5,
+	TAG_H6,
+	TAG_HR,
+	TAG_I,
+	TAG_LI,
+	TAG_OL,
+	TAG_P,
+	TAG_PRE,
+	TAG_S,
+	TAG_STRIKE,
+	TAG_STRONG,
+	TAG_SUP,
+	TAG_UL,
+	TAG_KIND_COUNT
+};
+
+struct t_tag_kind_entry {
+	const char *name;
+	unsigned char length;
+	unsigned char kind;
+};
+
+static const struct t_tag_kind_entry TAG_KIND_TABLE[128] = {
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "del", 3, TAG_DEL },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "em", 2, TAG_EM },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "ol", 2, TAG_OL },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "ul", 2, TAG_UL },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "br", 2, TAG_BR },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "p", 1, TAG_P },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "hr", 2, TAG_HR },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "sup", 3, TAG_SUP },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "s", 1, TAG_S },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "div", 3, TAG_DIV },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "a", 1, TAG_A },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "b", 1, TAG_B },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "h1", 2, TAG_H1 },
+	{ "code", 4, TAG_CODE },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "h2", 2, TAG_H2 },
+	{ "blockquote", 10, TAG_BLOCKQUOTE },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "h3", 2, TAG_H3 },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "pre", 3, TAG_PRE },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "h4", 2, TAG_H4 },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "strike", 6, TAG_STRIKE },
+	{ "h5", 2, TAG_H5 },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "i", 1, TAG_I },
+	{ "h6", 2, TAG_H6 },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ "li", 2, TAG_LI },
+	{ "strong", 6, TAG_STRONG },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+	{ NULL, 0, TAG_UNKNOWN },
+};
+
+/**
+ Classify a tag name with a perfect hash. There's exactly one slot each name could be in so this is a hash and a single compare
+ 
+ @param name The tag name (not null terminated)
+ @param length The length of name
+ @return The kind of tag, TAG_UNKNOWN if we don't know it
+ */
+static inline enum t_tag_kind classifyTagName(const char *name, size_t length) {
+	if (length == 0 || length > 10) {
+		return TAG_UNKNOWN;
+	}
+	size_t slot = (length * 1 + (unsigned char)name[0] * 1 + (unsigned char)name[length - 1] * 5) % 128;
+	const struct t_tag_kind_entry *entry = &TAG_KIND_TABLE[slot];
+	if (entry->length == length && memcmp(entry->name, name, length) == 0) {
+		return (enum t_tag_kind)entry->kind;
+	}
+	return TAG_UNKNOWN;
+}
+
+#endif /* t_tag_kind_h */
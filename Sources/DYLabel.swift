@@ -343,9 +343,16 @@ public class DYLabel: UIView {
             var frameLabel = ""
             var lastLinkItem:DYLink? = items.first as? DYLink
             var nextItemIsNewParagraph:Bool = false
+            var lastParagraph:NSObject? = nil
             
             for item in items {
                 let currentIsText = (item is DYLink) == false
+                //Text marked with its paragraph (i.e. by FormatToAttributedString) is split where the paragraph changes, anything else after new lines
+                let paragraph = attributedText.attribute(DYLabel.Key.Paragraph, at: item.range.location, effectiveRange: nil) as? NSObject
+                if paragraph != nil || lastParagraph != nil {
+                    nextItemIsNewParagraph = paragraph != lastParagraph
+                }
+                lastParagraph = paragraph
                 //if shouldDYLabelParseIntoParagraphs is false, short-circuit the paragraph split mode so the entire thing (except links) is read in one go
                 if lastIsText != currentIsText || (nextItemIsNewParagraph && shouldGenerateAccessibilityFramesForParagraphs) {
                     nextItemIsNewParagraph = false
@@ -365,8 +372,11 @@ public class DYLabel: UIView {
                     frames = []
                 }
                 
-                nextItemIsNewParagraph = textContent.substring(with: NSRange.init(location: item.range.location, length: item.range.length)).contains("\n")
-                frameLabel.append(textContent.substring(with: NSRange.init(location: item.range.location, length: item.range.length)))
+                let itemText = textContent.substring(with: NSRange.init(location: item.range.location, length: item.range.length))
+                if paragraph == nil {
+                    nextItemIsNewParagraph = itemText.contains("\n")
+                }
+                frameLabel.append(itemText)
                 frames.append(item.bounds)
             }
             
@@ -691,6 +701,8 @@ public class DYLabel: UIView {
         /// Hacky add-on to let you draw a line from the beneath  this text to from x=0 to x=max. You'll want to apply this to the line with the LOWEST baseline for proper looks
         public static let FullLineUnderLine = NSAttributedString.Key.init("DYLabel.FullLineUnderLineKey")
         public static let FullLineUnderLineColor = NSAttributedString.Key.init("DYLabel.FullLineUnderLineColorKey")
+        /// Marks which paragraph text belongs to, with any value that's equal for every run of the paragraph. Accessibility elements are split where it changes rather than after new lines
+        public static let Paragraph = NSAttributedString.Key.init("DYLabel.ParagraphKey")
     }
 }
 
@@ -0,0 +1,454 @@
+//
+//  bulk_convert.c
+//  HTMLFastParse
+//
+//  Converts an archive dump of comment bodies into display text and runs, parsed exactly the way the app parses them, so they can be
+//  pre-rendered on a server. The dump is mapped rather than read, so it can be far bigger than memory. It's cut into slices of whole documents
+//  which worker threads claim in order, parse with their own parser context into an output buffer and then append to the output in input order.
+//
+//  usage: bulk_convert [--length-prefixed] [--generic] [--binary] [--threads count] [--slice-size megabytes] input output
+//
+//  Input is one HTML body per line or, with --length-prefixed, each body preceded by its length in bytes as a 32 bit little-endian integer.
+//  Output is one line per document: the display text, then a tab and "start:end:style" for every run, followed by ":url" if the run is a link.
+//  Positions are the runs' t_format positions, the style is the low 32 bits of t_format.style in hex, and text and URLs have \, tab, new line
+//  and carriage return escaped C style. The runs are followed by a tab and "b" then "start:end:kind:quote depth:list depth" for every block, in the
+//  order t_parsed_document.blocks has them, with the kind as its t_tag_kind number. An output of - is standard output.
+//  With --binary the output is a file of binary records instead (see BinaryDocument.c), which the app can map and use without parsing.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "C_HTML_Parser.h"
+#include "BinaryDocument.h"
+
+#define DEFAULT_SLICE_SIZE (8 * 1024 * 1024)
+
+/**
+ The mapped dump
+ */
+struct t_input {
+	const unsigned char *bytes;
+	size_t length;
+	bool isLengthPrefixed;
+};
+
+/**
+ A worker's output for the slice it's working on
+ */
+struct t_output_buffer {
+	char *bytes;
+	size_t length;
+	size_t capacity;
+};
+
+struct t_converter {
+	struct t_input input;
+	size_t sliceSize;
+	enum t_html_dialect dialect;
+	int outputFile;
+	//Set when writing binary records
+	struct t_document_file_writer *binaryWriter;
+	
+	//Handing out slices, in order
+	pthread_mutex_t sliceLock;
+	size_t nextSliceStart;
+	long nextSliceIndex;
+	
+	//Writing them out in the same order. Totals are only touched with writeLock held
+	pthread_mutex_t writeLock;
+	pthread_cond_t writeTurn;
+	long nextSliceToWrite;
+	bool hasWriteFailed;
+	long numberOfDocuments;
+};
+
+static double now(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/* Input */
+
+/**
+ Find the next document in the input
+ 
+ @param input The input
+ @param position The position of the document, moved past it
+ @param end Where the slice being read ends
+ @param html (returned) The document's HTML
+ @param length (returned) Its length
+ @return false if there are no documents left before end
+ */
+static bool nextDocument(const struct t_input *input, size_t *position, size_t end, const char **html, size_t *length) {
+	size_t start = *position;
+	if (start >= end) {
+		return false;
+	}
+	if (!input->isLengthPrefixed) {
+		const unsigned char *newLine = memchr(&input->bytes[start], '\n', end - start);
+		size_t documentEnd = newLine != NULL ? (size_t)(newLine - input->bytes) : end;
+		*html = (const char *)&input->bytes[start];
+		*length = documentEnd - start;
+		*position = newLine != NULL ? documentEnd + 1 : end;
+		return true;
+	}
+	
+	//A truncated prefix at the very end is dropped, a truncated document is parsed as far as it goes
+	if (end - start < 4) {
+		*position = end;
+		return false;
+	}
+	const unsigned char *prefix = &input->bytes[start];
+	size_t documentLength = (size_t)prefix[0] | (size_t)prefix[1] << 8 | (size_t)prefix[2] << 16 | (size_t)prefix[3] << 24;
+	if (documentLength > end - start - 4) {
+		documentLength = end - start - 4;
+	}
+	*html = (const char *)&prefix[4];
+	*length = documentLength;
+	*position = start + 4 + documentLength;
+	return true;
+}
+
+/**
+ Where a slice starting at start should end: the first document boundary at least sliceSize bytes in
+ */
+static size_t findSliceEnd(const struct t_input *input, size_t start, size_t sliceSize) {
+	if (input->length - start <= sliceSize) {
+		return input->length;
+	}
+	if (!input->isLengthPrefixed) {
+		const unsigned char *newLine = memchr(&input->bytes[start + sliceSize], '\n', input->length - start - sliceSize);
+		return newLine != NULL ? (size_t)(newLine - input->bytes) + 1 : input->length;
+	}
+	//Length prefixes have to be followed from the start of the slice, which only touches one page per document
+	size_t position = start;
+	const char *html;
+	size_t length;
+	while (position - start < sliceSize) {
+		if (!nextDocument(input, &position, input->length, &html, &length)) {
+			break;
+		}
+	}
+	return position;
+}
+
+/**
+ Claim the next slice of whole documents
+ 
+ @return false once the input is used up
+ */
+static bool claimSlice(struct t_converter *converter, size_t *start, size_t *end, long *index) {
+	pthread_mutex_lock(&converter->sliceLock);
+	bool hasSlice = converter->nextSliceStart < converter->input.length;
+	if (hasSlice) {
+		*start = converter->nextSliceStart;
+		*end = findSliceEnd(&converter->input, *start, converter->sliceSize);
+		*index = converter->nextSliceIndex++;
+		converter->nextSliceStart = *end;
+	}
+	pthread_mutex_unlock(&converter->sliceLock);
+	return hasSlice;
+}
+
+/**
+ Let the kernel drop the pages of a finished slice so a dump bigger than memory doesn't push everything else out. The pages it shares with its
+ neighbours are left alone
+ */
+static void releaseSlice(const struct t_input *input, size_t start, size_t end) {
+	size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+	uintptr_t first = ((uintptr_t)&input->bytes[start] + pageSize - 1) / pageSize * pageSize;
+	uintptr_t last = (uintptr_t)&input->bytes[end] / pageSize * pageSize;
+	if (last > first) {
+		madvise((void *)first, last - first, MADV_DONTNEED);
+	}
+}
+
+/* Output */
+
+static char* reserveOutput(struct t_output_buffer *output, size_t length) {
+	if (output->length + length > output->capacity) {
+		size_t capacity = output->capacity > 0 ? output->capacity * 2 : 64 * 1024;
+		while (capacity < output->length + length) {
+			capacity *= 2;
+		}
+		output->bytes = realloc(output->bytes, capacity);
+		output->capacity = capacity;
+	}
+	return &output->bytes[output->length];
+}
+
+static void appendEscaped(struct t_output_buffer *output, const char text[], size_t length) {
+	//Worst case every byte is escaped
+	char *cursor = reserveOutput(output, length * 2);
+	for (size_t i = 0; i < length; i++) {
+		char charachter = text[i];
+		switch (charachter) {
+			case '\\':
+				*cursor++ = '\\';
+				*cursor++ = '\\';
+				break;
+			case '\t':
+				*cursor++ = '\\';
+				*cursor++ = 't';
+				break;
+			case '\n':
+				*cursor++ = '\\';
+				*cursor++ = 'n';
+				break;
+			case '\r':
+				*cursor++ = '\\';
+				*cursor++ = 'r';
+				break;
+			default:
+				*cursor++ = charachter;
+				break;
+		}
+	}
+	output->length = cursor - output->bytes;
+}
+
+static void appendNumber(struct t_output_buffer *output, uint32_t number, unsigned int base) {
+	static const char digits[] = "0123456789abcdef";
+	char reversed[16];
+	int numberOfDigits = 0;
+	do {
+		reversed[numberOfDigits++] = digits[number % base];
+		number /= base;
+	} while (number > 0);
+	char *cursor = reserveOutput(output, numberOfDigits);
+	while (numberOfDigits > 0) {
+		*cursor++ = reversed[--numberOfDigits];
+	}
+	output->length = cursor - output->bytes;
+}
+
+static void appendCharachter(struct t_output_buffer *output, char charachter) {
+	*reserveOutput(output, 1) = charachter;
+	output->length++;
+}
+
+static void appendDocument(struct t_output_buffer *output, const struct t_parsed_document *parsed) {
+	appendEscaped(output, parsed->displayText, parsed->displayTextLength);
+	for (int i = 0; i < parsed->numberOfFormats; i++) {
+		struct t_format format = parsed->formats[i];
+		appendCharachter(output, '\t');
+		appendNumber(output, format.startPosition, 10);
+		appendCharachter(output, ':');
+		appendNumber(output, format.endPosition, 10);
+		appendCharachter(output, ':');
+		appendNumber(output, (uint32_t)format.style, 16);
+		unsigned int linkID = formatLinkID(format);
+		if (linkID != 0) {
+			const char *url = linkTableURL(&parsed->links, linkID);
+			appendCharachter(output, ':');
+			appendEscaped(output, url, strlen(url));
+		}
+	}
+	for (int i = 0; i < parsed->numberOfBlocks; i++) {
+		struct t_block block = parsed->blocks[i];
+		appendCharachter(output, '\t');
+		appendCharachter(output, 'b');
+		appendNumber(output, block.startPosition, 10);
+		appendCharachter(output, ':');
+		appendNumber(output, block.endPosition, 10);
+		appendCharachter(output, ':');
+		appendNumber(output, block.kind, 10);
+		appendCharachter(output, ':');
+		appendNumber(output, block.quoteDepth, 10);
+		appendCharachter(output, ':');
+		appendNumber(output, block.listDepth, 10);
+	}
+	appendCharachter(output, '\n');
+}
+
+static bool writeAll(int file, const char bytes[], size_t length) {
+	while (length > 0) {
+		ssize_t written = write(file, bytes, length);
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		bytes += written;
+		length -= written;
+	}
+	return true;
+}
+
+/**
+ Wait for the slices before this one to be written, then write it
+ */
+static void writeSlice(struct t_converter *converter, long index, const struct t_output_buffer *output, long numberOfDocuments) {
+	pthread_mutex_lock(&converter->writeLock);
+	while (converter->nextSliceToWrite != index) {
+		pthread_cond_wait(&converter->writeTurn, &converter->writeLock);
+	}
+	if (converter->binaryWriter != NULL) {
+		if (!writeEncodedDocuments(converter->binaryWriter, output->bytes, output->length)) {
+			converter->hasWriteFailed = true;
+		}
+	}else if (!converter->hasWriteFailed && !writeAll(converter->outputFile, output->bytes, output->length)) {
+		converter->hasWriteFailed = true;
+	}
+	converter->numberOfDocuments += numberOfDocuments;
+	converter->nextSliceToWrite++;
+	pthread_cond_broadcast(&converter->writeTurn);
+	pthread_mutex_unlock(&converter->writeLock);
+}
+
+/* Workers */
+
+static void* converterWorkerMain(void *context) {
+	struct t_converter *converter = context;
+	struct t_parser_context *parserContext = createParserContext();
+	setParserContextDialect(parserContext, converter->dialect);
+	struct t_output_buffer output = {NULL, 0, 0};
+	
+	size_t start;
+	size_t end;
+	long index;
+	while (claimSlice(converter, &start, &end, &index)) {
+		output.length = 0;
+		long numberOfDocuments = 0;
+		size_t position = start;
+		const char *html;
+		size_t length;
+		while (nextDocument(&converter->input, &position, end, &html, &length)) {
+			struct t_parsed_document parsed;
+			parseHTMLWithContext(parserContext, html, length, &parsed);
+			if (converter->binaryWriter != NULL) {
+				char *record = reserveOutput(&output, encodedDocumentSize(&parsed));
+				output.length += encodeParsedDocument(&parsed, record);
+			}else {
+				appendDocument(&output, &parsed);
+			}
+			numberOfDocuments++;
+		}
+		releaseSlice(&converter->input, start, end);
+		writeSlice(converter, index, &output, numberOfDocuments);
+	}
+	
+	free(output.bytes);
+	freeParserContext(parserContext);
+	return NULL;
+}
+
+static int usage(const char *name) {
+	fprintf(stderr, "usage: %s [--length-prefixed] [--generic] [--binary] [--threads count] [--slice-size megabytes] input output\n", name);
+	return 1;
+}
+
+int main(int argc, const char *argv[]) {
+	const char *inputPath = NULL;
+	const char *outputPath = NULL;
+	bool isLengthPrefixed = false;
+	bool isBinary = false;
+	enum t_html_dialect dialect = HTML_DIALECT_REDDIT;
+	long onlineCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+	int numberOfThreads = onlineCPUs > 0 ? (int)onlineCPUs : 1;
+	size_t sliceSize = DEFAULT_SLICE_SIZE;
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "--length-prefixed") == 0) {
+			isLengthPrefixed = true;
+		}else if (strcmp(argv[i], "--binary") == 0) {
+			isBinary = true;
+		}else if (strcmp(argv[i], "--generic") == 0) {
+			dialect = HTML_DIALECT_GENERIC;
+		}else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			numberOfThreads = atoi(argv[++i]);
+		}else if (strcmp(argv[i], "--slice-size") == 0 && i + 1 < argc) {
+			sliceSize = (size_t)(atof(argv[++i]) * 1024 * 1024);
+		}else if (inputPath == NULL) {
+			inputPath = argv[i];
+		}else if (outputPath == NULL) {
+			outputPath = argv[i];
+		}else {
+			return usage(argv[0]);
+		}
+	}
+	if (inputPath == NULL || outputPath == NULL || numberOfThreads < 1 || sliceSize < 1) {
+		return usage(argv[0]);
+	}
+	
+	int inputFile = open(inputPath, O_RDONLY);
+	struct stat inputStatus;
+	if (inputFile < 0 || fstat(inputFile, &inputStatus) != 0) {
+		fprintf(stderr, "%s: %s\n", inputPath, strerror(errno));
+		return 1;
+	}
+	struct t_converter converter;
+	memset(&converter, 0, sizeof(converter));
+	converter.input.length = (size_t)inputStatus.st_size;
+	converter.input.isLengthPrefixed = isLengthPrefixed;
+	if (converter.input.length > 0) {
+		void *mapping = mmap(NULL, converter.input.length, PROT_READ, MAP_PRIVATE, inputFile, 0);
+		if (mapping == MAP_FAILED) {
+			fprintf(stderr, "%s: %s\n", inputPath, strerror(errno));
+			return 1;
+		}
+		madvise(mapping, converter.input.length, MADV_SEQUENTIAL);
+		converter.input.bytes = mapping;
+	}
+	close(inputFile);
+	
+	converter.outputFile = strcmp(outputPath, "-") == 0 ? STDOUT_FILENO : open(outputPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (converter.outputFile < 0) {
+		fprintf(stderr, "%s: %s\n", outputPath, strerror(errno));
+		return 1;
+	}
+	converter.binaryWriter = isBinary ? createDocumentFileWriter(converter.outputFile) : NULL;
+	converter.sliceSize = sliceSize;
+	converter.dialect = dialect;
+	pthread_mutex_init(&converter.sliceLock, NULL);
+	pthread_mutex_init(&converter.writeLock, NULL);
+	pthread_cond_init(&converter.writeTurn, NULL);
+	
+	double start = now();
+	//The calling thread is one of the workers
+	pthread_t *threads = malloc(numberOfThreads * sizeof(pthread_t));
+	int numberOfStartedThreads = 0;
+	for (int i = 1; i < numberOfThreads; i++) {
+		if (pthread_create(&threads[numberOfStartedThreads], NULL, converterWorkerMain, &converter) == 0) {
+			numberOfStartedThreads++;
+		}
+	}
+	converterWorkerMain(&converter);
+	for (int i = 0; i < numberOfStartedThreads; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	double elapsed = now() - start;
+	free(threads);
+	
+	bool hasFailed = converter.hasWriteFailed;
+	if (converter.binaryWriter != NULL && !finishDocumentFileWriter(converter.binaryWriter)) {
+		hasFailed = true;
+	}
+	if (converter.outputFile != STDOUT_FILENO && close(converter.outputFile) != 0) {
+		hasFailed = true;
+	}
+	if (hasFailed) {
+		fprintf(stderr, "%s: %s\n", outputPath, strerror(errno));
+	}
+	if (converter.input.length > 0) {
+		munmap((void *)converter.input.bytes, converter.input.length);
+	}
+	pthread_cond_destroy(&converter.writeTurn);
+	pthread_mutex_destroy(&converter.writeLock);
+	pthread_mutex_destroy(&converter.sliceLock);
+	
+	fprintf(stderr, "%ld documents, %.2f MB in %.3f s on %d threads: %.0f docs/s, %.1f MB/s\n", converter.numberOfDocuments, converter.input.length / 1e6, elapsed, numberOfStartedThreads + 1, converter.numberOfDocuments / elapsed, converter.input.length / 1e6 / elapsed);
+	return hasFailed ? 1 : 0;
+}